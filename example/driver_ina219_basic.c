@@ -158,6 +158,98 @@ uint8_t ina219_basic_init(ina219_address_t addr_pin, double r)
         return 1;
     }
     
+    /* set power mode */
+    res = ina219_set_power_mode(&gs_handle, INA219_BASIC_DEFAULT_POWER_MODE);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set power mode failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief         basic example warm init
+ * @param[in]     addr_pin iic address pin
+ * @param[in]     r reference resistor value
+ * @param[in,out] *cache pointer to an ina219 warm cache structure
+ * @param[out]    *warm pointer to a warm start flag buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 init failed
+ * @note          the cached conf and calibration are verified and reused when they match,
+ *                otherwise the chip is fully initialized and the cache entry is updated
+ */
+uint8_t ina219_basic_init_warm(ina219_address_t addr_pin, double r, ina219_warm_cache_t *cache, uint8_t *warm)
+{
+    uint8_t res;
+    ina219_warm_entry_t *entry;
+    ina219_warm_entry_t save;
+    
+    /* link interface function */
+    DRIVER_INA219_LINK_INIT(&gs_handle, ina219_handle_t);
+    DRIVER_INA219_LINK_IIC_INIT(&gs_handle, ina219_interface_iic_init);
+    DRIVER_INA219_LINK_IIC_DEINIT(&gs_handle, ina219_interface_iic_deinit);
+    DRIVER_INA219_LINK_IIC_READ(&gs_handle, ina219_interface_iic_read);
+    DRIVER_INA219_LINK_IIC_WRITE(&gs_handle, ina219_interface_iic_write);
+    DRIVER_INA219_LINK_DELAY_MS(&gs_handle, ina219_interface_delay_ms);
+    DRIVER_INA219_LINK_DEBUG_PRINT(&gs_handle, ina219_interface_debug_print);
+    
+    /* set addr pin */
+    res = ina219_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set addr pin failed.\n");
+       
+        return 1;
+    }
+    
+    /* set the r */
+    res = ina219_set_resistance(&gs_handle, r);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set resistance failed.\n");
+       
+        return 1;
+    }
+    
+    /* try the cached configuration */
+    *warm = 0;
+    if (ina219_warm_cache_find(cache, (uint8_t)addr_pin, r, &entry) == 0)
+    {
+        if (ina219_warm_init(&gs_handle, entry) == 0)
+        {
+            *warm = 1;
+            
+            return 0;
+        }
+    }
+    
+    /* cold init */
+    res = ina219_basic_init(addr_pin, r);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* save the configuration */
+    res = ina219_warm_save(&gs_handle, &save);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: warm save failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ina219_warm_cache_store(cache, &save);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: warm cache is full.\n");
+    }
+    
     return 0;
 }
 
@@ -176,6 +268,7 @@ uint8_t ina219_basic_read(float *mV, float *mA, float *mW)
     uint8_t res;
     int16_t s_raw;
     uint16_t u_raw;
+    ina219_power_mode_t mode;
     
     /* read bus voltage */
     res = ina219_read_bus_voltage(&gs_handle, (uint16_t *)&u_raw, mV);
@@ -191,13 +284,103 @@ uint8_t ina219_basic_read(float *mV, float *mA, float *mW)
         return 1;
     }
     
-    /* read power */
-    res = ina219_read_power(&gs_handle, (uint16_t *)&u_raw, mW);
+    /* get power mode */
+    res = ina219_get_power_mode(&gs_handle, &mode);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    if (mode == INA219_POWER_MODE_DERIVED)
+    {
+        /* calculate power */
+        res = ina219_calculate_power(&gs_handle, s_raw, u_raw, (uint16_t *)&u_raw, mW);
+        if (res != 0)
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        /* read power */
+        res = ina219_read_power(&gs_handle, (uint16_t *)&u_raw, mW);
+        if (res != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example read the raw registers
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ina219_basic_read_sample(ina219_sample_t *sample)
+{
+    uint8_t res;
+    
+    /* read sample */
+    res = ina219_read_sample(&gs_handle, sample);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example get the register context
+ * @param[out] *conf pointer to a conf register buffer
+ * @param[out] *calibration pointer to a calibration register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get context failed
+ * @note       none
+ */
+uint8_t ina219_basic_get_context(uint16_t *conf, uint16_t *calibration)
+{
+    uint8_t res;
+    
+    /* get conf */
+    res = ina219_get_reg(&gs_handle, 0x00, conf);
     if (res != 0)
     {
         return 1;
     }
     
+    /* get calibration */
+    res = ina219_get_calibration(&gs_handle, calibration);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example get the convert context
+ * @param[out] *convert pointer to an ina219 convert structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get convert failed
+ * @note       none
+ */
+uint8_t ina219_basic_get_convert(ina219_convert_t *convert)
+{
+    /* init the convert context */
+    if (ina219_convert_init(&gs_handle, convert) != 0)
+    {
+        return 1;
+    }
+    
     return 0;
 }
 
@@ -38,6 +38,8 @@
 #define DRIVER_INA219_BASIC_H
 
 #include "driver_ina219_interface.h"
+#include "driver_ina219_convert.h"
+#include "driver_ina219_warm.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -58,6 +60,15 @@ extern "C"{
 #define INA219_BASIC_DEFAULT_SHUNT_VOLTAGE_ADC_MODE       INA219_ADC_MODE_12_BIT_1_SAMPLES         /**< set shunt voltage adc mode 12 bit 1 sample */
 #define INA219_BASIC_DEFAULT_PGA                          INA219_PGA_320_MV                        /**< set pga 320 mV */
 
+/**
+ * @brief ina219 basic example default power mode definition
+ * @note  define it as INA219_POWER_MODE_DERIVED to skip the power register read,
+ *        then the conversion ready bit is never cleared and a stale read is not reported
+ */
+#ifndef INA219_BASIC_DEFAULT_POWER_MODE
+    #define INA219_BASIC_DEFAULT_POWER_MODE INA219_POWER_MODE_REGISTER        /**< read the power register */
+#endif
+
 /**
  * @brief     basic example init
  * @param[in] addr_pin iic address pin
@@ -69,6 +80,20 @@ extern "C"{
  */
 uint8_t ina219_basic_init(ina219_address_t addr_pin, double r);
 
+/**
+ * @brief         basic example warm init
+ * @param[in]     addr_pin iic address pin
+ * @param[in]     r reference resistor value
+ * @param[in,out] *cache pointer to an ina219 warm cache structure
+ * @param[out]    *warm pointer to a warm start flag buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 init failed
+ * @note          the cached conf and calibration are verified and reused when they match,
+ *                otherwise the chip is fully initialized and the cache entry is updated
+ */
+uint8_t ina219_basic_init_warm(ina219_address_t addr_pin, double r, ina219_warm_cache_t *cache, uint8_t *warm);
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -90,6 +115,37 @@ uint8_t ina219_basic_deinit(void);
  */
 uint8_t ina219_basic_read(float *mV, float *mA, float *mW);
 
+/**
+ * @brief      basic example read the raw registers
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ina219_basic_read_sample(ina219_sample_t *sample);
+
+/**
+ * @brief      basic example get the register context
+ * @param[out] *conf pointer to a conf register buffer
+ * @param[out] *calibration pointer to a calibration register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get context failed
+ * @note       none
+ */
+uint8_t ina219_basic_get_context(uint16_t *conf, uint16_t *calibration);
+
+/**
+ * @brief      basic example get the convert context
+ * @param[out] *convert pointer to an ina219 convert structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get convert failed
+ * @note       none
+ */
+uint8_t ina219_basic_get_convert(ina219_convert_t *convert);
+
 /**
  * @}
  */
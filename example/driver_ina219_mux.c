@@ -0,0 +1,329 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_mux.c
+ * @brief     driver ina219 mux source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "driver_ina219_mux.h"
+
+static ina219_handle_t gs_handle[INA219_TOPOLOGY_MAX_DEVICE];        /**< ina219 handles */
+static uint16_t gs_num;                                            /**< inited device number */
+static ina219_topology_t gs_topology;                              /**< device topology */
+static ina219_sample_t *gs_sample;                                 /**< sweep output */
+
+/**
+ * @brief     write a mux control register
+ * @param[in] adapter iic adapter index
+ * @param[in] addr iic mux write address
+ * @param[in] data control byte
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the interface drives one adapter
+ */
+static uint8_t a_ina219_mux_write(uint8_t adapter, uint8_t addr, uint8_t data)
+{
+    (void)adapter;
+    
+    return ina219_interface_iic_write_cmd(addr, &data, 1);
+}
+
+/**
+ * @brief     read a device of the sweep
+ * @param[in] index device index
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      the mux path is already selected
+ */
+static uint8_t a_ina219_mux_read(uint16_t index)
+{
+    return ina219_read_sample(&gs_handle[index], &gs_sample[index]);
+}
+
+/**
+ * @brief     mux example init
+ * @param[in] *path pointer to a mux path list
+ * @param[in] *addr_pin pointer to an iic address pin list
+ * @param[in] num device number
+ * @param[in] r reference resistor value
+ * @param[in] mode shunt and bus voltage adc mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      num <= INA219_TOPOLOGY_MAX_DEVICE, the muxes are tca9548a like switches on the
+ *            adapter of the interface, all the devices run continuously
+ */
+uint8_t ina219_mux_init(const ina219_topology_path_t *path, const ina219_address_t *addr_pin, uint16_t num,
+                        double r, ina219_adc_mode_t mode)
+{
+    uint8_t res;
+    uint16_t i;
+    uint16_t index;
+    uint16_t calibration;
+    
+    if ((num == 0) || (num > INA219_TOPOLOGY_MAX_DEVICE))
+    {
+        ina219_interface_debug_print("ina219: device number is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* topology init */
+    res = ina219_topology_init(&gs_topology, INA219_TOPOLOGY_MUX_TYPE_SWITCH, a_ina219_mux_write);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: topology init failed.\n");
+        
+        return 1;
+    }
+    
+    gs_num = 0;
+    for (i = 0; i < num; i++)
+    {
+        ina219_handle_t *handle = &gs_handle[i];
+        
+        /* add the device */
+        res = ina219_topology_add(&gs_topology, 0, &path[i], (uint8_t)addr_pin[i], &index);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: topology add failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* select the mux path */
+        res = ina219_topology_select(&gs_topology, index);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: select mux path failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* link interface function */
+        DRIVER_INA219_LINK_INIT(handle, ina219_handle_t);
+        DRIVER_INA219_LINK_IIC_INIT(handle, ina219_interface_iic_init);
+        DRIVER_INA219_LINK_IIC_DEINIT(handle, ina219_interface_iic_deinit);
+        DRIVER_INA219_LINK_IIC_READ(handle, ina219_interface_iic_read);
+        DRIVER_INA219_LINK_IIC_WRITE(handle, ina219_interface_iic_write);
+        DRIVER_INA219_LINK_DELAY_MS(handle, ina219_interface_delay_ms);
+        DRIVER_INA219_LINK_DEBUG_PRINT(handle, ina219_interface_debug_print);
+        
+        /* set addr pin */
+        res = ina219_set_addr_pin(handle, addr_pin[i]);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set addr pin failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* set the r */
+        res = ina219_set_resistance(handle, r);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set resistance failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* init */
+        res = ina219_init(handle);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: init failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        gs_num++;
+        
+        /* set bus voltage range */
+        res = ina219_set_bus_voltage_range(handle, INA219_MUX_DEFAULT_BUS_VOLTAGE_RANGE);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set bus voltage range failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* set bus voltage adc mode */
+        res = ina219_set_bus_voltage_adc_mode(handle, mode);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set bus voltage adc mode failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* set shunt voltage adc mode */
+        res = ina219_set_shunt_voltage_adc_mode(handle, mode);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set shunt voltage adc mode failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* set shunt bus voltage continuous */
+        res = ina219_set_mode(handle, INA219_MODE_SHUNT_BUS_VOLTAGE_CONTINUOUS);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set mode failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* set pga */
+        res = ina219_set_pga(handle, INA219_MUX_DEFAULT_PGA);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set pga failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* calculate calibration */
+        res = ina219_calculate_calibration(handle, (uint16_t *)&calibration);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: calculate calibration failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+        
+        /* set calibration */
+        res = ina219_set_calibration(handle, calibration);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set calibration failed.\n");
+            (void)ina219_mux_deinit();
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      mux example read all the devices once
+ * @param[out] *sample pointer to a raw sample array with one sample for each device
+ * @param[out] *switch_num pointer to a mux write number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the devices are read grouped by mux channel, switch_num is the mux writes of the sweep
+ */
+uint8_t ina219_mux_sweep(ina219_sample_t *sample, uint32_t *switch_num)
+{
+    uint8_t res;
+    uint16_t fail_num;
+    uint32_t start;
+    uint32_t end;
+    
+    /* sweep all the devices */
+    gs_sample = sample;
+    (void)ina219_topology_get_switches(&gs_topology, &start);
+    res = ina219_topology_sweep(&gs_topology, a_ina219_mux_read, &fail_num);
+    (void)ina219_topology_get_switches(&gs_topology, &end);
+    *switch_num = end - start;
+    if ((res != 0) || (fail_num != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      mux example get the convert context of a device
+ * @param[in]  index device index
+ * @param[out] *convert pointer to an ina219 convert structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get convert failed
+ * @note       all the devices share the same calibration
+ */
+uint8_t ina219_mux_get_convert(uint16_t index, ina219_convert_t *convert)
+{
+    if (index >= gs_num)
+    {
+        return 1;
+    }
+    
+    /* init the convert context */
+    if (ina219_convert_init(&gs_handle[index], convert) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  mux example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ina219_mux_deinit(void)
+{
+    uint8_t res = 0;
+    uint16_t i;
+    
+    for (i = 0; i < gs_num; i++)
+    {
+        /* the conf write goes through the mux */
+        if ((ina219_topology_select(&gs_topology, i) != 0) || (ina219_deinit(&gs_handle[i]) != 0))
+        {
+            res = 1;
+        }
+    }
+    gs_num = 0;
+    
+    return res;
+}
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_mux.h
+ * @brief     driver ina219 mux header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef DRIVER_INA219_MUX_H
+#define DRIVER_INA219_MUX_H
+
+#include "driver_ina219_interface.h"
+#include "driver_ina219_convert.h"
+#include "driver_ina219_topology.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ina219_example_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 mux example default definition
+ */
+#define INA219_MUX_DEFAULT_BUS_VOLTAGE_RANGE            INA219_BUS_VOLTAGE_RANGE_32V             /**< set bus voltage range 32V */
+#define INA219_MUX_DEFAULT_PGA                          INA219_PGA_320_MV                        /**< set pga 320 mV */
+
+/**
+ * @brief     mux example init
+ * @param[in] *path pointer to a mux path list
+ * @param[in] *addr_pin pointer to an iic address pin list
+ * @param[in] num device number
+ * @param[in] r reference resistor value
+ * @param[in] mode shunt and bus voltage adc mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      num <= INA219_TOPOLOGY_MAX_DEVICE, the muxes are tca9548a like switches on the
+ *            adapter of the interface, all the devices run continuously
+ */
+uint8_t ina219_mux_init(const ina219_topology_path_t *path, const ina219_address_t *addr_pin, uint16_t num,
+                        double r, ina219_adc_mode_t mode);
+
+/**
+ * @brief      mux example read all the devices once
+ * @param[out] *sample pointer to a raw sample array with one sample for each device
+ * @param[out] *switch_num pointer to a mux write number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the devices are read grouped by mux channel, switch_num is the mux writes of the sweep
+ */
+uint8_t ina219_mux_sweep(ina219_sample_t *sample, uint32_t *switch_num);
+
+/**
+ * @brief      mux example get the convert context of a device
+ * @param[in]  index device index
+ * @param[out] *convert pointer to an ina219 convert structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get convert failed
+ * @note       all the devices share the same calibration
+ */
+uint8_t ina219_mux_get_convert(uint16_t index, ina219_convert_t *convert);
+
+/**
+ * @brief  mux example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ina219_mux_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -37,6 +37,7 @@
 #include "driver_ina219_shot.h"
 
 static ina219_handle_t gs_handle;        /**< ina219 handle */
+static ina219_duty_t gs_duty;            /**< ina219 duty cycle */
 
 /**
  * @brief     shot example init
@@ -198,6 +199,93 @@ uint8_t ina219_shot_read(float *mV, float *mA, float *mW)
     return 0;
 }
 
+/**
+ * @brief     shot example init the power down duty cycle
+ * @param[in] idle idle mode
+ * @param[in] supply_mv supply voltage in mV
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the chip stays in the idle mode between the duty reads
+ */
+uint8_t ina219_shot_duty_init(ina219_mode_t idle, uint16_t supply_mv, uint64_t (*timestamp)(void))
+{
+    uint8_t res;
+    
+    /* cache the triggered and the idle conf */
+    res = ina219_duty_init(&gs_duty, &gs_handle, INA219_MODE_SHUNT_BUS_VOLTAGE_TRIGGERED, idle, supply_mv, timestamp);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: duty init failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      shot example wake the chip, read one conversion and put it back in the idle mode
+ * @param[out] *mV pointer to a mV buffer
+ * @param[out] *mA pointer to a mA buffer
+ * @param[out] *mW pointer to a mW buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ina219_shot_duty_read(float *mV, float *mA, float *mW)
+{
+    uint8_t res;
+    float shunt;
+    ina219_sample_t sample;
+    ina219_convert_t convert;
+    ina219_batch_raw_t raw = {&sample.shunt_voltage, &sample.bus_voltage, &sample.current, &sample.power};
+    ina219_batch_float_t out = {&shunt, mV, mA, mW};
+    
+    /* read one conversion */
+    res = ina219_duty_read(&gs_duty, &sample);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* convert */
+    res = ina219_convert_init(&gs_handle, &convert);
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = ina219_convert_batch(&convert, &raw, &out, 1);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      shot example get the estimated energy of the last duty read
+ * @param[out] *active_us pointer to an active time buffer in us
+ * @param[out] *idle_us pointer to an idle time buffer in us
+ * @param[out] *nj pointer to an energy buffer in nJ
+ * @return     status code
+ *             - 0 success
+ *             - 1 get energy failed
+ * @note       the idle time is the time before the last wake
+ */
+uint8_t ina219_shot_duty_get_energy(uint32_t *active_us, uint64_t *idle_us, uint64_t *nj)
+{
+    if (ina219_duty_get_energy(&gs_duty, active_us, idle_us, nj) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief  shot example deinit
  * @return status code
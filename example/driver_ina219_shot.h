@@ -38,6 +38,8 @@
 #define DRIVER_INA219_SHOT_H
 
 #include "driver_ina219_interface.h"
+#include "driver_ina219_convert.h"
+#include "driver_ina219_duty.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -55,6 +57,7 @@ extern "C"{
 #define INA219_SHOT_DEFAULT_BUS_VOLTAGE_ADC_MODE         INA219_ADC_MODE_12_BIT_1_SAMPLES         /**< set bus voltage adc mode 12 bit 1 sample */
 #define INA219_SHOT_DEFAULT_SHUNT_VOLTAGE_ADC_MODE       INA219_ADC_MODE_12_BIT_1_SAMPLES         /**< set shunt voltage adc mode 12 bit 1 sample */
 #define INA219_SHOT_DEFAULT_PGA                          INA219_PGA_320_MV                        /**< set pga 320 mV */
+#define INA219_SHOT_DEFAULT_SUPPLY_VOLTAGE               3300                                     /**< set supply voltage 3300 mV */
 
 /**
  * @brief     shot example init
@@ -88,6 +91,42 @@ uint8_t ina219_shot_deinit(void);
  */
 uint8_t ina219_shot_read(float *mV, float *mA, float *mW);
 
+/**
+ * @brief     shot example init the power down duty cycle
+ * @param[in] idle idle mode
+ * @param[in] supply_mv supply voltage in mV
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the chip stays in the idle mode between the duty reads
+ */
+uint8_t ina219_shot_duty_init(ina219_mode_t idle, uint16_t supply_mv, uint64_t (*timestamp)(void));
+
+/**
+ * @brief      shot example wake the chip, read one conversion and put it back in the idle mode
+ * @param[out] *mV pointer to a mV buffer
+ * @param[out] *mA pointer to a mA buffer
+ * @param[out] *mW pointer to a mW buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ina219_shot_duty_read(float *mV, float *mA, float *mW);
+
+/**
+ * @brief      shot example get the estimated energy of the last duty read
+ * @param[out] *active_us pointer to an active time buffer in us
+ * @param[out] *idle_us pointer to an idle time buffer in us
+ * @param[out] *nj pointer to an energy buffer in nJ
+ * @return     status code
+ *             - 0 success
+ *             - 1 get energy failed
+ * @note       the idle time is the time before the last wake
+ */
+uint8_t ina219_shot_duty_get_energy(uint32_t *active_us, uint64_t *idle_us, uint64_t *nj);
+
 /**
  * @}
  */
@@ -0,0 +1,465 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_stream.c
+ * @brief     driver ina219 stream source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "driver_ina219_stream.h"
+
+static ina219_handle_t gs_handle[INA219_STREAM_MAX_CHANNEL];        /**< ina219 handles */
+static uint8_t gs_num;                                             /**< inited channel number */
+static ina219_group_t gs_group;                                    /**< trigger group */
+static ina219_single_t gs_single[INA219_STREAM_MAX_CHANNEL];       /**< single channel streams */
+
+/**
+ * @brief     stream example init
+ * @param[in] *addr_pin pointer to an iic address pin list
+ * @param[in] num channel number
+ * @param[in] r reference resistor value
+ * @param[in] mode shunt and bus voltage adc mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      num <= INA219_STREAM_MAX_CHANNEL, all the channels run continuously
+ */
+uint8_t ina219_stream_init(const ina219_address_t *addr_pin, uint8_t num, double r, ina219_adc_mode_t mode)
+{
+    uint8_t res;
+    uint8_t i;
+    uint16_t calibration;
+    
+    if ((num == 0) || (num > INA219_STREAM_MAX_CHANNEL))
+    {
+        ina219_interface_debug_print("ina219: channel number is invalid.\n");
+        
+        return 1;
+    }
+    
+    gs_num = 0;
+    for (i = 0; i < num; i++)
+    {
+        ina219_handle_t *handle = &gs_handle[i];
+        
+        /* link interface function */
+        DRIVER_INA219_LINK_INIT(handle, ina219_handle_t);
+        DRIVER_INA219_LINK_IIC_INIT(handle, ina219_interface_iic_init);
+        DRIVER_INA219_LINK_IIC_DEINIT(handle, ina219_interface_iic_deinit);
+        DRIVER_INA219_LINK_IIC_READ(handle, ina219_interface_iic_read);
+        DRIVER_INA219_LINK_IIC_WRITE(handle, ina219_interface_iic_write);
+        DRIVER_INA219_LINK_DELAY_MS(handle, ina219_interface_delay_ms);
+        DRIVER_INA219_LINK_DEBUG_PRINT(handle, ina219_interface_debug_print);
+        
+        /* set addr pin */
+        res = ina219_set_addr_pin(handle, addr_pin[i]);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set addr pin failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        
+        /* set the r */
+        res = ina219_set_resistance(handle, r);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set resistance failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        
+        /* init */
+        res = ina219_init(handle);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: init failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        gs_num++;
+        
+        /* set bus voltage range */
+        res = ina219_set_bus_voltage_range(handle, INA219_STREAM_DEFAULT_BUS_VOLTAGE_RANGE);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set bus voltage range failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        
+        /* set bus voltage adc mode */
+        res = ina219_set_bus_voltage_adc_mode(handle, mode);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set bus voltage adc mode failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        
+        /* set shunt voltage adc mode */
+        res = ina219_set_shunt_voltage_adc_mode(handle, mode);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set shunt voltage adc mode failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        
+        /* set shunt bus voltage continuous */
+        res = ina219_set_mode(handle, INA219_MODE_SHUNT_BUS_VOLTAGE_CONTINUOUS);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set mode failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        
+        /* set pga */
+        res = ina219_set_pga(handle, INA219_STREAM_DEFAULT_PGA);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set pga failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        
+        /* calculate calibration */
+        res = ina219_calculate_calibration(handle, (uint16_t *)&calibration);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: calculate calibration failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        
+        /* set calibration */
+        res = ina219_set_calibration(handle, calibration);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set calibration failed.\n");
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example read the raw registers of a channel
+ * @param[in]  index channel index
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ina219_stream_read_sample(uint8_t index, ina219_sample_t *sample)
+{
+    if (index >= gs_num)
+    {
+        return 1;
+    }
+    
+    /* read sample */
+    if (ina219_read_sample(&gs_handle[index], sample) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get the convert context of a channel
+ * @param[in]  index channel index
+ * @param[out] *convert pointer to an ina219 convert structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get convert failed
+ * @note       all the channels share the same calibration
+ */
+uint8_t ina219_stream_get_convert(uint8_t index, ina219_convert_t *convert)
+{
+    if (index >= gs_num)
+    {
+        return 1;
+    }
+    
+    /* init the convert context */
+    if (ina219_convert_init(&gs_handle[index], convert) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stream example set the adc mode of a channel
+ * @param[in] index channel index
+ * @param[in] mode shunt and bus voltage adc mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set adc mode failed
+ * @note      the conversion restarts
+ */
+uint8_t ina219_stream_set_adc_mode(uint8_t index, ina219_adc_mode_t mode)
+{
+    if (index >= gs_num)
+    {
+        return 1;
+    }
+    
+    /* set bus voltage adc mode */
+    if (ina219_set_bus_voltage_adc_mode(&gs_handle[index], mode) != 0)
+    {
+        return 1;
+    }
+    
+    /* set shunt voltage adc mode */
+    if (ina219_set_shunt_voltage_adc_mode(&gs_handle[index], mode) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get the conf register of a channel
+ * @param[in]  index channel index
+ * @param[out] *conf pointer to a conf register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conf failed
+ * @note       the conf gives the conversion time of the channel
+ */
+uint8_t ina219_stream_get_conf(uint8_t index, uint16_t *conf)
+{
+    if (index >= gs_num)
+    {
+        return 1;
+    }
+    
+    /* read the conf register */
+    if (ina219_get_reg(&gs_handle[index], 0x00, conf) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get the log context of a channel
+ * @param[in]  index channel index
+ * @param[out] *conf pointer to a conf register buffer
+ * @param[out] *calibration pointer to a calibration register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get context failed
+ * @note       the context is stored with each block of the binary log
+ */
+uint8_t ina219_stream_get_context(uint8_t index, uint16_t *conf, uint16_t *calibration)
+{
+    if (index >= gs_num)
+    {
+        return 1;
+    }
+    
+    /* get conf */
+    if (ina219_get_reg(&gs_handle[index], 0x00, conf) != 0)
+    {
+        return 1;
+    }
+    
+    /* get calibration */
+    if (ina219_get_calibration(&gs_handle[index], calibration) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stream example init the group trigger of all the channels
+ * @param[in] mode triggered mode
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the current configuration of each channel is cached with the triggered mode
+ */
+uint8_t ina219_stream_trigger_init(ina219_mode_t mode, uint64_t (*timestamp)(void))
+{
+    uint8_t i;
+    
+    /* group init */
+    if (ina219_group_init(&gs_group, timestamp, ina219_interface_iic_write_batch) != 0)
+    {
+        return 1;
+    }
+    
+    /* add all the channels */
+    for (i = 0; i < gs_num; i++)
+    {
+        if (ina219_group_add(&gs_group, &gs_handle[i], mode) != 0)
+        {
+            ina219_interface_debug_print("ina219: group add failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example trigger all the channels at once and read them
+ * @param[out] *sample pointer to a raw sample array with one sample for each channel
+ * @param[out] *skew_us pointer to a trigger skew buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ina219_stream_trigger_read(ina219_sample_t *sample, uint32_t *skew_us)
+{
+    /* trigger */
+    if (ina219_group_trigger(&gs_group) != 0)
+    {
+        return 1;
+    }
+    
+    /* wait and read */
+    if (ina219_group_read(&gs_group, sample) != 0)
+    {
+        return 1;
+    }
+    
+    /* get the skew */
+    if (ina219_group_get_skew(&gs_group, skew_us) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stream example switch all the channels to a single channel stream
+ * @param[in] channel streamed channel
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      only the register of the channel is read afterwards, the power is unavailable
+ */
+uint8_t ina219_stream_single_init(ina219_single_channel_t channel)
+{
+    uint8_t i;
+    
+    for (i = 0; i < gs_num; i++)
+    {
+        /* set the continuous mode of the channel */
+        if (ina219_single_init(&gs_single[i], &gs_handle[i], channel, ina219_interface_iic_read_cmd) != 0)
+        {
+            ina219_interface_debug_print("ina219: single init failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example read the single channel of a channel
+ * @param[in]  index channel index
+ * @param[out] *sample pointer to a raw sample buffer
+ * @param[out] *field pointer to a valid field mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the current is computed on the host from the shunt voltage
+ */
+uint8_t ina219_stream_single_read(uint8_t index, ina219_sample_t *sample, uint8_t *field)
+{
+    if (index >= gs_num)
+    {
+        return 1;
+    }
+    
+    /* read the register under the pointer */
+    if (ina219_single_read(&gs_single[index], sample, field) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stream example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ina219_stream_deinit(void)
+{
+    uint8_t res = 0;
+    uint8_t i;
+    
+    for (i = 0; i < gs_num; i++)
+    {
+        if (ina219_deinit(&gs_handle[i]) != 0)
+        {
+            res = 1;
+        }
+    }
+    gs_num = 0;
+    
+    return res;
+}
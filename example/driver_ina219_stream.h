@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_stream.h
+ * @brief     driver ina219 stream header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef DRIVER_INA219_STREAM_H
+#define DRIVER_INA219_STREAM_H
+
+#include "driver_ina219_interface.h"
+#include "driver_ina219_convert.h"
+#include "driver_ina219_group.h"
+#include "driver_ina219_single.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ina219_example_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 stream example max channel definition
+ */
+#ifndef INA219_STREAM_MAX_CHANNEL
+    #define INA219_STREAM_MAX_CHANNEL 16        /**< 16 channels */
+#endif
+
+/**
+ * @brief ina219 stream example default definition
+ */
+#define INA219_STREAM_DEFAULT_BUS_VOLTAGE_RANGE            INA219_BUS_VOLTAGE_RANGE_32V             /**< set bus voltage range 32V */
+#define INA219_STREAM_DEFAULT_PGA                          INA219_PGA_320_MV                        /**< set pga 320 mV */
+
+/**
+ * @brief     stream example init
+ * @param[in] *addr_pin pointer to an iic address pin list
+ * @param[in] num channel number
+ * @param[in] r reference resistor value
+ * @param[in] mode shunt and bus voltage adc mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      num <= INA219_STREAM_MAX_CHANNEL, all the channels run continuously
+ */
+uint8_t ina219_stream_init(const ina219_address_t *addr_pin, uint8_t num, double r, ina219_adc_mode_t mode);
+
+/**
+ * @brief      stream example read the raw registers of a channel
+ * @param[in]  index channel index
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ina219_stream_read_sample(uint8_t index, ina219_sample_t *sample);
+
+/**
+ * @brief      stream example get the convert context of a channel
+ * @param[in]  index channel index
+ * @param[out] *convert pointer to an ina219 convert structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get convert failed
+ * @note       all the channels share the same calibration
+ */
+uint8_t ina219_stream_get_convert(uint8_t index, ina219_convert_t *convert);
+
+/**
+ * @brief     stream example set the adc mode of a channel
+ * @param[in] index channel index
+ * @param[in] mode shunt and bus voltage adc mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set adc mode failed
+ * @note      the conversion restarts
+ */
+uint8_t ina219_stream_set_adc_mode(uint8_t index, ina219_adc_mode_t mode);
+
+/**
+ * @brief      stream example get the conf register of a channel
+ * @param[in]  index channel index
+ * @param[out] *conf pointer to a conf register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conf failed
+ * @note       the conf gives the conversion time of the channel
+ */
+uint8_t ina219_stream_get_conf(uint8_t index, uint16_t *conf);
+
+/**
+ * @brief      stream example get the log context of a channel
+ * @param[in]  index channel index
+ * @param[out] *conf pointer to a conf register buffer
+ * @param[out] *calibration pointer to a calibration register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get context failed
+ * @note       the context is stored with each block of the binary log
+ */
+uint8_t ina219_stream_get_context(uint8_t index, uint16_t *conf, uint16_t *calibration);
+
+/**
+ * @brief     stream example init the group trigger of all the channels
+ * @param[in] mode triggered mode
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the current configuration of each channel is cached with the triggered mode
+ */
+uint8_t ina219_stream_trigger_init(ina219_mode_t mode, uint64_t (*timestamp)(void));
+
+/**
+ * @brief      stream example trigger all the channels at once and read them
+ * @param[out] *sample pointer to a raw sample array with one sample for each channel
+ * @param[out] *skew_us pointer to a trigger skew buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ina219_stream_trigger_read(ina219_sample_t *sample, uint32_t *skew_us);
+
+/**
+ * @brief     stream example switch all the channels to a single channel stream
+ * @param[in] channel streamed channel
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      only the register of the channel is read afterwards, the power is unavailable
+ */
+uint8_t ina219_stream_single_init(ina219_single_channel_t channel);
+
+/**
+ * @brief      stream example read the single channel of a channel
+ * @param[in]  index channel index
+ * @param[out] *sample pointer to a raw sample buffer
+ * @param[out] *field pointer to a valid field mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the current is computed on the host from the shunt voltage
+ */
+uint8_t ina219_stream_single_read(uint8_t index, ina219_sample_t *sample, uint8_t *field);
+
+/**
+ * @brief  stream example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t ina219_stream_deinit(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
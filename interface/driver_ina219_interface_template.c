@@ -76,6 +76,22 @@ uint8_t ina219_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint1
     return 0;
 }
 
+/**
+ * @brief      interface iic bus read without the register pointer write
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address the pointer was left on
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the bus only sends the read, reg is used by the routes that replay a full read
+ */
+uint8_t ina219_interface_iic_read_cmd(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
 /**
  * @brief     interface iic bus write
  * @param[in] addr iic device write address
@@ -92,6 +108,37 @@ uint8_t ina219_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return 0;
 }
 
+/**
+ * @brief     interface iic bus write without a register address
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      used for the control register of an iic mux
+ */
+uint8_t ina219_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write to several devices
+ * @param[in] *addr pointer to a device write address list
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer, 2 bytes for each device
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      when the bus allows, all the writes are sent in one transfer
+ */
+uint8_t ina219_interface_iic_write_batch(const uint8_t *addr, uint8_t reg, uint8_t *buf, uint8_t num)
+{
+    return 0;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
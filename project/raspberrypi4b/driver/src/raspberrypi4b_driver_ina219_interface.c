@@ -36,6 +36,9 @@
 
 #include "driver_ina219_interface.h"
 #include "iic.h"
+#include "iic_arbiter.h"
+#include "driver_ina219_trace.h"
+#include "driver_ina219_sim.h"
 #include <stdarg.h>
 
 /**
@@ -47,17 +50,45 @@
  * @brief iic device handle definition
  */
 static int gs_fd;                           /**< iic handle */
+static uint32_t gs_ref;                     /**< iic handle users */
 
 /**
  * @brief  interface iic bus init
  * @return status code
  *         - 0 success
  *         - 1 iic init failed
- * @note   none
+ * @note   several handles share one opened bus
  */
 uint8_t ina219_interface_iic_init(void)
 {
-    return iic_init(IIC_DEVICE_NAME, &gs_fd);
+    /* a replay needs no bus */
+    if (ina219_trace_is_active() == 2)
+    {
+        return 0;
+    }
+    
+    /* the simulator needs no bus */
+    if (ina219_sim_is_active() != 0)
+    {
+        return 0;
+    }
+    
+    /* the bus is already opened */
+    if (gs_ref != 0)
+    {
+        gs_ref++;
+        
+        return 0;
+    }
+    
+    /* open the bus */
+    if (iic_init(IIC_DEVICE_NAME, &gs_fd) != 0)
+    {
+        return 1;
+    }
+    gs_ref = 1;
+    
+    return 0;
 }
 
 /**
@@ -65,10 +96,31 @@ uint8_t ina219_interface_iic_init(void)
  * @return status code
  *         - 0 success
  *         - 1 iic deinit failed
- * @note   none
+ * @note   the bus is closed by the last user
  */
 uint8_t ina219_interface_iic_deinit(void)
 {
+    /* a replay needs no bus */
+    if (ina219_trace_is_active() == 2)
+    {
+        return 0;
+    }
+    
+    /* the simulator needs no bus */
+    if (ina219_sim_is_active() != 0)
+    {
+        return 0;
+    }
+    
+    /* other handles still use the bus */
+    if (gs_ref > 1)
+    {
+        gs_ref--;
+        
+        return 0;
+    }
+    gs_ref = 0;
+    
     return iic_deinit(gs_fd);
 }
 
@@ -85,9 +137,50 @@ uint8_t ina219_interface_iic_deinit(void)
  */
 uint8_t ina219_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
 {
+    /* route through the trace */
+    if (ina219_trace_is_active() != 0)
+    {
+        return ina219_trace_iic_read(addr, reg, buf, len);
+    }
+    
+    /* route to the simulator */
+    if (ina219_sim_is_active() != 0)
+    {
+        return ina219_sim_iic_read(addr, reg, buf, len);
+    }
+    
+    /* share the bus with the other processes */
+    if (iic_arbiter_is_enabled() != 0)
+    {
+        return iic_arbiter_read(gs_fd, addr, reg, buf, len);
+    }
+    
     return iic_read(gs_fd, addr, reg, buf, len);
 }
 
+/**
+ * @brief      interface iic bus read without the register pointer write
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address the pointer was left on
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the bus only sends the read, reg is used by the routes that replay a full read
+ */
+uint8_t ina219_interface_iic_read_cmd(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    /* the trace, the simulator and the arbiter see full reads */
+    if ((ina219_trace_is_active() != 0) || (ina219_sim_is_active() != 0) ||
+        (iic_arbiter_is_enabled() != 0))
+    {
+        return ina219_interface_iic_read(addr, reg, buf, len);
+    }
+    
+    return iic_read_cmd(gs_fd, addr, buf, len);
+}
+
 /**
  * @brief     interface iic bus write
  * @param[in] addr iic device write address
@@ -101,9 +194,94 @@ uint8_t ina219_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint1
  */
 uint8_t ina219_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
 {
+    /* route through the trace */
+    if (ina219_trace_is_active() != 0)
+    {
+        return ina219_trace_iic_write(addr, reg, buf, len);
+    }
+    
+    /* route to the simulator */
+    if (ina219_sim_is_active() != 0)
+    {
+        return ina219_sim_iic_write(addr, reg, buf, len);
+    }
+    
+    /* share the bus with the other processes */
+    if (iic_arbiter_is_enabled() != 0)
+    {
+        return iic_arbiter_write(gs_fd, addr, reg, buf, len);
+    }
+    
     return iic_write(gs_fd, addr, reg, buf, len);
 }
 
+/**
+ * @brief     interface iic bus write without a register address
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      used for the control register of an iic mux, the trace does not record it,
+ *            a replay has no mux and the shared bus can not keep a mux selected between processes
+ */
+uint8_t ina219_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    /* a replay has no mux */
+    if (ina219_trace_is_active() == 2)
+    {
+        return 0;
+    }
+    
+    /* route to the simulator */
+    if (ina219_sim_is_active() != 0)
+    {
+        return ina219_sim_iic_write_cmd(addr, buf, len);
+    }
+    
+    /* the other processes would switch the mux */
+    if (iic_arbiter_is_enabled() != 0)
+    {
+        return 1;
+    }
+    
+    return iic_write_cmd(gs_fd, addr, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write to several devices
+ * @param[in] *addr pointer to a device write address list
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer, 2 bytes for each device
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      when the bus allows, all the writes are sent in one transfer
+ */
+uint8_t ina219_interface_iic_write_batch(const uint8_t *addr, uint8_t reg, uint8_t *buf, uint8_t num)
+{
+    uint8_t i;
+    
+    /* the trace, the simulator and the arbiter see single writes */
+    if ((ina219_trace_is_active() != 0) || (ina219_sim_is_active() != 0) ||
+        (iic_arbiter_is_enabled() != 0))
+    {
+        for (i = 0; i < num; i++)
+        {
+            if (ina219_interface_iic_write(addr[i], reg, &buf[i * 2], 2) != 0)
+            {
+                return 1;
+            }
+        }
+        
+        return 0;
+    }
+    
+    return iic_write_batch(gs_fd, addr, reg, buf, 2, num);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -111,6 +289,22 @@ uint8_t ina219_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
  */
 void ina219_interface_delay_ms(uint32_t ms)
 {
+    /* route through the trace */
+    if (ina219_trace_is_active() != 0)
+    {
+        ina219_trace_delay_ms(ms);
+        
+        return;
+    }
+    
+    /* advance the virtual time */
+    if (ina219_sim_is_active() != 0)
+    {
+        ina219_sim_delay_ms(ms);
+        
+        return;
+    }
+    
     usleep(ms * 1000);
 }
 
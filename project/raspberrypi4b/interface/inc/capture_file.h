@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      capture_file.h
+ * @brief     capture file header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef CAPTURE_FILE_H
+#define CAPTURE_FILE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup capture_file capture file function
+ * @brief    capture file function modules
+ * @{
+ */
+
+/**
+ * @brief capture file preallocate size definition
+ */
+#ifndef CAPTURE_FILE_PREALLOCATE_SIZE
+    #define CAPTURE_FILE_PREALLOCATE_SIZE (1024 * 1024)        /**< 1MB */
+#endif
+
+/**
+ * @brief     open a capture file
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] size size of each of the two write buffers
+ * @param[in] sync_ms max time in ms between two syncs
+ * @param[in] sync_bytes max bytes between two syncs
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the file is truncated, the data is written by a background thread
+ *            and synced when either budget is used up
+ */
+uint8_t capture_file_open(char *name, uint32_t size, uint32_t sync_ms, uint32_t sync_bytes);
+
+/**
+ * @brief     append data to the capture file
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      len <= size, a call is never split between two writes of the thread,
+ *            it only blocks when both buffers are full
+ */
+uint8_t capture_file_write(const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      close the capture file
+ * @param[out] *len pointer to a written length buffer
+ * @param[out] *sync_num pointer to a sync number buffer
+ * @param[out] *stall_num pointer to a stall number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 close failed
+ * @note       all the data is written and synced, the unused preallocated space is released
+ */
+uint8_t capture_file_close(uint64_t *len, uint32_t *sync_num, uint32_t *stall_num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -142,6 +142,22 @@ uint8_t iic_write_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len);
  */
 uint8_t iic_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief     iic bus write to several devices in one transfer
+ * @param[in] fd iic handle
+ * @param[in] *addr pointer to a device write address list
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer, len bytes for each device
+ * @param[in] len length of the data of one device
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      addr = device_address_7bits << 1,
+ *            the messages are joined by repeated starts so no other transfer runs between them
+ */
+uint8_t iic_write_batch(int fd, const uint8_t *addr, uint8_t reg, uint8_t *buf, uint16_t len, uint8_t num);
+
 /**
  * @brief     iic bus write with 16 bits register address
  * @param[in] fd iic handle
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_arbiter.h
+ * @brief     iic arbiter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef IIC_ARBITER_H
+#define IIC_ARBITER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup iic_arbiter iic arbiter function
+ * @brief    iic arbiter function modules
+ * @{
+ */
+
+/**
+ * @brief iic arbiter size definition
+ */
+#define IIC_ARBITER_MAX_ENTRY    64        /**< shared results per bus */
+#define IIC_ARBITER_DATA_SIZE    4         /**< max merged read length */
+
+/**
+ * @brief     enable the arbitration
+ * @param[in] window_us freshness window in us
+ * @note      the shared table of a bus is attached on its first transaction,
+ *            0 arbitrates the bus without merging any read
+ */
+void iic_arbiter_enable(uint32_t window_us);
+
+/**
+ * @brief  check the arbitration
+ * @return 1 if enabled, 0 if not
+ * @note   none
+ */
+uint8_t iic_arbiter_is_enabled(void);
+
+/**
+ * @brief      arbitrated iic bus read
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a read of the same register completed by any process in the window
+ *             before this call is returned without a bus transaction
+ */
+uint8_t iic_arbiter_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     arbitrated iic bus write
+ * @param[in] fd iic handle
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a write always reaches the bus and drops the shared results of the device
+ */
+uint8_t iic_arbiter_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      get the arbitration status of this process
+ * @param[out] *bus_num pointer to a bus transaction number buffer
+ * @param[out] *merged_num pointer to a merged read number buffer
+ * @note       none
+ */
+void iic_arbiter_get_status(uint32_t *bus_num, uint32_t *merged_num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_scan.h
+ * @brief     iic scan header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef IIC_SCAN_H
+#define IIC_SCAN_H
+
+#include "driver_ina219_scan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup iic_scan iic scan function
+ * @brief    iic scan function modules
+ * @{
+ */
+
+/**
+ * @brief iic scan max bus definition
+ */
+#define IIC_SCAN_MAX_BUS    8        /**< max adapters of one scan */
+
+/**
+ * @brief iic scan result structure definition
+ */
+typedef struct iic_scan_result_s
+{
+    uint8_t bus;                               /**< adapter number */
+    uint8_t res;                               /**< scan status */
+    uint8_t num;                               /**< found device number */
+    ina219_scan_device_t device[16];           /**< found devices */
+    uint32_t time_us;                          /**< scan time in us */
+} iic_scan_result_t;
+
+/**
+ * @brief      scan several iic adapters in parallel
+ * @param[in]  *bus pointer to an adapter number list
+ * @param[in]  num adapter number
+ * @param[out] *result pointer to a result array with num items
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ * @note       each adapter /dev/i2c-<n> is opened and probed by its own thread,
+ *             the result of an adapter that can't be opened has res 1
+ */
+uint8_t iic_scan_run(const uint8_t *bus, uint8_t num, iic_scan_result_t *result);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      metrics_server.h
+ * @brief     metrics server header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef METRICS_SERVER_H
+#define METRICS_SERVER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup metrics_server metrics server function
+ * @brief    metrics server function modules
+ * @{
+ */
+
+/**
+ * @brief metrics server size definition
+ */
+#ifndef METRICS_SERVER_MAX_DEVICE
+    #define METRICS_SERVER_MAX_DEVICE 16        /**< 16 devices */
+#endif
+#ifndef METRICS_SERVER_MAX_CLIENT
+    #define METRICS_SERVER_MAX_CLIENT 64        /**< 64 clients */
+#endif
+
+/**
+ * @brief metrics server binary format definition
+ */
+#define METRICS_SERVER_BINARY_HEADER_SIZE    8         /**< "INAM", u16 version, u16 entry number */
+#define METRICS_SERVER_BINARY_ENTRY_SIZE     32        /**< address, 3 reserved, u64 timestamp, 3 x i32 values, i64 power */
+
+/**
+ * @brief metrics server entry structure definition
+ */
+typedef struct metrics_server_entry_s
+{
+    uint8_t address;              /**< 7 bit iic address */
+    uint64_t timestamp;           /**< timestamp in us */
+    int32_t shunt_voltage;        /**< shunt voltage in uV */
+    int32_t bus_voltage;          /**< bus voltage in mV */
+    int32_t current;              /**< current in uA */
+    int64_t power;                /**< power in uW */
+} metrics_server_entry_t;
+
+/**
+ * @brief     open the metrics server
+ * @param[in] *path pointer to a unix socket path buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      an old socket file at the path is removed
+ */
+uint8_t metrics_server_open(char *path);
+
+/**
+ * @brief     update the snapshot table
+ * @param[in] *entry pointer to an entry array
+ * @param[in] num entry number
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ * @note      both responses are rendered once here, the clients are served from the cache
+ */
+uint8_t metrics_server_update(const metrics_server_entry_t *entry, uint8_t num);
+
+/**
+ * @brief     serve the clients
+ * @param[in] timeout_ms max waiting time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 poll failed
+ * @note      returns after the first batch of events or the timeout
+ */
+uint8_t metrics_server_poll(uint32_t timeout_ms);
+
+/**
+ * @brief  close the metrics server
+ * @return status code
+ *         - 0 success
+ * @note   the socket file is removed
+ */
+uint8_t metrics_server_close(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      mmap_file.h
+ * @brief     mmap file header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef MMAP_FILE_H
+#define MMAP_FILE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup mmap_file mmap file function
+ * @brief    mmap file function modules
+ * @{
+ */
+
+/**
+ * @brief      map a whole file read only
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] **buf pointer to a file view pointer buffer
+ * @param[out] *len pointer to a file length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 map failed
+ * @note       none
+ */
+uint8_t mmap_file_open(char *name, const uint8_t **buf, uint64_t *len);
+
+/**
+ * @brief      create or open a preallocated file and map it read write
+ * @param[in]  *name pointer to a file name buffer
+ * @param[in]  len file length
+ * @param[out] **buf pointer to a file view pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 map failed
+ * @note       the existing content is kept
+ */
+uint8_t mmap_file_create(char *name, uint64_t len, uint8_t **buf);
+
+/**
+ * @brief     unmap a file
+ * @param[in] *buf pointer to a file view
+ * @param[in] len file length
+ * @return    status code
+ *            - 0 success
+ *            - 1 unmap failed
+ * @note      none
+ */
+uint8_t mmap_file_close(const uint8_t *buf, uint64_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
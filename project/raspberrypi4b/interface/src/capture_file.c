@@ -0,0 +1,422 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      capture_file.c
+ * @brief     capture file source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "capture_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+
+/**
+ * @brief capture file structure definition
+ */
+typedef struct capture_file_s
+{
+    int fd;                           /**< file handle */
+    uint8_t *buf[2];                  /**< write buffers */
+    uint32_t used[2];                 /**< used length of the buffers */
+    uint32_t size;                    /**< buffer size */
+    int active;                       /**< buffer filled by the caller */
+    int pending;                      /**< full buffer waiting for the thread, -1 is none */
+    int stop;                         /**< stop flag */
+    int error;                        /**< error flag */
+    uint64_t offset;                  /**< written length */
+    uint64_t allocated;               /**< preallocated length */
+    uint32_t sync_ms;                 /**< time budget */
+    uint32_t sync_bytes;              /**< byte budget */
+    uint64_t unsynced;                /**< bytes since the last sync */
+    struct timespec last_sync;        /**< time of the last sync */
+    uint32_t sync_num;                /**< sync number */
+    uint32_t stall_num;               /**< stall number */
+    pthread_mutex_t mutex;            /**< buffer mutex */
+    pthread_cond_t ready;             /**< buffer ready condition */
+    pthread_cond_t free;              /**< buffer free condition */
+    pthread_t thread;                 /**< writer thread */
+} capture_file_t;
+
+/**
+ * @brief capture file
+ */
+static capture_file_t gs_capture;        /**< capture file */
+
+/**
+ * @brief     append a buffer to the file
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      called by the writer thread only
+ */
+static uint8_t a_capture_file_append(const uint8_t *buf, uint32_t len)
+{
+    struct timespec now;
+    uint64_t elapsed;
+    uint32_t pos;
+    
+    /* preallocate the next extents without changing the file size */
+    if ((gs_capture.offset + len) > gs_capture.allocated)
+    {
+        uint64_t grow;
+        
+        grow = ((gs_capture.offset + len - gs_capture.allocated + CAPTURE_FILE_PREALLOCATE_SIZE - 1) /
+                CAPTURE_FILE_PREALLOCATE_SIZE) * CAPTURE_FILE_PREALLOCATE_SIZE;
+        if (fallocate(gs_capture.fd, FALLOC_FL_KEEP_SIZE, (off_t)gs_capture.allocated, (off_t)grow) == 0)
+        {
+            gs_capture.allocated += grow;
+        }
+        else if ((errno == EOPNOTSUPP) || (errno == ENOSYS))
+        {
+            /* the file system can't preallocate, never try again */
+            gs_capture.allocated = UINT64_MAX;
+        }
+        else
+        {
+            perror("capture_file: fallocate failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* write the data */
+    pos = 0;
+    while (pos < len)
+    {
+        ssize_t n;
+        
+        n = write(gs_capture.fd, &buf[pos], len - pos);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("capture_file: write failed.\n");
+            
+            return 1;
+        }
+        pos += (uint32_t)n;
+    }
+    gs_capture.offset += len;
+    gs_capture.unsynced += len;
+    
+    /* sync when a budget is used up */
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    elapsed = (uint64_t)((int64_t)(now.tv_sec - gs_capture.last_sync.tv_sec) * 1000000000LL +
+                         (int64_t)(now.tv_nsec - gs_capture.last_sync.tv_nsec));
+    if ((gs_capture.unsynced >= gs_capture.sync_bytes) || (elapsed >= (uint64_t)gs_capture.sync_ms * 1000000ULL))
+    {
+        if (fdatasync(gs_capture.fd) != 0)
+        {
+            perror("capture_file: sync failed.\n");
+            
+            return 1;
+        }
+        gs_capture.unsynced = 0;
+        gs_capture.last_sync = now;
+        gs_capture.sync_num++;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     writer thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      a full buffer is written at once, a partly filled one is taken
+ *            when the time budget is used up so the loss window stays bounded
+ */
+static void *a_capture_file_thread(void *arg)
+{
+    (void)arg;
+    
+    (void)pthread_mutex_lock(&gs_capture.mutex);
+    while (1)
+    {
+        int index;
+        uint8_t res;
+        
+        /* wait for a full buffer, the time budget or the stop */
+        while ((gs_capture.pending < 0) && (gs_capture.stop == 0))
+        {
+            if (gs_capture.used[gs_capture.active] != 0)
+            {
+                struct timespec deadline;
+                
+                deadline = gs_capture.last_sync;
+                deadline.tv_sec += gs_capture.sync_ms / 1000;
+                deadline.tv_nsec += (long)(gs_capture.sync_ms % 1000) * 1000000L;
+                if (deadline.tv_nsec >= 1000000000L)
+                {
+                    deadline.tv_sec++;
+                    deadline.tv_nsec -= 1000000000L;
+                }
+                if (pthread_cond_timedwait(&gs_capture.ready, &gs_capture.mutex, &deadline) == ETIMEDOUT)
+                {
+                    break;
+                }
+            }
+            else
+            {
+                (void)pthread_cond_wait(&gs_capture.ready, &gs_capture.mutex);
+            }
+        }
+        
+        /* take the active buffer if nothing is full */
+        if (gs_capture.pending < 0)
+        {
+            if (gs_capture.used[gs_capture.active] == 0)
+            {
+                if (gs_capture.stop != 0)
+                {
+                    break;
+                }
+                
+                continue;
+            }
+            gs_capture.pending = gs_capture.active;
+            gs_capture.active ^= 1;
+        }
+        index = gs_capture.pending;
+        (void)pthread_mutex_unlock(&gs_capture.mutex);
+        
+        /* write without the lock */
+        res = a_capture_file_append(gs_capture.buf[index], gs_capture.used[index]);
+        
+        /* release the buffer */
+        (void)pthread_mutex_lock(&gs_capture.mutex);
+        gs_capture.used[index] = 0;
+        gs_capture.pending = -1;
+        if (res != 0)
+        {
+            gs_capture.error = 1;
+        }
+        (void)pthread_cond_broadcast(&gs_capture.free);
+        if (res != 0)
+        {
+            break;
+        }
+    }
+    (void)pthread_mutex_unlock(&gs_capture.mutex);
+    
+    return NULL;
+}
+
+/**
+ * @brief     open a capture file
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] size size of each of the two write buffers
+ * @param[in] sync_ms max time in ms between two syncs
+ * @param[in] sync_bytes max bytes between two syncs
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the file is truncated, the data is written by a background thread
+ *            and synced when either budget is used up
+ */
+uint8_t capture_file_open(char *name, uint32_t size, uint32_t sync_ms, uint32_t sync_bytes)
+{
+    pthread_condattr_t attr;
+    
+    /* open the file */
+    memset(&gs_capture, 0, sizeof(gs_capture));
+    gs_capture.fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (gs_capture.fd < 0)
+    {
+        perror("capture_file: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* malloc the buffers */
+    gs_capture.buf[0] = (uint8_t *)malloc(size);
+    gs_capture.buf[1] = (uint8_t *)malloc(size);
+    if ((gs_capture.buf[0] == NULL) || (gs_capture.buf[1] == NULL))
+    {
+        perror("capture_file: malloc failed.\n");
+        free(gs_capture.buf[0]);
+        free(gs_capture.buf[1]);
+        (void)close(gs_capture.fd);
+        
+        return 1;
+    }
+    gs_capture.size = size;
+    gs_capture.pending = -1;
+    gs_capture.sync_ms = sync_ms;
+    gs_capture.sync_bytes = sync_bytes;
+    (void)clock_gettime(CLOCK_MONOTONIC, &gs_capture.last_sync);
+    
+    /* the budget is measured on the monotonic clock */
+    (void)pthread_mutex_init(&gs_capture.mutex, NULL);
+    (void)pthread_condattr_init(&attr);
+    (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    (void)pthread_cond_init(&gs_capture.ready, &attr);
+    (void)pthread_cond_init(&gs_capture.free, &attr);
+    (void)pthread_condattr_destroy(&attr);
+    
+    /* start the writer thread */
+    if (pthread_create(&gs_capture.thread, NULL, a_capture_file_thread, NULL) != 0)
+    {
+        perror("capture_file: create thread failed.\n");
+        (void)pthread_cond_destroy(&gs_capture.ready);
+        (void)pthread_cond_destroy(&gs_capture.free);
+        (void)pthread_mutex_destroy(&gs_capture.mutex);
+        free(gs_capture.buf[0]);
+        free(gs_capture.buf[1]);
+        (void)close(gs_capture.fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     append data to the capture file
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      len <= size, a call is never split between two writes of the thread,
+ *            it only blocks when both buffers are full
+ */
+uint8_t capture_file_write(const uint8_t *buf, uint32_t len)
+{
+    (void)pthread_mutex_lock(&gs_capture.mutex);
+    if ((gs_capture.error != 0) || (len > gs_capture.size))
+    {
+        (void)pthread_mutex_unlock(&gs_capture.mutex);
+        
+        return 1;
+    }
+    
+    /* hand the full buffer to the thread */
+    if ((gs_capture.used[gs_capture.active] + len) > gs_capture.size)
+    {
+        if (gs_capture.pending >= 0)
+        {
+            gs_capture.stall_num++;
+            while ((gs_capture.pending >= 0) && (gs_capture.error == 0))
+            {
+                (void)pthread_cond_wait(&gs_capture.free, &gs_capture.mutex);
+            }
+            if (gs_capture.error != 0)
+            {
+                (void)pthread_mutex_unlock(&gs_capture.mutex);
+                
+                return 1;
+            }
+        }
+        gs_capture.pending = gs_capture.active;
+        gs_capture.active ^= 1;
+        (void)pthread_cond_signal(&gs_capture.ready);
+    }
+    
+    /* copy the data */
+    memcpy(&gs_capture.buf[gs_capture.active][gs_capture.used[gs_capture.active]], buf, len);
+    gs_capture.used[gs_capture.active] += len;
+    (void)pthread_mutex_unlock(&gs_capture.mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief      close the capture file
+ * @param[out] *len pointer to a written length buffer
+ * @param[out] *sync_num pointer to a sync number buffer
+ * @param[out] *stall_num pointer to a stall number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 close failed
+ * @note       all the data is written and synced, the unused preallocated space is released
+ */
+uint8_t capture_file_close(uint64_t *len, uint32_t *sync_num, uint32_t *stall_num)
+{
+    uint8_t res = 0;
+    
+    /* stop the thread, it drains both buffers */
+    (void)pthread_mutex_lock(&gs_capture.mutex);
+    gs_capture.stop = 1;
+    (void)pthread_cond_signal(&gs_capture.ready);
+    (void)pthread_mutex_unlock(&gs_capture.mutex);
+    (void)pthread_join(gs_capture.thread, NULL);
+    if (gs_capture.error != 0)
+    {
+        res = 1;
+    }
+    
+    /* sync the tail */
+    if ((res == 0) && (gs_capture.unsynced != 0))
+    {
+        if (fdatasync(gs_capture.fd) != 0)
+        {
+            perror("capture_file: sync failed.\n");
+            res = 1;
+        }
+        else
+        {
+            gs_capture.sync_num++;
+        }
+    }
+    
+    /* release the preallocated space after the end */
+    if ((res == 0) && (ftruncate(gs_capture.fd, (off_t)gs_capture.offset) != 0))
+    {
+        perror("capture_file: truncate failed.\n");
+        res = 1;
+    }
+    if (close(gs_capture.fd) != 0)
+    {
+        res = 1;
+    }
+    (void)pthread_cond_destroy(&gs_capture.ready);
+    (void)pthread_cond_destroy(&gs_capture.free);
+    (void)pthread_mutex_destroy(&gs_capture.mutex);
+    free(gs_capture.buf[0]);
+    free(gs_capture.buf[1]);
+    *len = gs_capture.offset;
+    *sync_num = gs_capture.sync_num;
+    *stall_num = gs_capture.stall_num;
+    
+    return res;
+}
@@ -315,6 +315,57 @@ uint8_t iic_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
     return 0;
 }
 
+/**
+ * @brief     iic bus write to several devices in one transfer
+ * @param[in] fd iic handle
+ * @param[in] *addr pointer to a device write address list
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer, len bytes for each device
+ * @param[in] len length of the data of one device
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      addr = device_address_7bits << 1,
+ *            the messages are joined by repeated starts so no other transfer runs between them
+ */
+uint8_t iic_write_batch(int fd, const uint8_t *addr, uint8_t reg, uint8_t *buf, uint16_t len, uint8_t num)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[num];
+    uint8_t buf_send[num][len + 1];
+    uint8_t i;
+    
+    /* clear ioctl data */
+    memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+    
+    /* clear msgs data */
+    memset(msgs, 0, sizeof(struct i2c_msg) * num);
+    
+    /* set the param */
+    for (i = 0; i < num; i++)
+    {
+        msgs[i].addr = addr[i] >> 1;
+        msgs[i].flags = 0;
+        buf_send[i][0] = reg;
+        memcpy(&buf_send[i][1], &buf[i * len], len);
+        msgs[i].buf = buf_send[i];
+        msgs[i].len = len + 1;
+    }
+    i2c_rdwr_data.msgs = msgs;
+    i2c_rdwr_data.nmsgs = num;
+    
+    /* transmit */
+    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    {
+        perror("iic: write batch failed.\n");
+        
+        return 1;
+    }
+     
+    return 0;
+}
+
 /**
  * @brief     iic bus write with 16 bits register address
  * @param[in] fd iic handle
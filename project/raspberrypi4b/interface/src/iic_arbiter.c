@@ -0,0 +1,396 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_arbiter.c
+ * @brief     iic arbiter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "iic_arbiter.h"
+#include "iic.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief iic arbiter entry structure definition
+ */
+typedef struct iic_arbiter_entry_s
+{
+    uint8_t addr;                             /**< iic device write address */
+    uint8_t reg;                              /**< register address */
+    uint8_t len;                              /**< read length */
+    uint8_t valid;                            /**< valid flag */
+    uint8_t data[IIC_ARBITER_DATA_SIZE];      /**< read data */
+    uint64_t time;                            /**< completion time in us */
+} iic_arbiter_entry_t;
+
+/**
+ * @brief iic arbiter table structure definition
+ */
+typedef struct iic_arbiter_table_s
+{
+    iic_arbiter_entry_t entry[IIC_ARBITER_MAX_ENTRY];        /**< shared results */
+} iic_arbiter_table_t;
+
+/**
+ * @brief iic arbiter structure definition
+ */
+typedef struct iic_arbiter_s
+{
+    uint8_t enable;                   /**< enable flag */
+    uint32_t window;                  /**< freshness window in us */
+    int fd;                           /**< attached iic handle, -1 is none */
+    iic_arbiter_table_t *table;       /**< shared table */
+    uint32_t bus_num;                 /**< bus transactions of this process */
+    uint32_t merged_num;              /**< merged reads of this process */
+} iic_arbiter_t;
+
+/**
+ * @brief iic arbiter
+ */
+static iic_arbiter_t gs_arbiter = {0, 0, -1, NULL, 0, 0};        /**< iic arbiter */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   the monotonic clock is shared by all the processes
+ */
+static uint64_t a_iic_arbiter_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     attach the shared table of a bus
+ * @param[in] fd iic handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 attach failed
+ * @note      the table is named after the device node, a zero filled table is empty,
+ *            so the processes need no init handshake
+ */
+static uint8_t a_iic_arbiter_attach(int fd)
+{
+    struct stat st;
+    char name[64];
+    int shm;
+    void *p;
+    
+    if (gs_arbiter.fd == fd)
+    {
+        return 0;
+    }
+    if (gs_arbiter.table != NULL)
+    {
+        (void)munmap(gs_arbiter.table, sizeof(iic_arbiter_table_t));
+        gs_arbiter.table = NULL;
+        gs_arbiter.fd = -1;
+    }
+    
+    /* open the table of this device node */
+    if (fstat(fd, &st) != 0)
+    {
+        return 1;
+    }
+    (void)snprintf(name, sizeof(name), "/ina219-iic-%llx-%llx",
+                   (unsigned long long)st.st_dev, (unsigned long long)st.st_ino);
+    shm = shm_open(name, O_RDWR | O_CREAT, 0666);
+    if (shm < 0)
+    {
+        perror("iic_arbiter: shm_open failed.\n");
+        
+        return 1;
+    }
+    if (ftruncate(shm, sizeof(iic_arbiter_table_t)) != 0)
+    {
+        perror("iic_arbiter: ftruncate failed.\n");
+        (void)close(shm);
+        
+        return 1;
+    }
+    p = mmap(NULL, sizeof(iic_arbiter_table_t), PROT_READ | PROT_WRITE, MAP_SHARED, shm, 0);
+    (void)close(shm);
+    if (p == MAP_FAILED)
+    {
+        perror("iic_arbiter: mmap failed.\n");
+        
+        return 1;
+    }
+    gs_arbiter.table = (iic_arbiter_table_t *)p;
+    gs_arbiter.fd = fd;
+    
+    return 0;
+}
+
+/**
+ * @brief     lock the bus
+ * @param[in] fd iic handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      an advisory lock on the device node, released by the kernel if the holder dies,
+ *            each hold covers one transaction, the waiters are not served in arrival order
+ */
+static uint8_t a_iic_arbiter_lock(int fd)
+{
+    while (flock(fd, LOCK_EX) != 0)
+    {
+        if (errno != EINTR)
+        {
+            perror("iic_arbiter: flock failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     unlock the bus
+ * @param[in] fd iic handle
+ * @note      none
+ */
+static void a_iic_arbiter_unlock(int fd)
+{
+    (void)flock(fd, LOCK_UN);
+}
+
+/**
+ * @brief     find a shared result
+ * @param[in] addr iic device write address
+ * @param[in] reg register address
+ * @param[in] len read length
+ * @return    pointer to an entry, NULL if not found
+ * @note      called with the bus locked
+ */
+static iic_arbiter_entry_t *a_iic_arbiter_find(uint8_t addr, uint8_t reg, uint16_t len)
+{
+    uint32_t i;
+    
+    for (i = 0; i < IIC_ARBITER_MAX_ENTRY; i++)
+    {
+        iic_arbiter_entry_t *e = &gs_arbiter.table->entry[i];
+        
+        if ((e->valid != 0) && (e->addr == addr) && (e->reg == reg) && (e->len == len))
+        {
+            return e;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief  get a free or the oldest entry
+ * @return pointer to an entry
+ * @note   called with the bus locked
+ */
+static iic_arbiter_entry_t *a_iic_arbiter_slot(void)
+{
+    iic_arbiter_entry_t *oldest = &gs_arbiter.table->entry[0];
+    uint32_t i;
+    
+    for (i = 0; i < IIC_ARBITER_MAX_ENTRY; i++)
+    {
+        iic_arbiter_entry_t *e = &gs_arbiter.table->entry[i];
+        
+        if (e->valid == 0)
+        {
+            return e;
+        }
+        if (e->time < oldest->time)
+        {
+            oldest = e;
+        }
+    }
+    
+    return oldest;
+}
+
+/**
+ * @brief     enable the arbitration
+ * @param[in] window_us freshness window in us
+ * @note      the shared table of a bus is attached on its first transaction,
+ *            0 arbitrates the bus without merging any read
+ */
+void iic_arbiter_enable(uint32_t window_us)
+{
+    gs_arbiter.enable = 1;
+    gs_arbiter.window = window_us;
+}
+
+/**
+ * @brief  check the arbitration
+ * @return 1 if enabled, 0 if not
+ * @note   none
+ */
+uint8_t iic_arbiter_is_enabled(void)
+{
+    return gs_arbiter.enable;
+}
+
+/**
+ * @brief      arbitrated iic bus read
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a read of the same register completed by any process in the window
+ *             before this call is returned without a bus transaction
+ */
+uint8_t iic_arbiter_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    iic_arbiter_entry_t *e;
+    uint64_t arrival;
+    uint8_t shared;
+    uint8_t res;
+    
+    /* attach the table, the bus is still locked without it */
+    shared = (uint8_t)((len <= IIC_ARBITER_DATA_SIZE) && (a_iic_arbiter_attach(fd) == 0));
+    
+    /* queue on the bus lock */
+    arrival = a_iic_arbiter_now();
+    if (a_iic_arbiter_lock(fd) != 0)
+    {
+        return 1;
+    }
+    
+    /* read the bus without merging */
+    if (shared == 0)
+    {
+        res = iic_read(fd, addr, reg, buf, len);
+        gs_arbiter.bus_num++;
+        a_iic_arbiter_unlock(fd);
+        
+        return res;
+    }
+    
+    /* merge with a fresh result */
+    e = a_iic_arbiter_find(addr, reg, len);
+    if ((e != NULL) && (gs_arbiter.window != 0) && ((e->time + gs_arbiter.window) >= arrival))
+    {
+        memcpy(buf, e->data, len);
+        gs_arbiter.merged_num++;
+        a_iic_arbiter_unlock(fd);
+        
+        return 0;
+    }
+    
+    /* read the bus and publish the result */
+    res = iic_read(fd, addr, reg, buf, len);
+    gs_arbiter.bus_num++;
+    if (res == 0)
+    {
+        if (e == NULL)
+        {
+            e = a_iic_arbiter_slot();
+        }
+        e->addr = addr;
+        e->reg = reg;
+        e->len = (uint8_t)len;
+        e->valid = 1;
+        memcpy(e->data, buf, len);
+        e->time = a_iic_arbiter_now();
+    }
+    a_iic_arbiter_unlock(fd);
+    
+    return res;
+}
+
+/**
+ * @brief     arbitrated iic bus write
+ * @param[in] fd iic handle
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a write always reaches the bus and drops the shared results of the device
+ */
+uint8_t iic_arbiter_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t shared;
+    uint8_t res;
+    uint32_t i;
+    
+    /* attach the table, the bus is still locked without it */
+    shared = (uint8_t)(a_iic_arbiter_attach(fd) == 0);
+    
+    /* write under the bus lock */
+    if (a_iic_arbiter_lock(fd) != 0)
+    {
+        return 1;
+    }
+    res = iic_write(fd, addr, reg, buf, len);
+    gs_arbiter.bus_num++;
+    
+    /* the config or calibration may change every register */
+    for (i = 0; (i < IIC_ARBITER_MAX_ENTRY) && (shared != 0); i++)
+    {
+        if (gs_arbiter.table->entry[i].addr == addr)
+        {
+            gs_arbiter.table->entry[i].valid = 0;
+        }
+    }
+    a_iic_arbiter_unlock(fd);
+    
+    return res;
+}
+
+/**
+ * @brief      get the arbitration status of this process
+ * @param[out] *bus_num pointer to a bus transaction number buffer
+ * @param[out] *merged_num pointer to a merged read number buffer
+ * @note       none
+ */
+void iic_arbiter_get_status(uint32_t *bus_num, uint32_t *merged_num)
+{
+    *bus_num = gs_arbiter.bus_num;
+    *merged_num = gs_arbiter.merged_num;
+}
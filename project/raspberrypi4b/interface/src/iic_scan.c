@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_scan.c
+ * @brief     iic scan source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "iic_scan.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+static __thread char gs_name[32];         /**< adapter device name of the thread */
+static __thread int gs_fd = -1;           /**< adapter handle of the thread */
+
+/**
+ * @brief  open the adapter of the thread
+ * @return status code
+ *         - 0 success
+ *         - 1 open failed
+ * @note   none
+ */
+static uint8_t a_iic_scan_init(void)
+{
+    gs_fd = open(gs_name, O_RDWR);
+    if (gs_fd < 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  close the adapter of the thread
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_iic_scan_deinit(void)
+{
+    if (gs_fd >= 0)
+    {
+        (void)close(gs_fd);
+        gs_fd = -1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      read a register without reporting a missing ack
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       an empty address is the normal case of a scan, so nothing is printed
+ */
+static uint8_t a_iic_scan_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    struct i2c_rdwr_ioctl_data data;
+    struct i2c_msg msgs[2];
+    
+    /* pointer write and read in one transaction */
+    memset(msgs, 0, sizeof(struct i2c_msg) * 2);
+    msgs[0].addr = addr >> 1;
+    msgs[0].flags = 0;
+    msgs[0].buf = &reg;
+    msgs[0].len = 1;
+    msgs[1].addr = addr >> 1;
+    msgs[1].flags = I2C_M_RD;
+    msgs[1].buf = buf;
+    msgs[1].len = len;
+    data.msgs = msgs;
+    data.nmsgs = 2;
+    if (ioctl(gs_fd, I2C_RDWR, &data) < 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     scan never writes
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_iic_scan_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    (void)len;
+    
+    return 1;
+}
+
+/**
+ * @brief     delay
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_iic_scan_delay_ms(uint32_t ms)
+{
+    (void)usleep(1000 * ms);
+}
+
+/**
+ * @brief     print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_iic_scan_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     scan thread
+ * @param[in] *arg pointer to a result structure
+ * @return    NULL
+ * @note      none
+ */
+static void *a_iic_scan_thread(void *arg)
+{
+    iic_scan_result_t *result = (iic_scan_result_t *)arg;
+    ina219_handle_t handle;
+    struct timespec start;
+    struct timespec stop;
+    
+    /* link the thread functions */
+    DRIVER_INA219_LINK_INIT(&handle, ina219_handle_t);
+    DRIVER_INA219_LINK_IIC_INIT(&handle, a_iic_scan_init);
+    DRIVER_INA219_LINK_IIC_DEINIT(&handle, a_iic_scan_deinit);
+    DRIVER_INA219_LINK_IIC_READ(&handle, a_iic_scan_read);
+    DRIVER_INA219_LINK_IIC_WRITE(&handle, a_iic_scan_write);
+    DRIVER_INA219_LINK_DELAY_MS(&handle, a_iic_scan_delay_ms);
+    DRIVER_INA219_LINK_DEBUG_PRINT(&handle, a_iic_scan_debug_print);
+    
+    /* scan */
+    (void)snprintf(gs_name, 32, "/dev/i2c-%d", result->bus);
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    result->res = ina219_scan(&handle, result->device, 16, &result->num);
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+    result->time_us = (uint32_t)((stop.tv_sec - start.tv_sec) * 1000000 + (stop.tv_nsec - start.tv_nsec) / 1000);
+    
+    return NULL;
+}
+
+/**
+ * @brief      scan several iic adapters in parallel
+ * @param[in]  *bus pointer to an adapter number list
+ * @param[in]  num adapter number
+ * @param[out] *result pointer to a result array with num items
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ * @note       each adapter /dev/i2c-<n> is opened and probed by its own thread,
+ *             the result of an adapter that can't be opened has res 1
+ */
+uint8_t iic_scan_run(const uint8_t *bus, uint8_t num, iic_scan_result_t *result)
+{
+    pthread_t thread[IIC_SCAN_MAX_BUS];
+    uint8_t started[IIC_SCAN_MAX_BUS];
+    uint8_t i;
+    
+    /* check the number */
+    if ((num == 0) || (num > IIC_SCAN_MAX_BUS))
+    {
+        return 1;
+    }
+    
+    /* start one thread per adapter */
+    for (i = 0; i < num; i++)
+    {
+        memset(&result[i], 0, sizeof(iic_scan_result_t));
+        result[i].bus = bus[i];
+        started[i] = 0;
+        if (pthread_create(&thread[i], NULL, a_iic_scan_thread, &result[i]) != 0)
+        {
+            result[i].res = 1;
+            
+            continue;
+        }
+        started[i] = 1;
+    }
+    
+    /* wait all */
+    for (i = 0; i < num; i++)
+    {
+        if (started[i] != 0)
+        {
+            (void)pthread_join(thread[i], NULL);
+        }
+    }
+    
+    return 0;
+}
@@ -0,0 +1,520 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      metrics_server.c
+ * @brief     metrics server source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "metrics_server.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+
+/**
+ * @brief metrics server buffer size definition
+ */
+#define METRICS_SERVER_TEXT_SIZE      (512 + METRICS_SERVER_MAX_DEVICE * 320)                                                /**< text response size */
+#define METRICS_SERVER_BINARY_SIZE    (METRICS_SERVER_BINARY_HEADER_SIZE + METRICS_SERVER_MAX_DEVICE * METRICS_SERVER_BINARY_ENTRY_SIZE)    /**< binary response size */
+#define METRICS_SERVER_REQUEST_SIZE   512                                                                                      /**< request size */
+
+/**
+ * @brief metrics server client structure definition
+ */
+typedef struct metrics_server_client_s
+{
+    int fd;                                         /**< client socket, -1 is free */
+    uint8_t close;                                  /**< close after the response */
+    uint32_t in_len;                                /**< request length */
+    uint32_t out_pos;                               /**< sent length */
+    uint32_t out_len;                               /**< response length */
+    char in[METRICS_SERVER_REQUEST_SIZE];           /**< request buffer */
+    uint8_t out[METRICS_SERVER_TEXT_SIZE];          /**< response buffer */
+} metrics_server_client_t;
+
+/**
+ * @brief metrics server structure definition
+ */
+typedef struct metrics_server_s
+{
+    int fd;                                                         /**< listen socket */
+    int epoll;                                                      /**< epoll handle */
+    char path[108];                                                 /**< socket path */
+    char text[METRICS_SERVER_TEXT_SIZE];                            /**< cached text response */
+    uint32_t text_len;                                              /**< text response length */
+    uint8_t binary[METRICS_SERVER_BINARY_SIZE];                     /**< cached binary response */
+    uint32_t binary_len;                                            /**< binary response length */
+    metrics_server_client_t client[METRICS_SERVER_MAX_CLIENT];      /**< client table */
+} metrics_server_t;
+
+/**
+ * @brief metrics server
+ */
+static metrics_server_t gs_server;        /**< metrics server */
+
+/**
+ * @brief     put a little endian value
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @param[in] len byte number
+ * @note      none
+ */
+static void a_metrics_server_put(uint8_t *buf, uint64_t v, uint8_t len)
+{
+    uint8_t i;
+    
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (uint8_t)(v >> (i * 8));
+    }
+}
+
+/**
+ * @brief     close a client
+ * @param[in] *c pointer to a client structure
+ * @note      none
+ */
+static void a_metrics_server_drop(metrics_server_client_t *c)
+{
+    (void)epoll_ctl(gs_server.epoll, EPOLL_CTL_DEL, c->fd, NULL);
+    (void)close(c->fd);
+    c->fd = -1;
+}
+
+/**
+ * @brief     set the events of a client
+ * @param[in] *c pointer to a client structure
+ * @param[in] events epoll events
+ * @note      none
+ */
+static void a_metrics_server_watch(metrics_server_client_t *c, uint32_t events)
+{
+    struct epoll_event ev;
+    
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.ptr = c;
+    (void)epoll_ctl(gs_server.epoll, EPOLL_CTL_MOD, c->fd, &ev);
+}
+
+/**
+ * @brief     send the pending response
+ * @param[in] *c pointer to a client structure
+ * @note      a slow client is watched for EPOLLOUT and never blocks the others
+ */
+static void a_metrics_server_send(metrics_server_client_t *c)
+{
+    while (c->out_pos < c->out_len)
+    {
+        ssize_t n;
+        
+        n = send(c->fd, &c->out[c->out_pos], c->out_len - c->out_pos, MSG_NOSIGNAL);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                a_metrics_server_watch(c, EPOLLOUT);
+                
+                return;
+            }
+            a_metrics_server_drop(c);
+            
+            return;
+        }
+        c->out_pos += (uint32_t)n;
+    }
+    
+    /* response is sent */
+    c->out_pos = 0;
+    c->out_len = 0;
+    if (c->close != 0)
+    {
+        a_metrics_server_drop(c);
+        
+        return;
+    }
+    a_metrics_server_watch(c, EPOLLIN);
+}
+
+/**
+ * @brief     receive and answer the requests of a client
+ * @param[in] *c pointer to a client structure
+ * @note      "GET ...\r\n\r\n" gets the prometheus text and closes,
+ *            each 'B' byte gets one binary snapshot on a kept connection
+ */
+static void a_metrics_server_receive(metrics_server_client_t *c)
+{
+    ssize_t n;
+    
+    n = recv(c->fd, &c->in[c->in_len], sizeof(c->in) - 1 - c->in_len, 0);
+    if (n <= 0)
+    {
+        if ((n < 0) && ((errno == EINTR) || (errno == EAGAIN)))
+        {
+            return;
+        }
+        a_metrics_server_drop(c);
+        
+        return;
+    }
+    c->in_len += (uint32_t)n;
+    c->in[c->in_len] = 0;
+    
+    /* binary requests */
+    if (c->in[0] == 'B')
+    {
+        uint32_t i;
+        
+        for (i = 0; (i < c->in_len) && (c->in[i] == 'B'); i++)
+        {
+            if ((c->out_len + gs_server.binary_len) <= sizeof(c->out))
+            {
+                memcpy(&c->out[c->out_len], gs_server.binary, gs_server.binary_len);
+                c->out_len += gs_server.binary_len;
+            }
+        }
+        if (i != c->in_len)
+        {
+            c->close = 1;
+        }
+        c->in_len = 0;
+        a_metrics_server_send(c);
+        
+        return;
+    }
+    
+    /* text request */
+    if (strncmp(c->in, "GET ", (c->in_len < 4) ? c->in_len : 4) != 0)
+    {
+        a_metrics_server_drop(c);
+        
+        return;
+    }
+    if ((strstr(c->in, "\r\n\r\n") != NULL) || (strstr(c->in, "\n\n") != NULL))
+    {
+        memcpy(c->out, gs_server.text, gs_server.text_len);
+        c->out_len = gs_server.text_len;
+        c->close = 1;
+        c->in_len = 0;
+        a_metrics_server_send(c);
+        
+        return;
+    }
+    if (c->in_len == (sizeof(c->in) - 1))
+    {
+        a_metrics_server_drop(c);
+    }
+}
+
+/**
+ * @brief accept the pending clients
+ * @note  a client over the table size is closed at once
+ */
+static void a_metrics_server_accept(void)
+{
+    while (1)
+    {
+        struct epoll_event ev;
+        uint32_t i;
+        int fd;
+        
+        fd = accept4(gs_server.fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            return;
+        }
+        for (i = 0; i < METRICS_SERVER_MAX_CLIENT; i++)
+        {
+            if (gs_server.client[i].fd < 0)
+            {
+                break;
+            }
+        }
+        if (i == METRICS_SERVER_MAX_CLIENT)
+        {
+            (void)close(fd);
+            
+            continue;
+        }
+        gs_server.client[i].fd = fd;
+        gs_server.client[i].close = 0;
+        gs_server.client[i].in_len = 0;
+        gs_server.client[i].out_pos = 0;
+        gs_server.client[i].out_len = 0;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.ptr = &gs_server.client[i];
+        (void)epoll_ctl(gs_server.epoll, EPOLL_CTL_ADD, fd, &ev);
+    }
+}
+
+/**
+ * @brief     open the metrics server
+ * @param[in] *path pointer to a unix socket path buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      an old socket file at the path is removed
+ */
+uint8_t metrics_server_open(char *path)
+{
+    struct sockaddr_un addr;
+    struct epoll_event ev;
+    uint32_t i;
+    
+    /* check the path */
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "metrics_server: path is too long.\n");
+        
+        return 1;
+    }
+    
+    /* create the socket */
+    gs_server.fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (gs_server.fd < 0)
+    {
+        perror("metrics_server: socket failed.\n");
+        
+        return 1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    (void)unlink(path);
+    if ((bind(gs_server.fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) ||
+        (listen(gs_server.fd, METRICS_SERVER_MAX_CLIENT) != 0))
+    {
+        perror("metrics_server: bind failed.\n");
+        (void)close(gs_server.fd);
+        
+        return 1;
+    }
+    
+    /* create the epoll */
+    gs_server.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (gs_server.epoll < 0)
+    {
+        perror("metrics_server: epoll failed.\n");
+        (void)close(gs_server.fd);
+        (void)unlink(path);
+        
+        return 1;
+    }
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;
+    (void)epoll_ctl(gs_server.epoll, EPOLL_CTL_ADD, gs_server.fd, &ev);
+    for (i = 0; i < METRICS_SERVER_MAX_CLIENT; i++)
+    {
+        gs_server.client[i].fd = -1;
+    }
+    strcpy(gs_server.path, path);
+    
+    /* render an empty table */
+    return metrics_server_update(NULL, 0);
+}
+
+/**
+ * @brief     update the snapshot table
+ * @param[in] *entry pointer to an entry array
+ * @param[in] num entry number
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ * @note      both responses are rendered once here, the clients are served from the cache
+ */
+uint8_t metrics_server_update(const metrics_server_entry_t *entry, uint8_t num)
+{
+    static const char *const name[4] =
+    {
+        "ina219_shunt_voltage_volts", "ina219_bus_voltage_volts",
+        "ina219_current_amperes", "ina219_power_watts",
+    };
+    static const char *const help[4] =
+    {
+        "Shunt voltage.", "Bus voltage.", "Current.", "Power.",
+    };
+    char body[METRICS_SERVER_TEXT_SIZE];
+    uint32_t len = 0;
+    uint8_t *b;
+    uint8_t i;
+    uint8_t j;
+    
+    if (num > METRICS_SERVER_MAX_DEVICE)
+    {
+        return 1;
+    }
+    
+    /* one family after another as the text format requires */
+    for (j = 0; j < 4; j++)
+    {
+        len += (uint32_t)snprintf(&body[len], sizeof(body) - len, "# HELP %s %s\n# TYPE %s gauge\n", name[j], help[j], name[j]);
+        for (i = 0; i < num; i++)
+        {
+            int64_t v;
+            
+            /* all values are printed in base units */
+            v = (j == 0) ? entry[i].shunt_voltage : (j == 1) ? (int64_t)entry[i].bus_voltage * 1000 :
+                (j == 2) ? entry[i].current : entry[i].power;
+            len += (uint32_t)snprintf(&body[len], sizeof(body) - len, "%s{address=\"0x%02X\"} %s%lld.%06lld\n",
+                                      name[j], entry[i].address, (v < 0) ? "-" : "",
+                                      llabs((long long)(v / 1000000)), llabs((long long)(v % 1000000)));
+        }
+    }
+    len += (uint32_t)snprintf(&body[len], sizeof(body) - len, "# HELP ina219_timestamp_seconds Sample time.\n"
+                              "# TYPE ina219_timestamp_seconds gauge\n");
+    for (i = 0; i < num; i++)
+    {
+        len += (uint32_t)snprintf(&body[len], sizeof(body) - len, "ina219_timestamp_seconds{address=\"0x%02X\"} %llu.%06llu\n",
+                                  entry[i].address, (unsigned long long)(entry[i].timestamp / 1000000),
+                                  (unsigned long long)(entry[i].timestamp % 1000000));
+    }
+    gs_server.text_len = (uint32_t)snprintf(gs_server.text, sizeof(gs_server.text),
+                                            "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+                                            "Content-Length: %u\r\nConnection: close\r\n\r\n%s", len, body);
+    
+    /* binary, little endian */
+    b = gs_server.binary;
+    memcpy(b, "INAM", 4);
+    a_metrics_server_put(&b[4], 2, 2);
+    a_metrics_server_put(&b[6], num, 2);
+    b += METRICS_SERVER_BINARY_HEADER_SIZE;
+    for (i = 0; i < num; i++)
+    {
+        b[0] = entry[i].address;
+        b[1] = 0;
+        b[2] = 0;
+        b[3] = 0;
+        a_metrics_server_put(&b[4], entry[i].timestamp, 8);
+        a_metrics_server_put(&b[12], (uint32_t)entry[i].shunt_voltage, 4);
+        a_metrics_server_put(&b[16], (uint32_t)entry[i].bus_voltage, 4);
+        a_metrics_server_put(&b[20], (uint32_t)entry[i].current, 4);
+        a_metrics_server_put(&b[24], (uint64_t)entry[i].power, 8);
+        b += METRICS_SERVER_BINARY_ENTRY_SIZE;
+    }
+    gs_server.binary_len = (uint32_t)(b - gs_server.binary);
+    
+    return 0;
+}
+
+/**
+ * @brief     serve the clients
+ * @param[in] timeout_ms max waiting time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 poll failed
+ * @note      returns after the first batch of events or the timeout
+ */
+uint8_t metrics_server_poll(uint32_t timeout_ms)
+{
+    struct epoll_event ev[16];
+    int n;
+    int i;
+    
+    /* wait for the events */
+    n = epoll_wait(gs_server.epoll, ev, 16, (int)timeout_ms);
+    if (n < 0)
+    {
+        if (errno == EINTR)
+        {
+            return 0;
+        }
+        perror("metrics_server: epoll_wait failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < n; i++)
+    {
+        metrics_server_client_t *c = (metrics_server_client_t *)ev[i].data.ptr;
+        
+        /* accept the new clients */
+        if (c == NULL)
+        {
+            a_metrics_server_accept();
+            
+            continue;
+        }
+        
+        /* serve the client */
+        if ((ev[i].events & (EPOLLERR | EPOLLHUP)) != 0)
+        {
+            a_metrics_server_drop(c);
+        }
+        else if ((ev[i].events & EPOLLOUT) != 0)
+        {
+            a_metrics_server_send(c);
+        }
+        else
+        {
+            a_metrics_server_receive(c);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  close the metrics server
+ * @return status code
+ *         - 0 success
+ * @note   the socket file is removed
+ */
+uint8_t metrics_server_close(void)
+{
+    uint32_t i;
+    
+    /* close all the clients */
+    for (i = 0; i < METRICS_SERVER_MAX_CLIENT; i++)
+    {
+        if (gs_server.client[i].fd >= 0)
+        {
+            a_metrics_server_drop(&gs_server.client[i]);
+        }
+    }
+    
+    /* close the socket */
+    (void)close(gs_server.epoll);
+    (void)close(gs_server.fd);
+    (void)unlink(gs_server.path);
+    
+    return 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      mmap_file.c
+ * @brief     mmap file source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "mmap_file.h"
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief      map a whole file read only
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] **buf pointer to a file view pointer buffer
+ * @param[out] *len pointer to a file length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 map failed
+ * @note       none
+ */
+uint8_t mmap_file_open(char *name, const uint8_t **buf, uint64_t *len)
+{
+    int fd;
+    struct stat st;
+    void *p;
+    
+    /* open the file */
+    fd = open(name, O_RDONLY);
+    if (fd < 0)
+    {
+        perror("mmap_file: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* get the file size */
+    if ((fstat(fd, &st) != 0) || (st.st_size == 0))
+    {
+        perror("mmap_file: stat failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    
+    /* map the file */
+    p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (p == MAP_FAILED)
+    {
+        perror("mmap_file: mmap failed.\n");
+        
+        return 1;
+    }
+    
+    /* seeks are random */
+    (void)madvise(p, (size_t)st.st_size, MADV_RANDOM);
+    *buf = (const uint8_t *)p;
+    *len = (uint64_t)st.st_size;
+    
+    return 0;
+}
+
+/**
+ * @brief      create or open a preallocated file and map it read write
+ * @param[in]  *name pointer to a file name buffer
+ * @param[in]  len file length
+ * @param[out] **buf pointer to a file view pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 map failed
+ * @note       the existing content is kept
+ */
+uint8_t mmap_file_create(char *name, uint64_t len, uint8_t **buf)
+{
+    int fd;
+    void *p;
+    
+    /* open the file */
+    fd = open(name, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        perror("mmap_file: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* preallocate the file */
+    if (posix_fallocate(fd, 0, (off_t)len) != 0)
+    {
+        perror("mmap_file: fallocate failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    
+    /* map the file */
+    p = mmap(NULL, (size_t)len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (p == MAP_FAILED)
+    {
+        perror("mmap_file: mmap failed.\n");
+        
+        return 1;
+    }
+    *buf = (uint8_t *)p;
+    
+    return 0;
+}
+
+/**
+ * @brief     unmap a file
+ * @param[in] *buf pointer to a file view
+ * @param[in] len file length
+ * @return    status code
+ *            - 0 success
+ *            - 1 unmap failed
+ * @note      none
+ */
+uint8_t mmap_file_close(const uint8_t *buf, uint64_t len)
+{
+    /* unmap the file */
+    if (munmap((void *)buf, (size_t)len) != 0)
+    {
+        perror("mmap_file: munmap failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
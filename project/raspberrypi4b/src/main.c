@@ -35,11 +35,1664 @@
  */
 
 #include "driver_ina219_shot.h"
+#include "driver_ina219_stream.h"
 #include "driver_ina219_basic.h"
 #include "driver_ina219_read_test.h"
+#include "driver_ina219_bench_test.h"
+#include "driver_ina219_convert_test.h"
 #include "driver_ina219_register_test.h"
+#include "driver_ina219_alert_test.h"
+#include "driver_ina219_histogram_test.h"
+#include "driver_ina219_capture_test.h"
+#include "driver_ina219_series_test.h"
+#include "driver_ina219_warm_test.h"
+#include "driver_ina219_log.h"
+#include "driver_ina219_trace.h"
+#include "driver_ina219_rollup.h"
+#include "driver_ina219_export.h"
+#include "driver_ina219_warm.h"
+#include "driver_ina219_timing.h"
+#include "driver_ina219_sim.h"
+#include "driver_ina219_schedule.h"
+#include "driver_ina219_rate.h"
+#include "driver_ina219_mux.h"
+#include "mmap_file.h"
+#include "capture_file.h"
+#include "metrics_server.h"
+#include "iic_arbiter.h"
+#include "iic_scan.h"
 #include <getopt.h>
 #include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+
+static uint8_t gs_log_buf[4096];                        /**< log block buffer */
+static ina219_log_index_entry_t gs_log_index[1024];     /**< log block index */
+static ina219_trace_t gs_trace;                         /**< transaction trace */
+static ina219_trace_entry_t gs_trace_entry[65536];      /**< transaction trace entries */
+static char gs_trace_file[257];                         /**< recorded trace file */
+static ina219_sim_t gs_sim;                             /**< virtual clock simulator */
+static ina219_topology_path_t gs_topology_path[INA219_TOPOLOGY_MAX_DEVICE];        /**< mux path of each device */
+static ina219_address_t gs_topology_addr[INA219_TOPOLOGY_MAX_DEVICE];              /**< addr pin of each device */
+static ina219_sample_t gs_topology_sample[INA219_TOPOLOGY_MAX_DEVICE];             /**< sweep samples */
+static uint16_t gs_topology_num;                                                   /**< device number of the topology */
+static const uint64_t gs_rollup_period[3] =             /**< rollup tier periods, 1s, 1min and 1h */
+{
+    1000000ULL, 60000000ULL, 3600000000ULL,
+};
+static const uint32_t gs_rollup_buckets[3] =            /**< rollup tier buckets, 1 day, 1 week and 1 year */
+{
+    86400, 10080, 8760,
+};
+static uint32_t gs_rollup_size;                         /**< rollup store size */
+static uint8_t gs_export_buf[65536];                    /**< text export buffer */
+static const uint32_t gs_export_age_us = 100000;        /**< max time a row waits in the export buffer */
+static const char *const gs_adc_name[16] =              /**< adc mode names */
+{
+    "9 bit", "10 bit", "11 bit", "12 bit", "12 bit", "12 bit", "12 bit", "12 bit",
+    "12 bit", "12 bit / 2 samples", "12 bit / 4 samples", "12 bit / 8 samples",
+    "12 bit / 16 samples", "12 bit / 32 samples", "12 bit / 64 samples", "12 bit / 128 samples",
+};
+
+/**
+ * @brief     text export output
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_ina219_export_output(const uint8_t *buf, uint32_t len)
+{
+    uint32_t pos = 0;
+    
+    /* write all the rows to the stdout */
+    while (pos < len)
+    {
+        ssize_t n;
+        
+        n = write(STDOUT_FILENO, &buf[pos], len - pos);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            
+            return 1;
+        }
+        pos += (uint32_t)n;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  get the timestamp
+ * @return timestamp in us
+ * @note   none
+ */
+static uint64_t a_ina219_timestamp(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_REALTIME, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief  get the monotonic timestamp
+ * @return timestamp in us
+ * @note   none
+ */
+static uint64_t a_ina219_trace_timestamp(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief  get the pacing clock
+ * @return time in ns
+ * @note   the virtual time is used while the simulator is active
+ */
+static uint64_t a_ina219_clock_ns(void)
+{
+    struct timespec ts;
+    
+    if (ina219_sim_is_active() != 0)
+    {
+        return ina219_sim_get_time() * 1000;
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     sleep until a pacing clock deadline
+ * @param[in] ns deadline in ns
+ * @note      the virtual time jumps to the deadline while the simulator is active
+ */
+static void a_ina219_sleep_until(uint64_t ns)
+{
+    struct timespec ts;
+    
+    if (ina219_sim_is_active() != 0)
+    {
+        ina219_sim_wait_until(ns / 1000);
+        
+        return;
+    }
+    ts.tv_sec = (time_t)(ns / 1000000000ULL);
+    ts.tv_nsec = (long)(ns % 1000000000ULL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+        continue;
+    }
+}
+
+/**
+ * @brief  start the simulator
+ * @return status code
+ *         - 0 success
+ *         - 1 start failed
+ * @note   every addr pin has a device with 10mV on the shunt and 12V on the bus,
+ *         with a topology only its muxes and devices are added,
+ *         one register transaction takes 100us like a 400kHz bus
+ */
+static uint8_t a_ina219_sim_begin(void)
+{
+    uint16_t i;
+    
+    (void)ina219_sim_init(&gs_sim, 100);
+    for (i = 0; i < ((gs_topology_num != 0) ? gs_topology_num : 16); i++)
+    {
+        ina219_address_t addr = (ina219_address_t)(INA219_ADDRESS_0 + (i << 1));
+        uint8_t parent = INA219_SIM_MUX_ROOT;
+        uint8_t channel = 0;
+        uint8_t level;
+        
+        /* add the muxes on the path */
+        if (gs_topology_num != 0)
+        {
+            addr = gs_topology_addr[i];
+            for (level = 0; level < gs_topology_path[i].depth; level++)
+            {
+                uint8_t j;
+                
+                for (j = 0; j < gs_sim.mux_num; j++)
+                {
+                    if ((gs_sim.mux[j].addr == gs_topology_path[i].mux[level]) && (gs_sim.mux[j].parent == parent) &&
+                        ((parent == INA219_SIM_MUX_ROOT) || (gs_sim.mux[j].channel == channel)))
+                    {
+                        break;
+                    }
+                }
+                if ((j == gs_sim.mux_num) &&
+                    (ina219_sim_add_mux(&gs_sim, parent, channel, gs_topology_path[i].mux[level], &j) != 0))
+                {
+                    return 1;
+                }
+                parent = j;
+                channel = gs_topology_path[i].channel[level];
+            }
+        }
+        
+        /* add the device */
+        if ((ina219_sim_add_mux_device(&gs_sim, parent, channel, addr) != 0) ||
+            (ina219_sim_set_input(&gs_sim, addr, 10000, 12000) != 0))
+        {
+            return 1;
+        }
+    }
+    
+    return ina219_sim_start(&gs_sim);
+}
+
+/**
+ * @brief     start the transaction trace
+ * @param[in] *name pointer to a trace file name
+ * @param[in] mode trace mode
+ * @param[in] speed replay speed
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the trace file is the entry number followed by the entries in native byte order
+ */
+static uint8_t a_ina219_trace_begin(char *name, ina219_trace_mode_t mode, ina219_trace_speed_t speed)
+{
+    DRIVER_INA219_TRACE_LINK_INIT(&gs_trace, gs_trace_entry, sizeof(gs_trace_entry) / sizeof(gs_trace_entry[0]));
+    DRIVER_INA219_TRACE_LINK_IIC_READ(&gs_trace, ina219_interface_iic_read);
+    DRIVER_INA219_TRACE_LINK_IIC_WRITE(&gs_trace, ina219_interface_iic_write);
+    DRIVER_INA219_TRACE_LINK_DELAY_MS(&gs_trace, ina219_interface_delay_ms);
+    DRIVER_INA219_TRACE_LINK_TIMESTAMP(&gs_trace, (ina219_sim_is_active() != 0) ? ina219_sim_get_time : a_ina219_trace_timestamp);
+    
+    /* load the trace */
+    if (mode == INA219_TRACE_MODE_REPLAY)
+    {
+        FILE *fp;
+        uint32_t num;
+        
+        fp = fopen(name, "rb");
+        if (fp == NULL)
+        {
+            ina219_interface_debug_print("ina219: open %s failed.\n", name);
+            
+            return 1;
+        }
+        if ((fread(&num, sizeof(uint32_t), 1, fp) != 1) || (num > gs_trace.len) ||
+            (fread(gs_trace_entry, sizeof(ina219_trace_entry_t), num, fp) != num))
+        {
+            ina219_interface_debug_print("ina219: %s is not a valid trace.\n", name);
+            (void)fclose(fp);
+            
+            return 1;
+        }
+        (void)fclose(fp);
+        gs_trace.num = num;
+    }
+    else
+    {
+        memset(gs_trace_file, 0, sizeof(char) * 257);
+        snprintf(gs_trace_file, 257, "%s", name);
+    }
+    
+    /* start the trace */
+    if (ina219_trace_start(&gs_trace, mode, speed) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stop the transaction trace
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   the recorded trace is saved
+ */
+static uint8_t a_ina219_trace_end(void)
+{
+    uint32_t num;
+    uint8_t mismatch;
+    
+    if (ina219_trace_is_active() == 0)
+    {
+        return 0;
+    }
+    (void)ina219_trace_stop();
+    (void)ina219_trace_get_status(&gs_trace, &num, &mismatch);
+    
+    /* save the trace */
+    if (gs_trace.mode == INA219_TRACE_MODE_RECORD)
+    {
+        FILE *fp;
+        
+        fp = fopen(gs_trace_file, "wb");
+        if (fp == NULL)
+        {
+            ina219_interface_debug_print("ina219: open %s failed.\n", gs_trace_file);
+            
+            return 1;
+        }
+        if ((fwrite(&num, sizeof(uint32_t), 1, fp) != 1) ||
+            (fwrite(gs_trace_entry, sizeof(ina219_trace_entry_t), num, fp) != num))
+        {
+            (void)fclose(fp);
+            
+            return 1;
+        }
+        (void)fclose(fp);
+        ina219_interface_debug_print("ina219: %d transactions recorded to %s.\n", num, gs_trace_file);
+    }
+    else
+    {
+        ina219_interface_debug_print("ina219: %d/%d transactions replayed.\n", num, gs_trace.num);
+    }
+    if (mismatch != 0)
+    {
+        ina219_interface_debug_print("ina219: trace mismatch.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      open the rollup store
+ * @param[in]  *name pointer to a store file name
+ * @param[out] *store pointer to an ina219 rollup structure
+ * @param[out] **buf pointer to a store mapping pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the file is preallocated and mapped shared, an existing store is kept
+ */
+static uint8_t a_ina219_rollup_open(char *name, ina219_rollup_t *store, uint8_t **buf)
+{
+    uint8_t res;
+    
+    /* get the size */
+    res = ina219_rollup_get_size(gs_rollup_period, gs_rollup_buckets, 3, &gs_rollup_size);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* map the file */
+    if (mmap_file_create(name, gs_rollup_size, buf) != 0)
+    {
+        return 1;
+    }
+    
+    /* init the store */
+    res = ina219_rollup_init(store, *buf, gs_rollup_size, gs_rollup_period, gs_rollup_buckets, 3);
+    if (res > 1)
+    {
+        ina219_interface_debug_print("ina219: init rollup store failed.\n");
+        (void)mmap_file_close(*buf, gs_rollup_size);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      open the binary log
+ * @param[in]  *name pointer to a log file name
+ * @param[in]  sync_time max data loss in ms on a power cut
+ * @param[in]  sync_size max bytes between two syncs
+ * @param[in]  conf conf register
+ * @param[in]  calibration calibration register
+ * @param[in]  mask logged channel mask
+ * @param[out] *writer pointer to an ina219 log writer structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       half of sync_time is the sync budget of the file and the other half is
+ *             the time a sample may wait in the open block, see a_ina219_log_write
+ */
+static uint8_t a_ina219_log_open(char *name, uint32_t sync_time, uint32_t sync_size, uint16_t conf, uint16_t calibration,
+                                 uint8_t mask, ina219_log_writer_t *writer)
+{
+    uint8_t res;
+    uint64_t len;
+    uint32_t sync_num;
+    uint32_t stall_num;
+    
+    /* open the file */
+    if (capture_file_open(name, 65536, sync_time / 2, sync_size) != 0)
+    {
+        ina219_interface_debug_print("ina219: open %s failed.\n", name);
+        
+        return 1;
+    }
+    
+    /* init the writer */
+    res = ina219_log_writer_init(writer, gs_log_buf, sizeof(gs_log_buf), capture_file_write);
+    if (res == 0)
+    {
+        res = ina219_log_writer_set_index(writer, gs_log_index, sizeof(gs_log_index) / sizeof(gs_log_index[0]));
+    }
+    if (res == 0)
+    {
+        res = ina219_log_writer_set_context(writer, calibration, conf, mask);
+    }
+    if (res != 0)
+    {
+        (void)capture_file_close(&len, &sync_num, &stall_num);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     write a sample to the binary log
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] timestamp sample timestamp in us
+ * @param[in] *sample pointer to a raw sample structure
+ * @param[in] period_us time to the next sample in us
+ * @param[in] sync_time max data loss in ms on a power cut
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the open block is closed before a sample in it would wait more than half of
+ *            sync_time, so a slow rate writes small blocks and a fast rate still writes full ones
+ */
+static uint8_t a_ina219_log_write(ina219_log_writer_t *writer, uint64_t timestamp, const ina219_sample_t *sample,
+                                  uint64_t period_us, uint32_t sync_time)
+{
+    if (ina219_log_writer_write(writer, timestamp, sample) != 0)
+    {
+        return 1;
+    }
+    if (ina219_log_writer_flush_age(writer, timestamp + period_us, sync_time * 500) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      close the binary log
+ * @param[in]  *writer pointer to an ina219 log writer structure
+ * @param[in]  finish 1 writes the last block and the index
+ * @param[out] *len pointer to a written length buffer
+ * @param[out] *sync_num pointer to a sync number buffer
+ * @param[out] *stall_num pointer to a stall number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 close failed
+ * @note       the file is closed even when finish is 0
+ */
+static uint8_t a_ina219_log_close(ina219_log_writer_t *writer, uint8_t finish, uint64_t *len, uint32_t *sync_num, uint32_t *stall_num)
+{
+    uint8_t res = 0;
+    
+    /* write the last block and the index */
+    if (finish != 0)
+    {
+        res = ina219_log_writer_finish(writer);
+    }
+    
+    /* close the file */
+    if (capture_file_close(len, sync_num, stall_num) != 0)
+    {
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief      basic init with an optional warm start cache
+ * @param[in]  addr iic address pin
+ * @param[in]  r reference resistor value
+ * @param[in]  *name pointer to a cache file name, empty for a cold start
+ * @param[out] *warm pointer to a warm start flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       a missing or damaged cache file gives a cold start,
+ *             the file is replaced atomically after a cold start
+ */
+static uint8_t a_ina219_basic_open(ina219_address_t addr, double r, char *name, uint8_t *warm)
+{
+    uint8_t res;
+    uint8_t buf[INA219_WARM_MAX_SIZE];
+    char tmp[262];
+    uint32_t len;
+    ssize_t n;
+    int fd;
+    ina219_warm_cache_t cache;
+    
+    /* no cache */
+    *warm = 0;
+    if (name[0] == 0)
+    {
+        return ina219_basic_init(addr, r);
+    }
+    
+    /* load the cache */
+    (void)ina219_warm_cache_init(&cache);
+    fd = open(name, O_RDONLY);
+    if (fd >= 0)
+    {
+        n = read(fd, buf, INA219_WARM_MAX_SIZE);
+        if ((n <= 0) || (ina219_warm_cache_deserialize(&cache, buf, (uint32_t)n) != 0))
+        {
+            ina219_interface_debug_print("ina219: ignore the invalid warm cache %s.\n", name);
+        }
+        (void)close(fd);
+    }
+    
+    /* init */
+    res = ina219_basic_init_warm(addr, r, &cache, warm);
+    if (res != 0)
+    {
+        return 1;
+    }
+    if (*warm != 0)
+    {
+        ina219_interface_debug_print("ina219: warm start.\n");
+        
+        return 0;
+    }
+    ina219_interface_debug_print("ina219: cold start.\n");
+    
+    /* save the cache */
+    res = ina219_warm_cache_serialize(&cache, buf, INA219_WARM_MAX_SIZE, &len);
+    if (res != 0)
+    {
+        return 0;
+    }
+    (void)snprintf(tmp, 262, "%s.tmp", name);
+    fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        perror("ina219: open warm cache failed");
+        
+        return 0;
+    }
+    n = write(fd, buf, len);
+    if ((n != (ssize_t)len) || (fsync(fd) != 0))
+    {
+        perror("ina219: write warm cache failed");
+        (void)close(fd);
+        (void)unlink(tmp);
+        
+        return 0;
+    }
+    (void)close(fd);
+    if (rename(tmp, name) != 0)
+    {
+        perror("ina219: rename warm cache failed");
+        (void)unlink(tmp);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      parse a channel list
+ * @param[in]  *list pointer to a comma separated addr pin list
+ * @param[out] *addr pointer to an addr pin buffer
+ * @param[out] *hz pointer to a channel rate buffer
+ * @param[out] *priority pointer to a channel priority buffer
+ * @param[out] *num pointer to a channel number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 list is invalid
+ * @note       each item is one hex digit with an optional rate in Hz and an optional priority after it,
+ *             for example "0:1000:0,1,A:10:3", the rate and the priority are 0 when they are not given
+ */
+static uint8_t a_ina219_parse_channels(char *list, ina219_address_t *addr, double *hz, uint8_t *priority, uint8_t *num)
+{
+    char *p = list;
+    
+    *num = 0;
+    while (*p != 0)
+    {
+        char c = *p;
+        uint8_t pin;
+        
+        /* get the pin */
+        if ((c >= '0') && (c <= '9'))
+        {
+            pin = (uint8_t)(c - '0');
+        }
+        else if ((c >= 'A') && (c <= 'F'))
+        {
+            pin = (uint8_t)(c - 'A' + 10);
+        }
+        else
+        {
+            return 1;
+        }
+        if (*num >= INA219_STREAM_MAX_CHANNEL)
+        {
+            return 1;
+        }
+        addr[*num] = (ina219_address_t)(INA219_ADDRESS_0 + (pin << 1));
+        hz[*num] = 0.0;
+        priority[*num] = 0;
+        p++;
+        
+        /* get the rate */
+        if (*p == ':')
+        {
+            char *end;
+            
+            hz[*num] = strtod(p + 1, &end);
+            if ((end == (p + 1)) || (hz[*num] <= 0.0))
+            {
+                return 1;
+            }
+            p = end;
+            
+            /* get the priority */
+            if (*p == ':')
+            {
+                long level = strtol(p + 1, &end, 10);
+                
+                if ((end == (p + 1)) || (level < 0) || (level > 255))
+                {
+                    return 1;
+                }
+                priority[*num] = (uint8_t)level;
+                p = end;
+            }
+        }
+        (*num)++;
+        
+        /* next item */
+        if (*p == ',')
+        {
+            p++;
+            if (*p == 0)
+            {
+                return 1;
+            }
+        }
+        else if (*p != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return (*num == 0) ? 1 : 0;
+}
+
+/**
+ * @brief      parse a topology list
+ * @param[in]  *list pointer to a comma separated device list
+ * @param[out] *path pointer to a mux path buffer
+ * @param[out] *addr pointer to an addr pin buffer
+ * @param[out] *num pointer to a device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 list is invalid
+ * @note       each device is its mux levels followed by its addr pin, a level is the 7 bit hex
+ *             mux address and the channel, for example "70:0/0,70:0/1,70:1/0,71:2/72:3/A,5"
+ */
+static uint8_t a_ina219_parse_topology(char *list, ina219_topology_path_t *path, ina219_address_t *addr, uint16_t *num)
+{
+    char *p = list;
+    
+    *num = 0;
+    while (*p != 0)
+    {
+        char *end;
+        unsigned long value;
+        
+        if (*num >= INA219_TOPOLOGY_MAX_DEVICE)
+        {
+            return 1;
+        }
+        path[*num].depth = 0;
+        
+        /* get the mux levels */
+        while (1)
+        {
+            value = strtoul(p, &end, 16);
+            if (end == p)
+            {
+                return 1;
+            }
+            if (*end != ':')
+            {
+                break;
+            }
+            if ((value > 0x7F) || (path[*num].depth >= INA219_TOPOLOGY_MAX_DEPTH) ||
+                (end[1] < '0') || (end[1] > '7') || (end[2] != '/'))
+            {
+                return 1;
+            }
+            path[*num].mux[path[*num].depth] = (uint8_t)(value << 1);
+            path[*num].channel[path[*num].depth] = (uint8_t)(end[1] - '0');
+            path[*num].depth++;
+            p = end + 3;
+        }
+        
+        /* get the pin */
+        if ((value > 0xF) || ((end - p) != 1))
+        {
+            return 1;
+        }
+        addr[*num] = (ina219_address_t)(INA219_ADDRESS_0 + (value << 1));
+        (*num)++;
+        p = end;
+        
+        /* next item */
+        if (*p == ',')
+        {
+            p++;
+            if (*p == 0)
+            {
+                return 1;
+            }
+        }
+        else if (*p != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return (*num == 0) ? 1 : 0;
+}
+
+/**
+ * @brief     run a deadline paced capture
+ * @param[in] *addr pointer to an addr pin list
+ * @param[in] num channel number
+ * @param[in] r reference resistor value
+ * @param[in] rate sample rate in Hz
+ * @param[in] duration capture time in s
+ * @param[in] format_enable text export enable
+ * @param[in] format text export format
+ * @param[in] single_enable single channel enable
+ * @param[in] single streamed channel
+ * @param[in] *output pointer to a binary log file name, empty for none
+ * @param[in] sync_time max data loss in ms on a power cut
+ * @param[in] sync_size max bytes between two syncs
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every sample has an absolute deadline on the monotonic clock, a sample whose
+ *            whole slot has passed is dropped instead of shifting the later deadlines,
+ *            jitter is the lateness of the first read behind its deadline, the achieved rate
+ *            counts the time from the loop start to the end of the last read,
+ *            a single channel stream converts and reads only one register per sample,
+ *            the adc mode leaves room for the measured reads of all the channels,
+ *            the binary log records one channel
+ */
+static uint8_t a_ina219_stream(ina219_address_t *addr, uint8_t num, double r, double rate, double duration,
+                               uint8_t format_enable, ina219_export_format_t format,
+                               uint8_t single_enable, ina219_single_channel_t single,
+                               char *output, uint32_t sync_time, uint32_t sync_size)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t field = INA219_SAMPLE_FIELD_ALL;
+    uint8_t conversions = (single_enable != 0) ? 1 : 2;
+    uint32_t conversion;
+    uint32_t cost = 0;
+    uint64_t period;
+    uint64_t total;
+    uint64_t k;
+    uint64_t next;
+    uint64_t first;
+    uint64_t last;
+    uint64_t done = 0;
+    uint64_t dropped = 0;
+    uint64_t late_max = 0;
+    double late_sum = 0.0;
+    uint64_t len = 0;
+    uint32_t sync_num = 0;
+    uint32_t stall_num = 0;
+    ina219_adc_mode_t mode;
+    ina219_export_t exporter;
+    ina219_log_writer_t writer;
+    ina219_convert_t convert[INA219_STREAM_MAX_CHANNEL];
+    
+    /* check the params */
+    if ((rate <= 0.0) || (rate > 100000.0) || (duration <= 0.0))
+    {
+        ina219_interface_debug_print("ina219: rate or duration is invalid.\n");
+        
+        return 1;
+    }
+    if ((output[0] != 0) && (num != 1))
+    {
+        ina219_interface_debug_print("ina219: the binary log records one channel.\n");
+        
+        return 1;
+    }
+    period = (uint64_t)(1000000000.0 / rate + 0.5);
+    total = (uint64_t)(rate * duration + 0.5);
+    if (total == 0)
+    {
+        total = 1;
+    }
+    
+    /* stream init */
+    res = ina219_stream_init(addr, num, r, INA219_ADC_MODE_9_BIT_1_SAMPLES);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* convert and read only one register */
+    if (single_enable != 0)
+    {
+        if (ina219_stream_single_init(single) != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        if (single == INA219_SINGLE_CHANNEL_SHUNT_VOLTAGE)
+        {
+            ina219_interface_debug_print("ina219: shunt voltage only, the current is computed from the shunt voltage and the resistance, the power is unavailable.\n");
+        }
+        else
+        {
+            ina219_interface_debug_print("ina219: bus voltage only, the current and the power are unavailable.\n");
+        }
+    }
+    for (i = 0; i < num; i++)
+    {
+        res = ina219_stream_get_convert(i, &convert[i]);
+        if (res != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* measure the bus time of the reads in one period */
+    ina219_interface_delay_ms(1);
+    for (i = 0; i < num; i++)
+    {
+        ina219_sample_t sample;
+        uint64_t now;
+        
+        now = a_ina219_clock_ns();
+        if (single_enable != 0)
+        {
+            res = ina219_stream_single_read(i, &sample, &field);
+        }
+        else
+        {
+            res = ina219_stream_read_sample(i, &sample);
+        }
+        cost += (uint32_t)((a_ina219_clock_ns() - now) / 1000) + 1;
+        if (res != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* select the adc mode */
+    if ((uint64_t)cost >= (period / 1000))
+    {
+        (void)ina219_schedule_select_adc_mode((uint32_t)(period / 1000), cost, conversions, &mode);
+        ina219_interface_debug_print("ina219: %.1fHz is above the bus rate, the reads of %d channels take %uus, samples are dropped.\n",
+                                     rate, num, cost);
+    }
+    else if (ina219_schedule_select_adc_mode((uint32_t)(period / 1000), cost, conversions, &mode) != 0)
+    {
+        ina219_interface_debug_print("ina219: %.1fHz leaves no time for a conversion after %uus of reads, samples repeat.\n",
+                                     rate, cost);
+    }
+    for (i = 0; i < num; i++)
+    {
+        if (ina219_stream_set_adc_mode(i, mode) != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    (void)ina219_timing_get_conversion_time(mode, &conversion);
+    field = INA219_SAMPLE_FIELD_ALL;
+    ina219_interface_debug_print("ina219: %d channels, adc mode %s, %uus per sample, %uus reads, %lluus period.\n",
+                                 num, gs_adc_name[mode], conversion * conversions, cost, (unsigned long long)(period / 1000));
+    
+    /* init the exporter */
+    if (format_enable != 0)
+    {
+        (void)fflush(stdout);
+        res = ina219_export_init(&exporter, gs_export_buf, sizeof(gs_export_buf), format, a_ina219_export_output);
+        if (res == 0)
+        {
+            res = ina219_export_write_header(&exporter);
+        }
+        if (res != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* open the binary log */
+    if (output[0] != 0)
+    {
+        uint16_t conf;
+        uint16_t calibration;
+        uint8_t mask = INA219_LOG_CHANNEL_ALL;
+        
+        if (single_enable != 0)
+        {
+            mask = (single == INA219_SINGLE_CHANNEL_SHUNT_VOLTAGE) ? INA219_LOG_CHANNEL_SHUNT_VOLTAGE : INA219_LOG_CHANNEL_BUS_VOLTAGE;
+        }
+        if ((ina219_stream_get_context(0, &conf, &calibration) != 0) ||
+            (a_ina219_log_open(output, sync_time, sync_size, conf, calibration, mask, &writer) != 0))
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* wait the first conversion */
+    ina219_interface_delay_ms((conversion * conversions) / 1000 + 1);
+    
+    /* loop */
+    first = a_ina219_clock_ns();
+    last = first;
+    next = first + period;
+    for (k = 0; (k < total) && (res == 0); k++)
+    {
+        uint64_t now;
+        
+        /* sleep until the deadline */
+        a_ina219_sleep_until(next);
+        now = a_ina219_clock_ns();
+        if (now > next)
+        {
+            late_sum += (double)(now - next);
+            if ((now - next) > late_max)
+            {
+                late_max = now - next;
+            }
+        }
+        
+        /* read all the channels */
+        for (i = 0; (i < num) && (res == 0); i++)
+        {
+            ina219_sample_t sample;
+            uint64_t timestamp;
+            
+            if (single_enable != 0)
+            {
+                res = ina219_stream_single_read(i, &sample, &field);
+                if ((res == 0) && (format_enable != 0))
+                {
+                    res = ina219_export_set_field(&exporter, field);
+                }
+            }
+            else
+            {
+                res = ina219_stream_read_sample(i, &sample);
+            }
+            timestamp = a_ina219_timestamp();
+            if ((res == 0) && (format_enable != 0))
+            {
+                res = ina219_export_write(&exporter, timestamp, (uint8_t)(addr[i] >> 1), &convert[i], &sample);
+            }
+            if ((res == 0) && (output[0] != 0))
+            {
+                res = a_ina219_log_write(&writer, timestamp, &sample, period / 1000, sync_time);
+            }
+        }
+        if ((res == 0) && (format_enable != 0))
+        {
+            res = ina219_export_flush_age(&exporter, a_ina219_timestamp() + period / 1000, gs_export_age_us);
+        }
+        last = a_ina219_clock_ns();
+        done++;
+        
+        /* drop the slots that have passed */
+        next += period;
+        now = a_ina219_clock_ns();
+        if (now >= (next + period))
+        {
+            uint64_t skip = (now - next) / period;
+            
+            if (skip > (total - k - 1))
+            {
+                skip = total - k - 1;
+            }
+            dropped += skip;
+            k += skip;
+            next += skip * period;
+        }
+    }
+    
+    /* flush the rows */
+    if ((res == 0) && (format_enable != 0))
+    {
+        res = ina219_export_flush(&exporter);
+    }
+    
+    /* close the binary log */
+    if (output[0] != 0)
+    {
+        if (a_ina219_log_close(&writer, (res == 0) ? 1 : 0, &len, &sync_num, &stall_num) != 0)
+        {
+            res = 1;
+        }
+    }
+    (void)ina219_stream_deinit();
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: read failed.\n");
+        
+        return 1;
+    }
+    
+    /* report */
+    {
+        double elapsed = (double)(last - first) / 1000000000.0;
+        
+        ina219_interface_debug_print("ina219: %llu samples in %.3fs, %.1fHz achieved, %.1fHz target, %llu dropped.\n",
+                                     (unsigned long long)done, elapsed, (elapsed > 0.0) ? ((double)done / elapsed) : 0.0,
+                                     rate, (unsigned long long)dropped);
+        ina219_interface_debug_print("ina219: jitter mean %.1fus, max %.1fus.\n",
+                                     (done != 0) ? (late_sum / (double)done / 1000.0) : 0.0, (double)late_max / 1000.0);
+        if (output[0] != 0)
+        {
+            ina219_interface_debug_print("ina219: %llu bytes, %u syncs, %u stalls.\n", (unsigned long long)len, sync_num, stall_num);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run a deadline scheduled capture with a rate per channel
+ * @param[in] *addr pointer to an addr pin list
+ * @param[in] *hz pointer to a channel rate list, 0 uses the default rate
+ * @param[in] num channel number
+ * @param[in] r reference resistor value
+ * @param[in] rate default sample rate in Hz
+ * @param[in] duration capture time in s
+ * @param[in] format_enable text export enable
+ * @param[in] format text export format
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      each channel gets the slowest adc mode that still has a new result every period,
+ *            the next conversion time of each channel follows its conf and the reads are
+ *            ordered earliest deadline first, so no read waits for or repeats a conversion
+ */
+static uint8_t a_ina219_schedule_capture(ina219_address_t *addr, double *hz, uint8_t num, double r, double rate,
+                                         double duration, uint8_t format_enable, ina219_export_format_t format)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t index;
+    uint32_t cost[INA219_STREAM_MAX_CHANNEL];
+    uint64_t now;
+    uint64_t end;
+    uint64_t at;
+    double load;
+    double utilization;
+    ina219_schedule_t sched;
+    ina219_export_t exporter;
+    ina219_convert_t convert[INA219_STREAM_MAX_CHANNEL];
+    
+    /* check the params */
+    if (duration <= 0.0)
+    {
+        ina219_interface_debug_print("ina219: duration is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* stream init */
+    res = ina219_stream_init(addr, num, r, INA219_ADC_MODE_9_BIT_1_SAMPLES);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* measure the bus time of one read */
+    ina219_interface_delay_ms(1);
+    for (i = 0; i < num; i++)
+    {
+        ina219_sample_t sample;
+        
+        now = a_ina219_clock_ns();
+        res = ina219_stream_read_sample(i, &sample);
+        cost[i] = (uint32_t)((a_ina219_clock_ns() - now) / 1000) + 1;
+        if ((res != 0) || (ina219_stream_get_convert(i, &convert[i]) != 0))
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* select the adc modes and add the channels */
+    (void)ina219_schedule_init(&sched, a_ina219_clock_ns() / 1000);
+    for (i = 0; i < num; i++)
+    {
+        ina219_adc_mode_t mode;
+        uint32_t period;
+        uint32_t conversion;
+        uint16_t conf;
+        double target = (hz[i] > 0.0) ? hz[i] : rate;
+        
+        period = (uint32_t)(1000000.0 / target + 0.5);
+        if ((target > 100000.0) || (ina219_schedule_select_adc_mode(period, cost[i], 2, &mode) != 0) ||
+            (ina219_stream_set_adc_mode(i, mode) != 0))
+        {
+            ina219_interface_debug_print("ina219: channel 0x%02X at %.1fHz is infeasible, one read takes %uus.\n",
+                                         (uint8_t)(addr[i] >> 1), target, cost[i]);
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        now = a_ina219_clock_ns() / 1000;
+        if ((ina219_stream_get_conf(i, &conf) != 0) ||
+            (ina219_schedule_add(&sched, conf, period, cost[i], now, &index) != 0))
+        {
+            ina219_interface_debug_print("ina219: channel 0x%02X at %.1fHz is infeasible.\n", (uint8_t)(addr[i] >> 1), target);
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        (void)ina219_timing_get_period(conf, &conversion);
+        ina219_interface_debug_print("ina219: channel 0x%02X, %.1fHz, adc mode %s, %uus conversion, %uus read.\n",
+                                     (uint8_t)(addr[i] >> 1), target, gs_adc_name[mode], conversion, cost[i]);
+    }
+    (void)ina219_schedule_get_load(&sched, &load);
+    ina219_interface_debug_print("ina219: requested bus load %.1f percent.\n", load * 100.0);
+    if (load > 1.0)
+    {
+        ina219_interface_debug_print("ina219: requested rates are above the bus budget, deadlines will be missed.\n");
+    }
+    
+    /* init the exporter */
+    if (format_enable != 0)
+    {
+        (void)fflush(stdout);
+        res = ina219_export_init(&exporter, gs_export_buf, sizeof(gs_export_buf), format, a_ina219_export_output);
+        if (res == 0)
+        {
+            res = ina219_export_write_header(&exporter);
+        }
+        if (res != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* loop */
+    end = sched.start + (uint64_t)(duration * 1000000.0);
+    now = a_ina219_clock_ns() / 1000;
+    while (res == 0)
+    {
+        ina219_sample_t sample;
+        uint64_t start;
+        
+        /* wait for the earliest deadline */
+        (void)ina219_schedule_next(&sched, now, &index, &at);
+        if (at >= end)
+        {
+            break;
+        }
+        if (format_enable != 0)
+        {
+            res = ina219_export_flush_age(&exporter, a_ina219_timestamp() + ((at > now) ? (at - now) : 0), gs_export_age_us);
+            if (res != 0)
+            {
+                break;
+            }
+        }
+        a_ina219_sleep_until(at * 1000);
+        
+        /* read the channel */
+        start = a_ina219_clock_ns() / 1000;
+        res = ina219_stream_read_sample(index, &sample);
+        now = a_ina219_clock_ns() / 1000;
+        (void)ina219_schedule_done(&sched, index, start, now);
+        if ((res == 0) && (format_enable != 0))
+        {
+            res = ina219_export_write(&exporter, a_ina219_timestamp(), (uint8_t)(addr[index] >> 1), &convert[index], &sample);
+        }
+    }
+    
+    /* flush the rows */
+    if ((res == 0) && (format_enable != 0))
+    {
+        res = ina219_export_flush(&exporter);
+    }
+    (void)ina219_stream_deinit();
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: read failed.\n");
+        
+        return 1;
+    }
+    
+    /* report */
+    for (i = 0; i < num; i++)
+    {
+        ina219_interface_debug_print("ina219: channel 0x%02X, %u reads, %.1fHz achieved, %u missed.\n",
+                                     (uint8_t)(addr[i] >> 1), sched.entry[i].read_num,
+                                     (double)sched.entry[i].read_num / duration, sched.entry[i].miss_num);
+    }
+    (void)ina219_schedule_get_utilization(&sched, end, &utilization);
+    ina219_interface_debug_print("ina219: bus utilization %.1f percent.\n", utilization * 100.0);
+    
+    return 0;
+}
+
+/**
+ * @brief     run a hyperperiod rate group capture
+ * @param[in] *addr pointer to an addr pin list
+ * @param[in] *hz pointer to a channel rate list, 0 uses the default rate
+ * @param[in] *priority pointer to a channel priority list, 0 is the highest
+ * @param[in] num channel number
+ * @param[in] r reference resistor value
+ * @param[in] rate default sample rate in Hz
+ * @param[in] duration capture time in s
+ * @param[in] format_enable text export enable
+ * @param[in] format text export format
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the reads are laid out once in a table of frames covering the hyperperiod of all the
+ *            periods, the critical channels are placed first and a lower priority channel that
+ *            does not fit the bus budget left in the frames fails the run instead of delaying them
+ */
+static uint8_t a_ina219_rate_capture(ina219_address_t *addr, double *hz, uint8_t *priority, uint8_t num, double r,
+                                     double rate, double duration, uint8_t format_enable, ina219_export_format_t format)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t index;
+    uint8_t list[INA219_RATE_MAX_CHANNEL];
+    uint8_t list_num;
+    uint32_t cost[INA219_STREAM_MAX_CHANNEL];
+    uint32_t read_num[INA219_STREAM_MAX_CHANNEL];
+    uint32_t late;
+    uint64_t frame;
+    uint64_t frames;
+    uint64_t start;
+    uint64_t now;
+    double peak;
+    double mean;
+    ina219_export_t exporter;
+    ina219_convert_t convert[INA219_STREAM_MAX_CHANNEL];
+    static ina219_rate_t table;
+    
+    /* check the params */
+    if (duration <= 0.0)
+    {
+        ina219_interface_debug_print("ina219: duration is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* stream init */
+    res = ina219_stream_init(addr, num, r, INA219_ADC_MODE_9_BIT_1_SAMPLES);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* measure the bus time of one read */
+    ina219_interface_delay_ms(1);
+    for (i = 0; i < num; i++)
+    {
+        ina219_sample_t sample;
+        
+        now = a_ina219_clock_ns();
+        res = ina219_stream_read_sample(i, &sample);
+        cost[i] = (uint32_t)((a_ina219_clock_ns() - now) / 1000) + 1;
+        if ((res != 0) || (ina219_stream_get_convert(i, &convert[i]) != 0))
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* select the adc modes and add the channels */
+    (void)ina219_rate_init(&table, 90);
+    for (i = 0; i < num; i++)
+    {
+        ina219_adc_mode_t mode;
+        uint32_t period;
+        uint32_t conversion;
+        uint16_t conf;
+        double target = (hz[i] > 0.0) ? hz[i] : rate;
+        
+        period = (uint32_t)(1000000.0 / target + 0.5);
+        if ((target > 100000.0) || (ina219_schedule_select_adc_mode(period, cost[i], 2, &mode) != 0) ||
+            (ina219_stream_set_adc_mode(i, mode) != 0) || (ina219_stream_get_conf(i, &conf) != 0) ||
+            (ina219_rate_add(&table, conf, period, cost[i], priority[i], &index) != 0))
+        {
+            ina219_interface_debug_print("ina219: channel 0x%02X at %.1fHz is infeasible, one read takes %uus.\n",
+                                         (uint8_t)(addr[i] >> 1), target, cost[i]);
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+        (void)ina219_timing_get_period(conf, &conversion);
+        ina219_interface_debug_print("ina219: channel 0x%02X, %.1fHz, priority %d, adc mode %s, %uus conversion, %uus read.\n",
+                                     (uint8_t)(addr[i] >> 1), target, priority[i], gs_adc_name[mode], conversion, cost[i]);
+    }
+    
+    /* build the schedule */
+    res = ina219_rate_build(&table, &index);
+    if (res == 5)
+    {
+        ina219_interface_debug_print("ina219: channel 0x%02X at %.1fHz does not fit a table of %d frames, use harmonic rates.\n",
+                                     (uint8_t)(addr[index] >> 1), 1000000.0 / (double)table.channel[index].period_us,
+                                     INA219_RATE_MAX_FRAME);
+        (void)ina219_stream_deinit();
+        
+        return 1;
+    }
+    else if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: channel 0x%02X at %.1fHz is infeasible, it does not fit the bus budget left by the channels before it.\n",
+                                     (uint8_t)(addr[index] >> 1), 1000000.0 / (double)table.channel[index].period_us);
+        (void)ina219_stream_deinit();
+        
+        return 1;
+    }
+    (void)ina219_rate_get_load(&table, &peak, &mean);
+    ina219_interface_debug_print("ina219: %uus frame, %d frames, peak load %.1f percent, mean load %.1f percent.\n",
+                                 table.frame_us, table.frame_num, peak * 100.0, mean * 100.0);
+    
+    /* init the exporter */
+    if (format_enable != 0)
+    {
+        (void)fflush(stdout);
+        res = ina219_export_init(&exporter, gs_export_buf, sizeof(gs_export_buf), format, a_ina219_export_output);
+        if (res == 0)
+        {
+            res = ina219_export_write_header(&exporter);
+        }
+        if (res != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* loop */
+    memset(read_num, 0, sizeof(read_num));
+    late = 0;
+    frames = (uint64_t)(duration * 1000000.0) / table.frame_us;
+    start = a_ina219_clock_ns() / 1000;
+    for (frame = 0; (frame < frames) && (res == 0); frame++)
+    {
+        /* wait for the frame */
+        a_ina219_sleep_until((start + frame * table.frame_us) * 1000);
+        
+        /* read the channels of the frame by priority */
+        (void)ina219_rate_get_frame(&table, frame, list, &list_num);
+        for (i = 0; (i < list_num) && (res == 0); i++)
+        {
+            ina219_sample_t sample;
+            
+            res = ina219_stream_read_sample(list[i], &sample);
+            read_num[list[i]]++;
+            if ((res == 0) && (format_enable != 0))
+            {
+                res = ina219_export_write(&exporter, a_ina219_timestamp(), (uint8_t)(addr[list[i]] >> 1), &convert[list[i]], &sample);
+            }
+        }
+        
+        /* check the overrun */
+        now = a_ina219_clock_ns() / 1000;
+        if (now > (start + (frame + 1) * table.frame_us))
+        {
+            late++;
+        }
+        else if ((res == 0) && (format_enable != 0))
+        {
+            res = ina219_export_flush_age(&exporter, a_ina219_timestamp() + (start + (frame + 1) * table.frame_us - now),
+                                          gs_export_age_us);
+        }
+    }
+    
+    /* flush the rows */
+    if ((res == 0) && (format_enable != 0))
+    {
+        res = ina219_export_flush(&exporter);
+    }
+    (void)ina219_stream_deinit();
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: read failed.\n");
+        
+        return 1;
+    }
+    
+    /* report */
+    for (i = 0; i < num; i++)
+    {
+        ina219_interface_debug_print("ina219: channel 0x%02X, %u reads, %.1fHz achieved.\n",
+                                     (uint8_t)(addr[i] >> 1), read_num[i], (double)read_num[i] / duration);
+    }
+    ina219_interface_debug_print("ina219: %u of %u frames overran.\n", late, (uint32_t)frames);
+    
+    return 0;
+}
+
+/**
+ * @brief     run a mux topology capture
+ * @param[in] r reference resistor value
+ * @param[in] times sweep number
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every sweep reads all the devices grouped by mux channel, the mux writes and the
+ *            time of each sweep are printed and the samples of the last sweep are printed at exit
+ */
+static uint8_t a_ina219_topology_capture(double r, uint32_t times)
+{
+    uint8_t res;
+    uint16_t i;
+    uint32_t k;
+    uint32_t switch_num;
+    uint64_t start;
+    
+    /* mux init */
+    res = ina219_mux_init(gs_topology_path, gs_topology_addr, gs_topology_num, r, INA219_ADC_MODE_12_BIT_1_SAMPLES);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* wait the first conversion */
+    ina219_interface_delay_ms(2);
+    
+    /* loop */
+    for (k = 0; k < times; k++)
+    {
+        start = a_ina219_clock_ns();
+        res = ina219_mux_sweep(gs_topology_sample, &switch_num);
+        if (res != 0)
+        {
+            (void)ina219_mux_deinit();
+            ina219_interface_debug_print("ina219: sweep failed.\n");
+            
+            return 1;
+        }
+        ina219_interface_debug_print("ina219: sweep %d/%d, %d devices, %d mux writes, %.1fms.\n", k + 1, times,
+                                     gs_topology_num, switch_num, (double)(a_ina219_clock_ns() - start) / 1000000.0);
+        
+        /* delay 1000ms */
+        if ((k + 1) < times)
+        {
+            ina219_interface_delay_ms(1000);
+        }
+    }
+    
+    /* print the last sweep */
+    for (i = 0; (i < gs_topology_num) && (times != 0); i++)
+    {
+        char name[32] = {0};
+        uint8_t level;
+        int32_t bus;
+        int32_t current;
+        int64_t power;
+        int32_t shunt;
+        ina219_convert_t convert;
+        ina219_sample_t *sample = &gs_topology_sample[i];
+        ina219_batch_raw_t raw = {&sample->shunt_voltage, &sample->bus_voltage, &sample->current, &sample->power};
+        ina219_batch_fixed_t fixed = {&shunt, &bus, &current, &power};
+        
+        for (level = 0; level < gs_topology_path[i].depth; level++)
+        {
+            (void)snprintf(&name[strlen(name)], sizeof(name) - strlen(name), "%02X:%d/",
+                           gs_topology_path[i].mux[level] >> 1, gs_topology_path[i].channel[level]);
+        }
+        (void)snprintf(&name[strlen(name)], sizeof(name) - strlen(name), "%X", (gs_topology_addr[i] - INA219_ADDRESS_0) >> 1);
+        (void)ina219_mux_get_convert(i, &convert);
+        (void)ina219_convert_batch_fixed(&convert, &raw, &fixed, 1);
+        ina219_interface_debug_print("ina219: device %s bus voltage is %dmV, current is %0.3fmA, power is %0.3fmW.\n",
+                                     name, bus, (double)current / 1000.0, (double)power / 1000.0);
+    }
+    
+    return ina219_mux_deinit();
+}
+
+/**
+ * @brief     run a group triggered capture
+ * @param[in] *addr pointer to an addr pin list
+ * @param[in] num channel number
+ * @param[in] r reference resistor value
+ * @param[in] times sample set number
+ * @param[in] format_enable text export enable
+ * @param[in] format text export format
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every set starts all the channels with back to back conf writes and waits once,
+ *            all the rows of a set have the same timestamp
+ */
+static uint8_t a_ina219_trigger_capture(ina219_address_t *addr, uint8_t num, double r, uint32_t times,
+                                        uint8_t format_enable, ina219_export_format_t format)
+{
+    uint8_t res;
+    uint8_t i;
+    uint32_t k;
+    uint32_t skew;
+    uint32_t skew_max = 0;
+    double skew_sum = 0.0;
+    ina219_export_t exporter;
+    ina219_sample_t sample[INA219_STREAM_MAX_CHANNEL];
+    ina219_convert_t convert[INA219_STREAM_MAX_CHANNEL];
+    
+    /* stream init */
+    res = ina219_stream_init(addr, num, r, INA219_ADC_MODE_12_BIT_1_SAMPLES);
+    if (res != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        if (ina219_stream_get_convert(i, &convert[i]) != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* group init */
+    res = ina219_stream_trigger_init(INA219_MODE_SHUNT_BUS_VOLTAGE_TRIGGERED,
+                                     (ina219_sim_is_active() != 0) ? ina219_sim_get_time : a_ina219_trace_timestamp);
+    if (res != 0)
+    {
+        (void)ina219_stream_deinit();
+        
+        return 1;
+    }
+    
+    /* init the exporter */
+    if (format_enable != 0)
+    {
+        (void)fflush(stdout);
+        res = ina219_export_init(&exporter, gs_export_buf, sizeof(gs_export_buf), format, a_ina219_export_output);
+        if (res == 0)
+        {
+            res = ina219_export_write_header(&exporter);
+        }
+        if (res != 0)
+        {
+            (void)ina219_stream_deinit();
+            
+            return 1;
+        }
+    }
+    
+    /* loop */
+    for (k = 0; (k < times) && (res == 0); k++)
+    {
+        uint64_t timestamp;
+        
+        /* trigger and read all the channels */
+        timestamp = a_ina219_timestamp();
+        res = ina219_stream_trigger_read(sample, &skew);
+        if (res != 0)
+        {
+            break;
+        }
+        skew_sum += (double)skew;
+        if (skew > skew_max)
+        {
+            skew_max = skew;
+        }
+        
+        /* output */
+        if (format_enable == 0)
+        {
+            ina219_interface_debug_print("ina219: %d/%d, skew %uus.\n", k + 1, times, skew);
+        }
+        for (i = 0; (i < num) && (res == 0); i++)
+        {
+            if (format_enable != 0)
+            {
+                res = ina219_export_write(&exporter, timestamp, (uint8_t)(addr[i] >> 1), &convert[i], &sample[i]);
+            }
+            else
+            {
+                int32_t bus;
+                int32_t current;
+                int64_t power;
+                int32_t shunt;
+                ina219_batch_raw_t raw = {&sample[i].shunt_voltage, &sample[i].bus_voltage, &sample[i].current, &sample[i].power};
+                ina219_batch_fixed_t fixed = {&shunt, &bus, &current, &power};
+                
+                (void)ina219_convert_batch_fixed(&convert[i], &raw, &fixed, 1);
+                ina219_interface_debug_print("ina219: channel 0x%02X bus voltage is %dmV, current is %0.3fmA, power is %0.3fmW.\n",
+                                             (uint8_t)(addr[i] >> 1), bus, (double)current / 1000.0, (double)power / 1000.0);
+            }
+        }
+        if ((res == 0) && (format_enable != 0))
+        {
+            res = ina219_export_flush_age(&exporter, timestamp + 1000000, gs_export_age_us);
+        }
+        
+        /* delay 1000ms */
+        if ((k + 1) < times)
+        {
+            ina219_interface_delay_ms(1000);
+        }
+    }
+    
+    /* flush the rows */
+    if ((res == 0) && (format_enable != 0))
+    {
+        res = ina219_export_flush(&exporter);
+    }
+    (void)ina219_stream_deinit();
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: read failed.\n");
+        
+        return 1;
+    }
+    
+    /* report */
+    ina219_interface_debug_print("ina219: %d channels, trigger skew mean %.1fus, max %uus.\n",
+                                 num, (times != 0) ? (skew_sum / (double)times) : 0.0, skew_max);
+    
+    return 0;
+}
 
 /**
  * @brief     ina219 full function
@@ -66,9 +1719,59 @@ uint8_t ina219(uint8_t argc, char **argv)
         {"addr", required_argument, NULL, 1},
         {"resistance", required_argument, NULL, 2},
         {"times", required_argument, NULL, 3},
+        {"output", required_argument, NULL, 4},
+        {"input", required_argument, NULL, 5},
+        {"start", required_argument, NULL, 6},
+        {"stop", required_argument, NULL, 7},
+        {"record", required_argument, NULL, 8},
+        {"replay", required_argument, NULL, 9},
+        {"speed", required_argument, NULL, 10},
+        {"rollup", required_argument, NULL, 11},
+        {"sync-time", required_argument, NULL, 12},
+        {"sync-size", required_argument, NULL, 13},
+        {"format", required_argument, NULL, 14},
+        {"socket", required_argument, NULL, 15},
+        {"shared", required_argument, NULL, 16},
+        {"warm", required_argument, NULL, 17},
+        {"rate", required_argument, NULL, 18},
+        {"duration", required_argument, NULL, 19},
+        {"channels", required_argument, NULL, 20},
+        {"bus", required_argument, NULL, 21},
+        {"sim", no_argument, NULL, 22},
+        {"trigger", no_argument, NULL, 23},
+        {"hyperperiod", no_argument, NULL, 24},
+        {"only", required_argument, NULL, 25},
+        {"topology", required_argument, NULL, 26},
+        {"duty", required_argument, NULL, 27},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
+    char output[257] = {0};
+    char input[257] = {0};
+    uint64_t start = 0;
+    uint64_t stop = UINT64_MAX;
+    uint32_t sync_time = 1000;
+    uint32_t sync_size = 65536;
+    uint8_t format_enable = 0;
+    ina219_export_format_t format = INA219_EXPORT_FORMAT_CSV;
+    char trace[257] = {0};
+    char rollup[257] = {0};
+    char socket_path[257] = {0};
+    char warm_file[257] = {0};
+    char channels[65] = {0};
+    char bus[65] = "1";
+    double rate = 0.0;
+    double duration = 10.0;
+    ina219_trace_mode_t trace_mode = INA219_TRACE_MODE_RECORD;
+    ina219_trace_speed_t trace_speed = INA219_TRACE_SPEED_FULL;
+    uint8_t sim = 0;
+    uint8_t trigger = 0;
+    uint8_t hyperperiod = 0;
+    uint8_t single_enable = 0;
+    ina219_single_channel_t single = INA219_SINGLE_CHANNEL_SHUNT_VOLTAGE;
+    char *topology = NULL;
+    uint8_t duty_enable = 0;
+    ina219_mode_t duty = INA219_MODE_POWER_DOWN;
     uint32_t times = 3;
     double r = 0.1;
     ina219_address_t addr = INA219_ADDRESS_0;
@@ -115,216 +1818,1149 @@ uint8_t ina219(uint8_t argc, char **argv)
             /* port */
             case 'p' :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "p");
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "p");
+                
+                break;
+            }
+            
+            /* example */
+            case 'e' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "e_%s", optarg);
+                
+                break;
+            }
+            
+            /* test */
+            case 't' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "t_%s", optarg);
+                
+                break;
+            }
+            
+            /* addr */
+            case 1 :
+            {
+                /* set the addr pin */
+                if (strcmp("0", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_0;
+                }
+                else if (strcmp("1", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_1;
+                }
+                else if (strcmp("2", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_2;
+                }
+                else if (strcmp("3", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_3;
+                }
+                else if (strcmp("4", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_4;
+                }
+                else if (strcmp("5", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_5;
+                }
+                else if (strcmp("6", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_6;
+                }
+                else if (strcmp("7", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_7;
+                }
+                else if (strcmp("8", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_8;
+                }
+                else if (strcmp("9", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_9;
+                }
+                else if (strcmp("A", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_A;
+                }
+                else if (strcmp("B", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_B;
+                }
+                else if (strcmp("C", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_C;
+                }
+                else if (strcmp("D", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_D;
+                }
+                else if (strcmp("E", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_E;
+                }
+                else if (strcmp("F", optarg) == 0)
+                {
+                    addr = INA219_ADDRESS_F;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* resistance */
+            case 2 :
+            {
+                /* set the resistance */
+                r = atof(optarg);
+                
+                break;
+            }
+
+            /* running times */
+            case 3 :
+            {
+                /* set the times */
+                times = atol(optarg);
+                
+                break;
+            } 
+            
+            /* output file */
+            case 4 :
+            {
+                /* set the output */
+                memset(output, 0, sizeof(char) * 257);
+                strncpy(output, optarg, 256);
+                
+                break;
+            }
+            
+            /* input file */
+            case 5 :
+            {
+                /* set the input */
+                memset(input, 0, sizeof(char) * 257);
+                strncpy(input, optarg, 256);
+                
+                break;
+            }
+            
+            /* start timestamp */
+            case 6 :
+            {
+                /* set the start */
+                start = strtoull(optarg, NULL, 10);
+                
+                break;
+            }
+            
+            /* stop timestamp */
+            case 7 :
+            {
+                /* set the stop */
+                stop = strtoull(optarg, NULL, 10);
+                
+                break;
+            }
+            
+            /* record trace */
+            case 8 :
+            {
+                /* set the trace */
+                memset(trace, 0, sizeof(char) * 257);
+                strncpy(trace, optarg, 256);
+                trace_mode = INA219_TRACE_MODE_RECORD;
+                
+                break;
+            }
+            
+            /* replay trace */
+            case 9 :
+            {
+                /* set the trace */
+                memset(trace, 0, sizeof(char) * 257);
+                strncpy(trace, optarg, 256);
+                trace_mode = INA219_TRACE_MODE_REPLAY;
+                
+                break;
+            }
+            
+            /* replay speed */
+            case 10 :
+            {
+                /* set the speed */
+                if (strcmp("full", optarg) == 0)
+                {
+                    trace_speed = INA219_TRACE_SPEED_FULL;
+                }
+                else if (strcmp("recorded", optarg) == 0)
+                {
+                    trace_speed = INA219_TRACE_SPEED_RECORDED;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* rollup store */
+            case 11 :
+            {
+                /* set the rollup */
+                memset(rollup, 0, sizeof(char) * 257);
+                strncpy(rollup, optarg, 256);
+                
+                break;
+            }
+            
+            /* sync time */
+            case 12 :
+            {
+                /* set the sync time */
+                sync_time = atol(optarg);
+                
+                break;
+            }
+            
+            /* sync size */
+            case 13 :
+            {
+                /* set the sync size */
+                sync_size = atol(optarg);
+                
+                break;
+            }
+            
+            /* text format */
+            case 14 :
+            {
+                /* set the format */
+                if (strcmp("csv", optarg) == 0)
+                {
+                    format = INA219_EXPORT_FORMAT_CSV;
+                }
+                else if (strcmp("ndjson", optarg) == 0)
+                {
+                    format = INA219_EXPORT_FORMAT_NDJSON;
+                }
+                else
+                {
+                    return 5;
+                }
+                format_enable = 1;
+                
+                break;
+            }
+            
+            /* socket path */
+            case 15 :
+            {
+                /* set the socket path */
+                memset(socket_path, 0, sizeof(char) * 257);
+                strncpy(socket_path, optarg, 256);
+                
+                break;
+            }
+            
+            /* shared bus */
+            case 16 :
+            {
+                /* enable the arbitration */
+                iic_arbiter_enable(atol(optarg));
+                
+                break;
+            }
+            
+            /* warm start cache */
+            case 17 :
+            {
+                /* set the cache file */
+                memset(warm_file, 0, sizeof(char) * 257);
+                strncpy(warm_file, optarg, 256);
+                
+                break;
+            }
+            
+            /* sample rate */
+            case 18 :
+            {
+                /* set the rate */
+                rate = atof(optarg);
+                
+                break;
+            }
+            
+            /* capture time */
+            case 19 :
+            {
+                /* set the duration */
+                duration = atof(optarg);
+                
+                break;
+            }
+            
+            /* channel list */
+            case 20 :
+            {
+                /* set the channels */
+                memset(channels, 0, sizeof(char) * 65);
+                strncpy(channels, optarg, 64);
+                
+                break;
+            }
+            
+            /* adapter list */
+            case 21 :
+            {
+                /* set the adapters */
+                memset(bus, 0, sizeof(char) * 65);
+                strncpy(bus, optarg, 64);
+                
+                break;
+            }
+            
+            /* simulator */
+            case 22 :
+            {
+                /* run on the simulator */
+                sim = 1;
                 
                 break;
             }
             
-            /* example */
-            case 'e' :
+            /* group trigger */
+            case 23 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "e_%s", optarg);
+                /* trigger all the channels at once */
+                trigger = 1;
                 
                 break;
             }
             
-            /* test */
-            case 't' :
+            /* hyperperiod schedule */
+            case 24 :
             {
-                /* set the type */
-                memset(type, 0, sizeof(char) * 33);
-                snprintf(type, 32, "t_%s", optarg);
+                /* run the static rate group table */
+                hyperperiod = 1;
                 
                 break;
             }
             
-            /* addr */
-            case 1 :
+            /* single channel */
+            case 25 :
             {
-                /* set the addr pin */
-                if (strcmp("0", optarg) == 0)
+                /* set the streamed channel */
+                if (strcmp("shunt", optarg) == 0)
                 {
-                    addr = INA219_ADDRESS_0;
+                    single = INA219_SINGLE_CHANNEL_SHUNT_VOLTAGE;
                 }
-                else if (strcmp("1", optarg) == 0)
+                else if (strcmp("bus", optarg) == 0)
                 {
-                    addr = INA219_ADDRESS_1;
+                    single = INA219_SINGLE_CHANNEL_BUS_VOLTAGE;
                 }
-                else if (strcmp("2", optarg) == 0)
+                else
                 {
-                    addr = INA219_ADDRESS_2;
+                    return 5;
                 }
-                else if (strcmp("3", optarg) == 0)
+                single_enable = 1;
+                
+                break;
+            }
+            
+            /* mux topology */
+            case 26 :
+            {
+                /* set the device list */
+                topology = optarg;
+                
+                break;
+            }
+            
+            /* power down duty cycle */
+            case 27 :
+            {
+                /* set the idle mode */
+                if (strcmp("power-down", optarg) == 0)
                 {
-                    addr = INA219_ADDRESS_3;
+                    duty = INA219_MODE_POWER_DOWN;
                 }
-                else if (strcmp("4", optarg) == 0)
+                else if (strcmp("adc-off", optarg) == 0)
                 {
-                    addr = INA219_ADDRESS_4;
+                    duty = INA219_MODE_ADC_OFF;
                 }
-                else if (strcmp("5", optarg) == 0)
+                else
                 {
-                    addr = INA219_ADDRESS_5;
+                    return 5;
                 }
-                else if (strcmp("6", optarg) == 0)
+                duty_enable = 1;
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+    
+    /* parse the topology */
+    if (topology != NULL)
+    {
+        if (a_ina219_parse_topology(topology, gs_topology_path, gs_topology_addr, &gs_topology_num) != 0)
+        {
+            return 5;
+        }
+    }
+    
+    /* start the simulator */
+    if (sim != 0)
+    {
+        if (a_ina219_sim_begin() != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* start the trace */
+    if (trace[0] != 0)
+    {
+        if (a_ina219_trace_begin(trace, trace_mode, trace_speed) != 0)
+        {
+            return 1;
+        }
+    }
+
+    /* run the function */
+    if (strcmp("t_reg", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the reg test */
+        res = ina219_register_test(addr);
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_read", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the read test */
+        res = ina219_read_test(addr, r, times);
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_bench", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the bench test */
+        res = ina219_bench_test(addr, r, times, (sim != 0) ? ina219_sim_get_time : a_ina219_trace_timestamp);
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_convert", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the convert test */
+        res = ina219_convert_test();
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_alert", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the alert test */
+        res = ina219_alert_test(addr, r);
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_histogram", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the histogram test */
+        res = ina219_histogram_test();
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_capture", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the capture test */
+        res = ina219_capture_test();
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_series", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the series test */
+        res = ina219_series_test(addr, r, (sim != 0) ? ina219_sim_get_time : a_ina219_trace_timestamp);
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_warm", type) == 0)
+    {
+        uint8_t res;
+        
+        /* run the warm test */
+        res = ina219_warm_test(addr, r);
+        if (res != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("e_read", type) == 0)
+    {
+        uint8_t res;
+        uint8_t warm;
+        uint32_t i;
+        
+        /* deadline paced capture */
+        if ((rate > 0.0) || (channels[0] != 0) || (trigger != 0) || (hyperperiod != 0) || (single_enable != 0) ||
+            (topology != NULL))
+        {
+            ina219_address_t list[INA219_STREAM_MAX_CHANNEL];
+            double hz[INA219_STREAM_MAX_CHANNEL];
+            uint8_t priority[INA219_STREAM_MAX_CHANNEL];
+            uint8_t num;
+            
+            /* get the channels */
+            if (channels[0] != 0)
+            {
+                if (a_ina219_parse_channels(channels, list, hz, priority, &num) != 0)
                 {
-                    addr = INA219_ADDRESS_6;
+                    return 5;
                 }
-                else if (strcmp("7", optarg) == 0)
+            }
+            else
+            {
+                list[0] = addr;
+                hz[0] = 0.0;
+                priority[0] = 0;
+                num = 1;
+            }
+            
+            /* the binary log records the paced capture only */
+            for (i = 0; (i < num) && (output[0] != 0); i++)
+            {
+                if ((hz[i] > 0.0) || (topology != NULL) || (trigger != 0) || (hyperperiod != 0))
                 {
-                    addr = INA219_ADDRESS_7;
+                    ina219_interface_debug_print("ina219: --output only records the paced capture.\n");
+                    
+                    return 5;
                 }
-                else if (strcmp("8", optarg) == 0)
+            }
+            
+            /* the topology sweeps the devices behind the muxes */
+            if (topology != NULL)
+            {
+                if (a_ina219_topology_capture(r, times) != 0)
                 {
-                    addr = INA219_ADDRESS_8;
+                    return 1;
                 }
-                else if (strcmp("9", optarg) == 0)
+                
+                return 0;
+            }
+            
+            /* the group trigger samples all the channels at once */
+            if (trigger != 0)
+            {
+                if (a_ina219_trigger_capture(list, num, r, times, format_enable, format) != 0)
                 {
-                    addr = INA219_ADDRESS_9;
+                    return 1;
                 }
-                else if (strcmp("A", optarg) == 0)
+                
+                return 0;
+            }
+            
+            /* the hyperperiod table runs the rate groups by priority */
+            if (hyperperiod != 0)
+            {
+                if (a_ina219_rate_capture(list, hz, priority, num, r, (rate > 0.0) ? rate : 1.0, duration, format_enable, format) != 0)
                 {
-                    addr = INA219_ADDRESS_A;
+                    return 1;
                 }
-                else if (strcmp("B", optarg) == 0)
+                
+                return 0;
+            }
+            
+            /* a rate per channel runs the scheduled capture */
+            for (i = 0; i < num; i++)
+            {
+                if (hz[i] > 0.0)
+                {
+                    if (a_ina219_schedule_capture(list, hz, num, r, (rate > 0.0) ? rate : 1.0, duration, format_enable, format) != 0)
+                    {
+                        return 1;
+                    }
+                    
+                    return 0;
+                }
+            }
+            
+            /* run the capture */
+            if (a_ina219_stream(list, num, r, (rate > 0.0) ? rate : 1.0, duration, format_enable, format,
+                                single_enable, single, output, sync_time, sync_size) != 0)
+            {
+                return 1;
+            }
+            
+            return 0;
+        }
+        
+        /* basic init */
+        res = a_ina219_basic_open(addr, r, warm_file, &warm);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* delay 1000ms after a cold start */
+        if (warm == 0)
+        {
+            ina219_interface_delay_ms(1000);
+        }
+        
+        /* binary log or rollup */
+        if ((output[0] != 0) || (rollup[0] != 0))
+        {
+            ina219_log_writer_t writer;
+            ina219_rollup_t store;
+            uint8_t *buf = NULL;
+            uint16_t conf;
+            uint16_t calibration;
+            uint64_t len = 0;
+            uint32_t sync_num = 0;
+            uint32_t stall_num = 0;
+            
+            /* open the rollup store */
+            if (rollup[0] != 0)
+            {
+                res = a_ina219_rollup_open(rollup, &store, &buf);
+                if (res != 0)
                 {
-                    addr = INA219_ADDRESS_B;
+                    (void)ina219_basic_deinit();
+                    
+                    return 1;
                 }
-                else if (strcmp("C", optarg) == 0)
+            }
+            
+            /* open the file */
+            if (output[0] != 0)
+            {
+                res = ina219_basic_get_context(&conf, &calibration);
+                if ((res != 0) ||
+                    (a_ina219_log_open(output, sync_time, sync_size, conf, calibration, INA219_LOG_CHANNEL_ALL, &writer) != 0))
                 {
-                    addr = INA219_ADDRESS_C;
+                    if (buf != NULL)
+                    {
+                        (void)mmap_file_close(buf, gs_rollup_size);
+                    }
+                    (void)ina219_basic_deinit();
+                    
+                    return 1;
                 }
-                else if (strcmp("D", optarg) == 0)
+            }
+            
+            /* loop */
+            for (i = 0; (i < times) && (res == 0); i++)
+            {
+                ina219_sample_t sample;
+                uint64_t timestamp;
+                
+                /* read raw data */
+                res = ina219_basic_read_sample(&sample);
+                timestamp = a_ina219_timestamp();
+                if ((res == 0) && (output[0] != 0))
                 {
-                    addr = INA219_ADDRESS_D;
+                    res = a_ina219_log_write(&writer, timestamp, &sample, 1000000, sync_time);
                 }
-                else if (strcmp("E", optarg) == 0)
+                if ((res == 0) && (buf != NULL))
                 {
-                    addr = INA219_ADDRESS_E;
+                    res = ina219_rollup_update(&store, timestamp, sample.power);
                 }
-                else if (strcmp("F", optarg) == 0)
+                ina219_interface_delay_ms(1000);
+            }
+            
+            /* close the file */
+            if (output[0] != 0)
+            {
+                if (a_ina219_log_close(&writer, (res == 0) ? 1 : 0, &len, &sync_num, &stall_num) != 0)
                 {
-                    addr = INA219_ADDRESS_F;
+                    res = 1;
                 }
-                else
+            }
+            if (buf != NULL)
+            {
+                if (mmap_file_close(buf, gs_rollup_size) != 0)
                 {
-                    return 5;
+                    res = 1;
                 }
+            }
+            (void)ina219_basic_deinit();
+            if (res != 0)
+            {
+                ina219_interface_debug_print("ina219: write samples failed.\n");
                 
-                break;
+                return 1;
+            }
+            ina219_interface_debug_print("ina219: %d samples written.\n", times);
+            if (output[0] != 0)
+            {
+                ina219_interface_debug_print("ina219: %llu bytes, %u syncs, %u stalls.\n", (unsigned long long)len, sync_num, stall_num);
             }
             
-            /* resistance */
-            case 2 :
+            return 0;
+        }
+        
+        /* text export */
+        if (format_enable != 0)
+        {
+            ina219_export_t exporter;
+            ina219_convert_t convert;
+            
+            /* init the exporter */
+            (void)fflush(stdout);
+            res = ina219_basic_get_convert(&convert);
+            if (res == 0)
             {
-                /* set the resistance */
-                r = atof(optarg);
-                
-                break;
+                res = ina219_export_init(&exporter, gs_export_buf, sizeof(gs_export_buf), format, a_ina219_export_output);
             }
-
-            /* running times */
-            case 3 :
+            if (res == 0)
             {
-                /* set the times */
-                times = atol(optarg);
+                res = ina219_export_write_header(&exporter);
+            }
+            
+            /* loop */
+            for (i = 0; (i < times) && (res == 0); i++)
+            {
+                ina219_sample_t sample;
                 
-                break;
-            } 
+                /* read raw data */
+                res = ina219_basic_read_sample(&sample);
+                if (res == 0)
+                {
+                    res = ina219_export_write(&exporter, a_ina219_timestamp(), (uint8_t)(addr >> 1), &convert, &sample);
+                }
+                if (res == 0)
+                {
+                    res = ina219_export_flush_age(&exporter, a_ina219_timestamp() + 1000000, gs_export_age_us);
+                }
+                ina219_interface_delay_ms(1000);
+            }
             
-            /* the end */
-            case -1 :
+            /* flush the rows */
+            if (res == 0)
             {
-                break;
+                res = ina219_export_flush(&exporter);
+            }
+            (void)ina219_basic_deinit();
+            if (res != 0)
+            {
+                ina219_interface_debug_print("ina219: export failed.\n");
+                
+                return 1;
             }
             
-            /* others */
-            default :
+            return 0;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            float mV;
+            float mA;
+            float mW;
+            
+            /* read data */
+            res = ina219_basic_read(&mV, &mA, &mW);
+            if (res != 0)
             {
-                return 5;
+                (void)ina219_basic_deinit();
+                
+                return 1;
             }
+            
+            /* output */
+            ina219_interface_debug_print("ina219: %d/%d.\n", i + 1, times);
+            ina219_interface_debug_print("ina219: bus voltage is %0.3fmV.\n", mV);
+            ina219_interface_debug_print("ina219: current is %0.3fmA.\n", mA);
+            ina219_interface_debug_print("ina219: power is %0.3fmW.\n", mW);
+            ina219_interface_delay_ms(1000);
         }
-    } while (c != -1);
-
-    /* run the function */
-    if (strcmp("t_reg", type) == 0)
+        
+        /* deinit */
+        (void)ina219_basic_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_dump", type) == 0)
     {
         uint8_t res;
+        const uint8_t *buf;
+        uint64_t len;
+        uint64_t offset;
+        ina219_log_reader_t reader;
+        ina219_log_block_t block;
         
-        /* run the reg test */
-        res = ina219_register_test(addr);
+        /* map the file */
+        if (mmap_file_open(input, &buf, &len) != 0)
+        {
+            return 1;
+        }
+        
+        /* init the reader */
+        res = ina219_log_reader_init(&reader, buf, len);
         if (res != 0)
         {
+            ina219_interface_debug_print("ina219: %s is not a valid log.\n", input);
+            (void)mmap_file_close(buf, len);
+            
             return 1;
         }
-        else
+        
+        /* seek the start */
+        res = ina219_log_reader_seek(&reader, start, &offset);
+        while ((res == 0) && (ina219_log_reader_read_block(&reader, &offset, &block) == 0) && (block.first <= stop))
         {
-            return 0;
+            ina219_log_decoder_t decoder;
+            ina219_sample_t sample;
+            uint64_t timestamp;
+            
+            /* decode the block */
+            (void)ina219_log_decoder_init(&decoder, &block);
+            while (ina219_log_decoder_next(&decoder, &timestamp, &sample) == 0)
+            {
+                if ((timestamp >= start) && (timestamp <= stop))
+                {
+                    ina219_interface_debug_print("ina219: %llu shunt %d bus %u current %d power %u.\n",
+                                                 (unsigned long long)timestamp, sample.shunt_voltage,
+                                                 sample.bus_voltage, sample.current, sample.power);
+                }
+            }
         }
+        
+        /* unmap the file */
+        (void)mmap_file_close(buf, len);
+        
+        return 0;
     }
-    else if (strcmp("t_read", type) == 0)
+    else if (strcmp("e_recover", type) == 0)
     {
         uint8_t res;
+        const uint8_t *buf;
+        uint64_t len;
+        uint64_t valid;
+        uint32_t block_num;
         
-        /* run the read test */
-        res = ina219_read_test(addr, r, times);
+        /* map the file */
+        if (mmap_file_open(input, &buf, &len) != 0)
+        {
+            return 1;
+        }
+        
+        /* find the valid part */
+        res = ina219_log_recover(buf, len, &valid, &block_num);
+        (void)mmap_file_close(buf, len);
         if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: %s is not a valid log.\n", input);
+            
+            return 1;
+        }
+        
+        /* truncate the torn tail */
+        if (valid != len)
+        {
+            if (truncate(input, (off_t)valid) != 0)
+            {
+                ina219_interface_debug_print("ina219: truncate %s failed.\n", input);
+                
+                return 1;
+            }
+        }
+        ina219_interface_debug_print("ina219: %u blocks kept, %llu bytes dropped.\n", block_num, (unsigned long long)(len - valid));
+        
+        return 0;
+    }
+    else if (strcmp("e_query", type) == 0)
+    {
+        ina219_rollup_t store;
+        ina219_rollup_stat_t stat;
+        uint8_t *buf;
+        
+        /* open the rollup store */
+        if (a_ina219_rollup_open(rollup, &store, &buf) != 0)
         {
             return 1;
         }
-        else
+        
+        /* query the range */
+        if (ina219_rollup_query(&store, start, (stop == UINT64_MAX) ? a_ina219_timestamp() : stop, &stat) != 0)
         {
-            return 0;
+            (void)mmap_file_close(buf, gs_rollup_size);
+            
+            return 5;
+        }
+        (void)mmap_file_close(buf, gs_rollup_size);
+        
+        /* output */
+        ina219_interface_debug_print("ina219: power count is %u.\n", stat.count);
+        if (stat.count != 0)
+        {
+            ina219_interface_debug_print("ina219: power min is %d.\n", stat.min);
+            ina219_interface_debug_print("ina219: power max is %d.\n", stat.max);
+            ina219_interface_debug_print("ina219: power mean is %0.3f.\n", (double)stat.sum / stat.count);
         }
+        
+        return 0;
     }
-    else if (strcmp("e_read", type) == 0)
+    else if (strcmp("e_serve", type) == 0)
     {
         uint8_t res;
+        uint8_t warm;
         uint32_t i;
+        ina219_convert_t convert;
+        
+        /* check the socket */
+        if (socket_path[0] == 0)
+        {
+            return 5;
+        }
         
         /* basic init */
-        res = ina219_basic_init(addr, r);
+        res = a_ina219_basic_open(addr, r, warm_file, &warm);
         if (res != 0)
         {
             return 1;
         }
         
-        /* delay 1000ms */
-        ina219_interface_delay_ms(1000);
+        /* open the server */
+        res = ina219_basic_get_convert(&convert);
+        if ((res != 0) || (metrics_server_open(socket_path) != 0))
+        {
+            (void)ina219_basic_deinit();
+            
+            return 1;
+        }
+        
+        /* delay 1000ms after a cold start */
+        if (warm == 0)
+        {
+            ina219_interface_delay_ms(1000);
+        }
         
         /* loop */
-        for (i = 0; i < times; i++)
+        for (i = 0; (i < times) && (res == 0); i++)
         {
-            float mV;
-            float mA;
-            float mW;
+            ina219_sample_t sample;
+            metrics_server_entry_t entry;
+            uint64_t deadline;
+            uint64_t now;
             
-            /* read data */
-            res = ina219_basic_read(&mV, &mA, &mW);
-            if (res != 0)
+            /* read raw data */
+            deadline = a_ina219_trace_timestamp() + 1000000;
+            res = ina219_basic_read_sample(&sample);
+            if (res == 0)
             {
-                (void)ina219_basic_deinit();
+                ina219_batch_raw_t raw = {&sample.shunt_voltage, &sample.bus_voltage, &sample.current, &sample.power};
+                ina219_batch_fixed_t fixed = {&entry.shunt_voltage, &entry.bus_voltage, &entry.current, &entry.power};
                 
-                return 1;
+                /* update the snapshot */
+                entry.address = (uint8_t)(addr >> 1);
+                entry.timestamp = a_ina219_timestamp();
+                (void)ina219_convert_batch_fixed(&convert, &raw, &fixed, 1);
+                res = metrics_server_update(&entry, 1);
             }
             
-            /* output */
-            ina219_interface_debug_print("ina219: %d/%d.\n", i + 1, times);
-            ina219_interface_debug_print("ina219: bus voltage is %0.3fmV.\n", mV);
-            ina219_interface_debug_print("ina219: current is %0.3fmA.\n", mA);
-            ina219_interface_debug_print("ina219: power is %0.3fmW.\n", mW);
-            ina219_interface_delay_ms(1000);
+            /* serve the clients from memory until the next sample */
+            now = a_ina219_trace_timestamp();
+            while ((res == 0) && (now < deadline))
+            {
+                res = metrics_server_poll((uint32_t)((deadline - now + 999) / 1000));
+                now = a_ina219_trace_timestamp();
+            }
         }
         
-        /* deinit */
+        /* close the server */
+        (void)metrics_server_close();
         (void)ina219_basic_deinit();
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: serve failed.\n");
+            
+            return 1;
+        }
         
         return 0;
     }
+    else if (strcmp("e_scan", type) == 0)
+    {
+        uint8_t list[IIC_SCAN_MAX_BUS];
+        iic_scan_result_t result[IIC_SCAN_MAX_BUS];
+        uint8_t num = 0;
+        uint8_t found = 0;
+        uint8_t i;
+        uint8_t j;
+        char *p = bus;
+        char pins[49] = {0};
+        
+        /* parse the adapters */
+        while (*p != 0)
+        {
+            char *end;
+            long n;
+            
+            n = strtol(p, &end, 10);
+            if ((end == p) || (n < 0) || (n > 255) || (num >= IIC_SCAN_MAX_BUS))
+            {
+                return 5;
+            }
+            list[num++] = (uint8_t)n;
+            p = end;
+            if (*p == ',')
+            {
+                p++;
+            }
+            else if (*p != 0)
+            {
+                return 5;
+            }
+        }
+        if (num == 0)
+        {
+            return 5;
+        }
+        
+        /* scan all the adapters */
+        if (iic_scan_run(list, num, result) != 0)
+        {
+            return 1;
+        }
+        
+        /* print the devices */
+        for (i = 0; i < num; i++)
+        {
+            if (result[i].res == 1)
+            {
+                ina219_interface_debug_print("ina219: /dev/i2c-%d can't be opened.\n", result[i].bus);
+                
+                continue;
+            }
+            for (j = 0; j < result[i].num; j++)
+            {
+                ina219_scan_device_t *device = &result[i].device[j];
+                uint8_t pin = (uint8_t)((device->addr - INA219_ADDRESS_0) >> 1);
+                
+                if (device->state == INA219_SCAN_STATE_POWER_ON)
+                {
+                    ina219_interface_debug_print("ina219: /dev/i2c-%d addr %X (0x%02X), power on.\n",
+                                                 result[i].bus, pin, device->addr >> 1);
+                }
+                else
+                {
+                    ina219_interface_debug_print("ina219: /dev/i2c-%d addr %X (0x%02X), configured, conf 0x%04X.\n",
+                                                 result[i].bus, pin, device->addr >> 1, device->conf);
+                }
+                if (i == 0)
+                {
+                    (void)snprintf(&pins[strlen(pins)], 49 - strlen(pins), "%s%X", (j == 0) ? "" : ",", pin);
+                }
+            }
+            ina219_interface_debug_print("ina219: /dev/i2c-%d %d devices in %0.1fms.\n",
+                                         result[i].bus, result[i].num, (double)result[i].time_us / 1000.0);
+            found += result[i].num;
+        }
+        
+        /* ready to use channel list of the first adapter */
+        if (pins[0] != 0)
+        {
+            ina219_interface_debug_print("ina219: --channels=%s\n", pins);
+        }
+        
+        return (found == 0) ? 1 : 0;
+    }
     else if (strcmp("e_shot", type) == 0)
     {
         uint8_t res;
@@ -337,6 +2973,19 @@ uint8_t ina219(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* keep the chip idle between the reads */
+        if (duty_enable != 0)
+        {
+            res = ina219_shot_duty_init(duty, INA219_SHOT_DEFAULT_SUPPLY_VOLTAGE,
+                                        (ina219_sim_is_active() != 0) ? ina219_sim_get_time : a_ina219_trace_timestamp);
+            if (res != 0)
+            {
+                (void)ina219_shot_deinit();
+                
+                return 1;
+            }
+        }
+        
         /* delay 1000ms */
         ina219_interface_delay_ms(1000);
 
@@ -348,7 +2997,14 @@ uint8_t ina219(uint8_t argc, char **argv)
             float mW;
             
             /* read data */
-            res = ina219_shot_read(&mV, &mA, &mW);
+            if (duty_enable != 0)
+            {
+                res = ina219_shot_duty_read(&mV, &mA, &mW);
+            }
+            else
+            {
+                res = ina219_shot_read(&mV, &mA, &mW);
+            }
             if (res != 0)
             {
                 (void)ina219_shot_deinit();
@@ -361,6 +3017,22 @@ uint8_t ina219(uint8_t argc, char **argv)
             ina219_interface_debug_print("ina219: bus voltage is %0.3fmV.\n", mV);
             ina219_interface_debug_print("ina219: current is %0.3fmA.\n", mA);
             ina219_interface_debug_print("ina219: power is %0.3fmW.\n", mW);
+            
+            /* energy of the sample against a chip converting all the time */
+            if (duty_enable != 0)
+            {
+                uint32_t active_us;
+                uint64_t idle_us;
+                uint64_t nj;
+                double continuous;
+                
+                (void)ina219_shot_duty_get_energy(&active_us, &idle_us, &nj);
+                continuous = (double)INA219_DUTY_ACTIVE_UA * ((double)active_us + (double)idle_us) *
+                             INA219_SHOT_DEFAULT_SUPPLY_VOLTAGE / 1000000.0;
+                ina219_interface_debug_print("ina219: active %uus, idle %lluus, energy is %0.3fuJ per sample, %0.2f percent of continuous.\n",
+                                             active_us, (unsigned long long)idle_us, (double)nj / 1000.0,
+                                             (continuous > 0.0) ? (double)nj * 100.0 / continuous : 100.0);
+            }
             ina219_interface_delay_ms(1000);
         }
         
@@ -379,23 +3051,75 @@ uint8_t ina219(uint8_t argc, char **argv)
         ina219_interface_debug_print("  ina219 (-t reg | --test=reg) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
         ina219_interface_debug_print("  ina219 (-t read | --test=read) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
         ina219_interface_debug_print("         [--resistance=<r>] [--times=<num>]\n");
-        ina219_interface_debug_print("  ina219 (-e read | --example=read) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
+        ina219_interface_debug_print("  ina219 (-t bench | --test=bench) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
         ina219_interface_debug_print("         [--resistance=<r>] [--times=<num>]\n");
+        ina219_interface_debug_print("  ina219 (-t convert | --test=convert)\n");
+        ina219_interface_debug_print("  ina219 (-t alert | --test=alert) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
+        ina219_interface_debug_print("         [--resistance=<r>]\n");
+        ina219_interface_debug_print("  ina219 (-t histogram | --test=histogram)\n");
+        ina219_interface_debug_print("  ina219 (-t capture | --test=capture)\n");
+        ina219_interface_debug_print("  ina219 (-t series | --test=series) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
+        ina219_interface_debug_print("         [--resistance=<r>]\n");
+        ina219_interface_debug_print("  ina219 (-t warm | --test=warm) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
+        ina219_interface_debug_print("         [--resistance=<r>]\n");
+        ina219_interface_debug_print("  ina219 (-e read | --example=read) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
+        ina219_interface_debug_print("         [--resistance=<r>] [--times=<num>] [--output=<file>] [--rollup=<file>]\n");
+        ina219_interface_debug_print("         [--sync-time=<ms>] [--sync-size=<bytes>] [--format=<csv | ndjson>] [--warm=<file>]\n");
+        ina219_interface_debug_print("  ina219 (-e read | --example=read) --rate=<hz> [--duration=<s>] [--channels=<addr list>]\n");
+        ina219_interface_debug_print("         [--resistance=<r>] [--format=<csv | ndjson>] [--hyperperiod] [--only=<shunt | bus>]\n");
+        ina219_interface_debug_print("         [--output=<file>] [--sync-time=<ms>] [--sync-size=<bytes>]\n");
+        ina219_interface_debug_print("  ina219 (-e read | --example=read) --trigger [--channels=<addr list>] [--resistance=<r>] [--times=<num>]\n");
+        ina219_interface_debug_print("         [--format=<csv | ndjson>]\n");
+        ina219_interface_debug_print("  ina219 (-e read | --example=read) --topology=<device list> [--resistance=<r>] [--times=<num>]\n");
+        ina219_interface_debug_print("  ina219 (-e dump | --example=dump) --input=<file> [--start=<us>] [--stop=<us>]\n");
+        ina219_interface_debug_print("  ina219 (-e recover | --example=recover) --input=<file>\n");
+        ina219_interface_debug_print("  ina219 (-e query | --example=query) --rollup=<file> [--start=<us>] [--stop=<us>]\n");
+        ina219_interface_debug_print("  ina219 (-e serve | --example=serve) --socket=<path> [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
+        ina219_interface_debug_print("         [--resistance=<r>] [--times=<num>] [--warm=<file>]\n");
+        ina219_interface_debug_print("  ina219 (-e scan | --example=scan) [--bus=<n list>]\n");
         ina219_interface_debug_print("  ina219 (-e shot | --example=shot) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>]\n");
-        ina219_interface_debug_print("         [--resistance=<r>] [--times=<num>]\n");
+        ina219_interface_debug_print("         [--resistance=<r>] [--times=<num>] [--duty=<power-down | adc-off>]\n");
+        ina219_interface_debug_print("  ina219 <test | example> [--record=<file> | --replay=<file>] [--speed=<full | recorded>]\n");
+        ina219_interface_debug_print("  ina219 <test | example> [--shared=<us>]\n");
+        ina219_interface_debug_print("  ina219 <test | example> [--sim]\n");
         ina219_interface_debug_print("\n");
         ina219_interface_debug_print("Options:\n");
         ina219_interface_debug_print("      --addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B | C | D | E | F>\n");
         ina219_interface_debug_print("                                 Set the addr pin.([default: 0])\n");
-        ina219_interface_debug_print("  -e <read | shot>, --example=<read | shot>\n");
+        ina219_interface_debug_print("      --bus=<n list>             Set the iic adapters of the scan, for example 1,3.([default: 1])\n");
+        ina219_interface_debug_print("      --channels=<addr list>     Set the addr pins of the capture and their optional rates, for example 0:1000:0,1,A.([default: addr])\n");
+        ina219_interface_debug_print("      --duration=<s>             Set the capture time.([default: 10])\n");
+        ina219_interface_debug_print("      --duty=<power-down | adc-off>\n");
+        ina219_interface_debug_print("                                 Keep the chip idle between the shots and report the energy per sample.\n");
+        ina219_interface_debug_print("  -e <read | shot | dump | recover | query | serve | scan>, --example=<read | shot | dump | recover | query | serve | scan>\n");
         ina219_interface_debug_print("                                 Run the driver example.\n");
+        ina219_interface_debug_print("      --format=<csv | ndjson>    Print the samples as csv or ndjson rows.\n");
         ina219_interface_debug_print("  -h, --help                     Show the help.\n");
+        ina219_interface_debug_print("      --hyperperiod              Read the channel rates from a fixed frame table placed by priority.\n");
         ina219_interface_debug_print("  -i, --information              Show the chip information.\n");
+        ina219_interface_debug_print("      --input=<file>             Read the raw samples from a binary log file.\n");
+        ina219_interface_debug_print("      --only=<shunt | bus>       Convert and read only one register in the paced capture, the power is unavailable.\n");
+        ina219_interface_debug_print("      --output=<file>            Write the raw samples to a binary log file.\n");
+        ina219_interface_debug_print("      --rate=<hz>                Run a deadline paced capture and select the adc mode for the rate.\n");
+        ina219_interface_debug_print("      --record=<file>            Record all the iic transactions to a trace file.\n");
+        ina219_interface_debug_print("      --replay=<file>            Replay the iic transactions from a trace file without the chip.\n");
         ina219_interface_debug_print("  -p, --port                     Display the pin connections of the current board.\n");
         ina219_interface_debug_print("      --resistance=<r>           Set the sample resistance.([default: 0.1])\n");
-        ina219_interface_debug_print("  -t <reg | read>, --test=<reg | read>\n");
+        ina219_interface_debug_print("      --rollup=<file>            Keep the power history in a rollup store file.\n");
+        ina219_interface_debug_print("      --shared=<us>              Share the bus with other processes and merge the reads within us.\n");
+        ina219_interface_debug_print("      --sim                      Run on simulated chips with a virtual clock instead of the bus.\n");
+        ina219_interface_debug_print("      --socket=<path>            Serve the latest sample on a unix socket.\n");
+        ina219_interface_debug_print("      --speed=<full | recorded>  Set the replay speed.([default: full])\n");
+        ina219_interface_debug_print("      --start=<us>               Set the first dumped timestamp.([default: 0])\n");
+        ina219_interface_debug_print("      --stop=<us>                Set the last dumped timestamp.([default: end of the log])\n");
+        ina219_interface_debug_print("      --sync-size=<bytes>        Sync the output file after this many bytes.([default: 65536])\n");
+        ina219_interface_debug_print("      --sync-time=<ms>           Lose at most this many ms of the output file on a power cut.([default: 1000])\n");
+        ina219_interface_debug_print("  -t <reg | read | bench | convert | alert | histogram | capture | series | warm>, --test=<reg | read | bench | convert | alert | histogram | capture | series | warm>\n");
         ina219_interface_debug_print("                                 Run the driver test.\n");
         ina219_interface_debug_print("      --times=<num>              Set the running times.([default: 3])\n");
+        ina219_interface_debug_print("      --topology=<device list>   Set the devices behind the iic muxes, for example 70:0/0,71:2/72:3/A,5.\n");
+        ina219_interface_debug_print("      --trigger                  Start the conversions of all the channels at once and report the skew.\n");
+        ina219_interface_debug_print("      --warm=<file>              Skip the reset and the configuration when the chip matches the cache file.\n");
 
         return 0;
     }
@@ -444,6 +3168,26 @@ int main(uint8_t argc, char **argv)
     uint8_t res;
 
     res = ina219(argc, argv);
+    if ((a_ina219_trace_end() != 0) && (res == 0))
+    {
+        res = 1;
+    }
+    if (iic_arbiter_is_enabled() != 0)
+    {
+        uint32_t bus_num;
+        uint32_t merged_num;
+        
+        /* output the arbitration status */
+        iic_arbiter_get_status(&bus_num, &merged_num);
+        ina219_interface_debug_print("ina219: %u bus transactions, %u merged reads.\n", bus_num, merged_num);
+    }
+    if (ina219_sim_is_active() != 0)
+    {
+        /* output the simulator status */
+        (void)ina219_sim_stop();
+        ina219_interface_debug_print("ina219: %.3fs virtual time, %u reads, %u writes.\n",
+                                     (double)gs_sim.time / 1000000.0, gs_sim.read_num, gs_sim.write_num);
+    }
     if (res == 0)
     {
         /* run success */
@@ -812,6 +812,165 @@ uint8_t ina219_read_power(ina219_handle_t *handle, uint16_t *raw, float *mW)
     return 0;                                                                   /* success return 0 */
 }
 
+/**
+ * @brief      read all the measurement registers
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read sample failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the bus voltage register is stored unshifted with its status bits,
+ *             in the derived power mode the power register is only read when the math overflow bit is set
+ */
+uint8_t ina219_read_sample(ina219_handle_t *handle, ina219_sample_t *sample)
+{
+    uint8_t res;
+    uint16_t u;
+    
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    
+    res = a_ina219_iic_read(handle, INA219_REG_BUS_VOLTAGE, (uint16_t *)&u);            /* read bus voltage */
+    if (res != 0)                                                                       /* check result */
+    {
+        handle->debug_print("ina219: read bus voltage register failed.\n");             /* read bus voltage register failed */
+       
+        return 1;                                                                       /* return error */
+    }
+    sample->bus_voltage = u;                                                            /* set the bus voltage */
+    res = a_ina219_iic_read(handle, INA219_REG_SHUNT_VOLTAGE, (uint16_t *)&u);          /* read shunt voltage */
+    if (res != 0)                                                                       /* check result */
+    {
+        handle->debug_print("ina219: read shunt voltage register failed.\n");           /* read shunt voltage register failed */
+       
+        return 1;                                                                       /* return error */
+    }
+    sample->shunt_voltage = (int16_t)u;                                                 /* set the shunt voltage */
+    res = a_ina219_iic_read(handle, INA219_REG_CURRENT, (uint16_t *)&u);                /* read current */
+    if (res != 0)                                                                       /* check result */
+    {
+        handle->debug_print("ina219: read current register failed.\n");                 /* read current register failed */
+       
+        return 1;                                                                       /* return error */
+    }
+    sample->current = (int16_t)u;                                                       /* set the current */
+    if ((handle->power_mode == INA219_POWER_MODE_DERIVED) &&
+        ((sample->bus_voltage & (1 << 0)) == 0))                                        /* derive the power */
+    {
+        uint32_t i;
+        
+        i = (sample->current < 0) ? (uint32_t)(-(int32_t)sample->current) : 
+                                    (uint32_t)sample->current;                          /* get the abs current */
+        sample->power = (uint16_t)((i * (uint32_t)(sample->bus_voltage >> 3)) / 5000);  /* set the power */
+        
+        return 0;                                                                       /* success return 0 */
+    }
+    res = a_ina219_iic_read(handle, INA219_REG_POWER, (uint16_t *)&u);                  /* read power */
+    if (res != 0)                                                                       /* check result */
+    {
+        handle->debug_print("ina219: read power register failed.\n");                   /* read power register failed */
+       
+        return 1;                                                                       /* return error */
+    }
+    sample->power = u;                                                                  /* set the power */
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     set the power mode
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] mode power mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the derived mode no longer clears the conversion ready bit by reading the power register
+ */
+uint8_t ina219_set_power_mode(ina219_handle_t *handle, ina219_power_mode_t mode)
+{
+    if (handle == NULL)                                   /* check handle */
+    {
+        return 2;                                         /* return error */
+    }
+    if (handle->inited != 1)                              /* check handle initialization */
+    {
+        return 3;                                         /* return error */
+    }
+    
+    handle->power_mode = (uint8_t)mode;                   /* set the power mode */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the power mode
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *mode pointer to a power mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ina219_get_power_mode(ina219_handle_t *handle, ina219_power_mode_t *mode)
+{
+    if (handle == NULL)                                           /* check handle */
+    {
+        return 2;                                                 /* return error */
+    }
+    if (handle->inited != 1)                                      /* check handle initialization */
+    {
+        return 3;                                                 /* return error */
+    }
+    
+    *mode = (ina219_power_mode_t)(handle->power_mode);            /* get the power mode */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief      calculate the power from the current and bus voltage registers
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[in]  current_raw current register value
+ * @param[in]  bus_raw right shifted bus voltage register value
+ * @param[out] *raw pointer to raw data buffer
+ * @param[out] *mW pointer to converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       raw = |current_raw| * bus_raw / 5000, the same as the chip power register
+ */
+uint8_t ina219_calculate_power(ina219_handle_t *handle, int16_t current_raw, uint16_t bus_raw, uint16_t *raw, float *mW)
+{
+    uint32_t i;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    
+    i = (current_raw < 0) ? (uint32_t)(-(int32_t)current_raw) : 
+                            (uint32_t)current_raw;                                  /* get the abs current */
+    *raw = (uint16_t)((i * (uint32_t)(bus_raw & 0x1FFF)) / 5000);                   /* calculate like the chip */
+    *mW = (float)((double)(*raw) * handle->current_lsb * 20.0 * 1000.0);            /* set the converted data */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
 /**
  * @brief      get the calibration
  * @param[in]  *handle pointer to an ina219 handle structure
@@ -132,6 +132,15 @@ typedef enum
     INA219_MODE_SHUNT_BUS_VOLTAGE_CONTINUOUS = 0x7,        /**< shunt and bus voltage continuous */
 } ina219_mode_t;
 
+/**
+ * @brief ina219 power mode enumeration definition
+ */
+typedef enum
+{
+    INA219_POWER_MODE_REGISTER = 0x00,        /**< read the power register */
+    INA219_POWER_MODE_DERIVED  = 0x01,        /**< derive the power from the current and bus voltage registers */
+} ina219_power_mode_t;
+
 /**
  * @brief ina219 handle structure definition
  */
@@ -146,6 +155,7 @@ typedef struct ina219_handle_s
     void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
     double r;                                                                           /**< resistance */
     double current_lsb;                                                                 /**< current lsb */
+    uint8_t power_mode;                                                                 /**< power mode */
     uint8_t inited;                                                                     /**< inited flag */
 } ina219_handle_t;
 
@@ -165,6 +175,29 @@ typedef struct ina219_info_s
     uint32_t driver_version;           /**< driver version */
 } ina219_info_t;
 
+/**
+ * @brief ina219 sample structure definition
+ */
+typedef struct ina219_sample_s
+{
+    int16_t shunt_voltage;        /**< shunt voltage register, 10uV lsb */
+    uint16_t bus_voltage;         /**< bus voltage register, includes the cnvr and ovf bits */
+    int16_t current;              /**< current register, current_lsb */
+    uint16_t power;               /**< power register, 20 * current_lsb */
+} ina219_sample_t;
+
+/**
+ * @brief ina219 sample field enumeration definition
+ */
+typedef enum
+{
+    INA219_SAMPLE_FIELD_SHUNT_VOLTAGE = (1 << 0),        /**< shunt voltage is valid */
+    INA219_SAMPLE_FIELD_BUS_VOLTAGE   = (1 << 1),        /**< bus voltage is valid */
+    INA219_SAMPLE_FIELD_CURRENT       = (1 << 2),        /**< current is valid */
+    INA219_SAMPLE_FIELD_POWER         = (1 << 3),        /**< power is valid */
+    INA219_SAMPLE_FIELD_ALL           = 0x0F,            /**< all the fields are valid */
+} ina219_sample_field_t;
+
 /**
  * @}
  */
@@ -381,6 +414,59 @@ uint8_t ina219_read_current(ina219_handle_t *handle, int16_t *raw, float *mA);
  */
 uint8_t ina219_read_power(ina219_handle_t *handle, uint16_t *raw, float *mW);
 
+/**
+ * @brief      read all the measurement registers
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read sample failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the bus voltage register is stored unshifted with its status bits,
+ *             in the derived power mode the power register is only read when the math overflow bit is set
+ */
+uint8_t ina219_read_sample(ina219_handle_t *handle, ina219_sample_t *sample);
+
+/**
+ * @brief     set the power mode
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] mode power mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the derived mode no longer clears the conversion ready bit by reading the power register
+ */
+uint8_t ina219_set_power_mode(ina219_handle_t *handle, ina219_power_mode_t mode);
+
+/**
+ * @brief      get the power mode
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *mode pointer to a power mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ina219_get_power_mode(ina219_handle_t *handle, ina219_power_mode_t *mode);
+
+/**
+ * @brief      calculate the power from the current and bus voltage registers
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[in]  current_raw current register value
+ * @param[in]  bus_raw right shifted bus voltage register value
+ * @param[out] *raw pointer to raw data buffer
+ * @param[out] *mW pointer to converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       raw = |current_raw| * bus_raw / 5000, the same as the chip power register
+ */
+uint8_t ina219_calculate_power(ina219_handle_t *handle, int16_t current_raw, uint16_t bus_raw, uint16_t *raw, float *mW);
+
 /**
  * @brief     soft reset the chip
  * @param[in] *handle pointer to an ina219 handle structure
@@ -0,0 +1,404 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_alert.c
+ * @brief     driver ina219 alert source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_alert.h"
+#include <math.h>
+
+/**
+ * @brief     count the bits in the debounce window
+ * @param[in] history debounce window history
+ * @return    bits number
+ * @note      none
+ */
+static uint8_t a_ina219_alert_bits(uint32_t history)
+{
+    uint8_t cnt;
+    
+    cnt = 0;                                     /* init 0 */
+    while (history != 0)                         /* loop all set bits */
+    {
+        history &= history - 1;                  /* clear the lowest bit */
+        cnt++;                                   /* count */
+    }
+    
+    return cnt;                                  /* return the number */
+}
+
+/**
+ * @brief     initialize the alert engine
+ * @param[in] *alert pointer to an ina219 alert structure
+ * @param[in] *receive_callback pointer to a receive callback function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 alert is NULL
+ * @note      receive_callback can be NULL
+ */
+uint8_t ina219_alert_init(ina219_alert_t *alert, void (*receive_callback)(uint8_t index, ina219_alert_event_t event, int32_t raw))
+{
+    if (alert == NULL)                                     /* check alert */
+    {
+        return 2;                                          /* return error */
+    }
+    
+    memset(alert, 0, sizeof(ina219_alert_t));              /* clear the alert */
+    alert->receive_callback = receive_callback;            /* set the callback */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief      convert a value in mV, mA or mW to the raw register unit
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[in]  channel alert channel
+ * @param[in]  value converted value
+ * @param[out] *raw pointer to a raw value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 4 current lsb is invalid
+ *             - 7 param is invalid
+ * @note       the bus voltage raw value is the shifted register value,
+ *             the result is rounded to the nearest lsb
+ */
+uint8_t ina219_alert_convert_to_raw(ina219_handle_t *handle, ina219_alert_channel_t channel, double value, int32_t *raw)
+{
+    double lsb;
+    double r;
+    
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    
+    switch (channel)                                                   /* select the channel */
+    {
+        case INA219_ALERT_CHANNEL_SHUNT_VOLTAGE :
+        {
+            lsb = 0.01;                                                /* 10uV */
+            
+            break;
+        }
+        case INA219_ALERT_CHANNEL_BUS_VOLTAGE :
+        {
+            lsb = 4.0;                                                 /* 4mV */
+            
+            break;
+        }
+        case INA219_ALERT_CHANNEL_CURRENT :
+        {
+            lsb = handle->current_lsb * 1000.0;                        /* current lsb in mA */
+            
+            break;
+        }
+        case INA219_ALERT_CHANNEL_POWER :
+        {
+            lsb = handle->current_lsb * 20.0 * 1000.0;                 /* power lsb in mW */
+            
+            break;
+        }
+        default :
+        {
+            return 7;                                                  /* return error */
+        }
+    }
+    if (lsb <= 0.0)                                                    /* check the lsb */
+    {
+        return 4;                                                      /* return error */
+    }
+    
+    r = floor(value / lsb + 0.5);                                      /* round to the nearest lsb */
+    if (r > 2147483647.0)                                              /* check the max */
+    {
+        r = 2147483647.0;                                              /* set the max */
+    }
+    if (r < -2147483647.0)                                             /* check the min */
+    {
+        r = -2147483647.0;                                             /* set the min */
+    }
+    *raw = (int32_t)r;                                                 /* set the raw */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      add an alert rule
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[in]  *alert pointer to an ina219 alert structure
+ * @param[in]  channel alert channel
+ * @param[in]  type alert type
+ * @param[in]  limit alert limit in mV, mA or mW
+ * @param[in]  hysteresis release distance from the limit in mV, mA or mW
+ * @param[in]  n debounce hits
+ * @param[in]  m debounce window
+ * @param[out] *index pointer to a rule index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle, alert or index is NULL
+ *             - 3 handle is not initialized
+ *             - 4 current lsb is invalid
+ *             - 5 rule table is full
+ *             - 6 debounce is invalid
+ *             - 7 param is invalid
+ * @note       the limits are converted with the current calibration of the handle,
+ *             so call it again after the calibration is changed
+ *             the rate limit is the change per sample
+ *             hysteresis < limit for a rate rule and for an over rule of the bus voltage or the power,
+ *             whose values are never negative
+ *             1 <= n <= m <= 32
+ */
+uint8_t ina219_alert_add_rule(ina219_handle_t *handle, ina219_alert_t *alert,
+                              ina219_alert_channel_t channel, ina219_alert_type_t type,
+                              double limit, double hysteresis, uint8_t n, uint8_t m, uint8_t *index)
+{
+    uint8_t res;
+    int32_t raw_limit;
+    int32_t raw_release;
+    ina219_alert_rule_t *rule;
+    
+    if ((handle == NULL) || (alert == NULL) || (index == NULL))                       /* check handle, alert and index */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (alert->rule_num >= INA219_ALERT_MAX_RULE)                                     /* check the rule number */
+    {
+        handle->debug_print("ina219: rule table is full.\n");                         /* rule table is full */
+        
+        return 5;                                                                     /* return error */
+    }
+    if ((n == 0) || (n > m) || (m > 32))                                              /* check the debounce */
+    {
+        handle->debug_print("ina219: debounce is invalid.\n");                        /* debounce is invalid */
+        
+        return 6;                                                                     /* return error */
+    }
+    if ((type > INA219_ALERT_TYPE_RATE) || (hysteresis < 0.0))                        /* check the type and hysteresis */
+    {
+        handle->debug_print("ina219: param is invalid.\n");                           /* param is invalid */
+        
+        return 7;                                                                     /* return error */
+    }
+    if ((type == INA219_ALERT_TYPE_RATE) && (limit < 0.0))                            /* check the rate limit */
+    {
+        handle->debug_print("ina219: param is invalid.\n");                           /* param is invalid */
+        
+        return 7;                                                                     /* return error */
+    }
+    if (((type == INA219_ALERT_TYPE_RATE) ||
+        ((type == INA219_ALERT_TYPE_OVER) && ((channel == INA219_ALERT_CHANNEL_BUS_VOLTAGE) ||
+        (channel == INA219_ALERT_CHANNEL_POWER)))) && (hysteresis >= limit))         /* check the release level */
+    {
+        handle->debug_print("ina219: hysteresis is invalid.\n");                      /* hysteresis is invalid */
+        
+        return 7;                                                                     /* return error */
+    }
+    
+    res = ina219_alert_convert_to_raw(handle, channel, limit, &raw_limit);            /* convert the limit */
+    if (res != 0)                                                                     /* check the result */
+    {
+        handle->debug_print("ina219: convert limit failed.\n");                       /* convert limit failed */
+        
+        return res;                                                                   /* return error */
+    }
+    if (type == INA219_ALERT_TYPE_UNDER)                                              /* under */
+    {
+        res = ina219_alert_convert_to_raw(handle, channel,
+                                          limit + hysteresis, &raw_release);          /* release above the limit */
+    }
+    else                                                                              /* over or rate */
+    {
+        res = ina219_alert_convert_to_raw(handle, channel,
+                                          limit - hysteresis, &raw_release);          /* release below the limit */
+    }
+    if (res != 0)                                                                     /* check the result */
+    {
+        handle->debug_print("ina219: convert hysteresis failed.\n");                  /* convert hysteresis failed */
+        
+        return res;                                                                   /* return error */
+    }
+    
+    rule = &alert->rule[alert->rule_num];                                             /* get the rule */
+    memset(rule, 0, sizeof(ina219_alert_rule_t));                                     /* clear the rule */
+    rule->enable = 1;                                                                 /* enable */
+    rule->channel = (uint8_t)channel;                                                 /* set the channel */
+    rule->type = (uint8_t)type;                                                       /* set the type */
+    rule->n = n;                                                                      /* set the hits */
+    rule->m = m;                                                                      /* set the window */
+    rule->limit = raw_limit;                                                          /* set the limit */
+    rule->release = raw_release;                                                      /* set the release */
+    *index = alert->rule_num;                                                         /* set the index */
+    alert->rule_num++;                                                                /* rule number++ */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable an alert rule
+ * @param[in] *alert pointer to an ina219 alert structure
+ * @param[in] index rule index
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 alert is NULL
+ *            - 4 index is invalid
+ * @note      disabling a rule resets its state
+ */
+uint8_t ina219_alert_set_rule_enable(ina219_alert_t *alert, uint8_t index, uint8_t enable)
+{
+    if (alert == NULL)                                      /* check alert */
+    {
+        return 2;                                           /* return error */
+    }
+    if (index >= alert->rule_num)                           /* check the index */
+    {
+        return 4;                                           /* return error */
+    }
+    
+    alert->rule[index].enable = (enable != 0) ? 1 : 0;      /* set enable */
+    alert->rule[index].active = 0;                          /* clear active */
+    alert->rule[index].history = 0;                         /* clear history */
+    alert->rule[index].last_valid = 0;                      /* clear last */
+    
+    return 0;                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the alert rule state
+ * @param[in]  *alert pointer to an ina219 alert structure
+ * @param[in]  index rule index
+ * @param[out] *active pointer to an active flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 alert is NULL
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t ina219_alert_get_rule_state(ina219_alert_t *alert, uint8_t index, uint8_t *active)
+{
+    if (alert == NULL)                              /* check alert */
+    {
+        return 2;                                   /* return error */
+    }
+    if (index >= alert->rule_num)                   /* check the index */
+    {
+        return 4;                                   /* return error */
+    }
+    
+    *active = alert->rule[index].active;            /* get active */
+    
+    return 0;                                       /* success return 0 */
+}
+
+/**
+ * @brief     evaluate all rules with a sample
+ * @param[in] *alert pointer to an ina219 alert structure
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 alert is NULL
+ * @note      only integer operations are used
+ */
+uint8_t ina219_alert_update(ina219_alert_t *alert, const ina219_sample_t *sample)
+{
+    uint8_t i;
+    uint8_t cond;
+    int32_t value[4];
+    int32_t v;
+    uint32_t mask;
+    ina219_alert_rule_t *rule;
+    
+    if ((alert == NULL) || (sample == NULL))                                              /* check alert and sample */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    value[INA219_ALERT_CHANNEL_SHUNT_VOLTAGE] = (int32_t)sample->shunt_voltage;           /* shunt voltage */
+    value[INA219_ALERT_CHANNEL_BUS_VOLTAGE] = (int32_t)(sample->bus_voltage >> 3);        /* bus voltage */
+    value[INA219_ALERT_CHANNEL_CURRENT] = (int32_t)sample->current;                       /* current */
+    value[INA219_ALERT_CHANNEL_POWER] = (int32_t)sample->power;                           /* power */
+    for (i = 0; i < alert->rule_num; i++)                                                 /* loop all rules */
+    {
+        rule = &alert->rule[i];                                                           /* get the rule */
+        if (rule->enable == 0)                                                            /* check enable */
+        {
+            continue;                                                                     /* skip */
+        }
+        
+        v = value[rule->channel];                                                         /* get the value */
+        if (rule->type == INA219_ALERT_TYPE_RATE)                                         /* rate */
+        {
+            int32_t d;
+            
+            if (rule->last_valid == 0)                                                    /* first sample */
+            {
+                rule->last = v;                                                           /* save the value */
+                rule->last_valid = 1;                                                     /* set valid */
+                
+                continue;                                                                 /* wait next sample */
+            }
+            d = v - rule->last;                                                           /* get the change */
+            d = (d < 0) ? -d : d;                                                         /* abs */
+            rule->last = v;                                                               /* save the value */
+            v = d;                                                                        /* compare the change */
+        }
+        if (rule->type == INA219_ALERT_TYPE_UNDER)                                        /* under */
+        {
+            cond = (rule->active == 0) ? (v < rule->limit) : (v >= rule->release);        /* assert or release condition */
+        }
+        else                                                                              /* over or rate */
+        {
+            cond = (rule->active == 0) ? (v > rule->limit) : (v <= rule->release);        /* assert or release condition */
+        }
+        
+        mask = (rule->m >= 32) ? 0xFFFFFFFFU : ((1UL << rule->m) - 1);                    /* window mask */
+        rule->history = ((rule->history << 1) | cond) & mask;                             /* shift in the condition */
+        if (a_ina219_alert_bits(rule->history) >= rule->n)                                /* n of m */
+        {
+            rule->active = (rule->active == 0) ? 1 : 0;                                   /* toggle the state */
+            rule->history = 0;                                                            /* restart the window */
+            if (alert->receive_callback != NULL)                                          /* check the callback */
+            {
+                alert->receive_callback(i, (rule->active != 0) ? INA219_ALERT_EVENT_ASSERT :
+                                        INA219_ALERT_EVENT_CLEAR, v);                     /* run the callback */
+            }
+        }
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
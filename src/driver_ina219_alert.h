@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_alert.h
+ * @brief     driver ina219 alert header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_ALERT_H
+#define DRIVER_INA219_ALERT_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_alert_driver ina219 alert driver function
+ * @brief    ina219 alert driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 alert max rule definition
+ */
+#ifndef INA219_ALERT_MAX_RULE
+    #define INA219_ALERT_MAX_RULE 8        /**< 8 rules */
+#endif
+
+/**
+ * @brief ina219 alert channel enumeration definition
+ */
+typedef enum
+{
+    INA219_ALERT_CHANNEL_SHUNT_VOLTAGE = 0x00,        /**< shunt voltage channel, limit in mV */
+    INA219_ALERT_CHANNEL_BUS_VOLTAGE   = 0x01,        /**< bus voltage channel, limit in mV */
+    INA219_ALERT_CHANNEL_CURRENT       = 0x02,        /**< current channel, limit in mA */
+    INA219_ALERT_CHANNEL_POWER         = 0x03,        /**< power channel, limit in mW */
+} ina219_alert_channel_t;
+
+/**
+ * @brief ina219 alert type enumeration definition
+ */
+typedef enum
+{
+    INA219_ALERT_TYPE_OVER  = 0x00,        /**< value is over the limit */
+    INA219_ALERT_TYPE_UNDER = 0x01,        /**< value is under the limit */
+    INA219_ALERT_TYPE_RATE  = 0x02,        /**< change between two samples is over the limit */
+} ina219_alert_type_t;
+
+/**
+ * @brief ina219 alert event enumeration definition
+ */
+typedef enum
+{
+    INA219_ALERT_EVENT_CLEAR  = 0x00,        /**< alert is cleared */
+    INA219_ALERT_EVENT_ASSERT = 0x01,        /**< alert is asserted */
+} ina219_alert_event_t;
+
+/**
+ * @brief ina219 alert rule structure definition
+ */
+typedef struct ina219_alert_rule_s
+{
+    uint8_t enable;             /**< enable flag */
+    uint8_t channel;            /**< alert channel */
+    uint8_t type;               /**< alert type */
+    uint8_t active;             /**< alert active flag */
+    uint8_t n;                  /**< debounce hits */
+    uint8_t m;                  /**< debounce window */
+    uint8_t last_valid;         /**< last value valid flag */
+    int32_t limit;              /**< raw limit */
+    int32_t release;            /**< raw release level */
+    int32_t last;               /**< last raw value */
+    uint32_t history;           /**< debounce window history */
+} ina219_alert_rule_t;
+
+/**
+ * @brief ina219 alert structure definition
+ */
+typedef struct ina219_alert_s
+{
+    ina219_alert_rule_t rule[INA219_ALERT_MAX_RULE];                                      /**< rule table */
+    uint8_t rule_num;                                                                     /**< rule number */
+    void (*receive_callback)(uint8_t index, ina219_alert_event_t event, int32_t raw);     /**< point to a receive_callback function address */
+} ina219_alert_t;
+
+/**
+ * @brief     initialize the alert engine
+ * @param[in] *alert pointer to an ina219 alert structure
+ * @param[in] *receive_callback pointer to a receive callback function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 alert is NULL
+ * @note      receive_callback can be NULL
+ */
+uint8_t ina219_alert_init(ina219_alert_t *alert, void (*receive_callback)(uint8_t index, ina219_alert_event_t event, int32_t raw));
+
+/**
+ * @brief      convert a value in mV, mA or mW to the raw register unit
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[in]  channel alert channel
+ * @param[in]  value converted value
+ * @param[out] *raw pointer to a raw value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 4 current lsb is invalid
+ *             - 7 param is invalid
+ * @note       the bus voltage raw value is the shifted register value,
+ *             the result is rounded to the nearest lsb
+ */
+uint8_t ina219_alert_convert_to_raw(ina219_handle_t *handle, ina219_alert_channel_t channel, double value, int32_t *raw);
+
+/**
+ * @brief      add an alert rule
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[in]  *alert pointer to an ina219 alert structure
+ * @param[in]  channel alert channel
+ * @param[in]  type alert type
+ * @param[in]  limit alert limit in mV, mA or mW
+ * @param[in]  hysteresis release distance from the limit in mV, mA or mW
+ * @param[in]  n debounce hits
+ * @param[in]  m debounce window
+ * @param[out] *index pointer to a rule index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle, alert or index is NULL
+ *             - 3 handle is not initialized
+ *             - 4 current lsb is invalid
+ *             - 5 rule table is full
+ *             - 6 debounce is invalid
+ *             - 7 param is invalid
+ * @note       the limits are converted with the current calibration of the handle,
+ *             so call it again after the calibration is changed
+ *             the rate limit is the change per sample
+ *             hysteresis < limit for a rate rule and for an over rule of the bus voltage or the power,
+ *             whose values are never negative
+ *             1 <= n <= m <= 32
+ */
+uint8_t ina219_alert_add_rule(ina219_handle_t *handle, ina219_alert_t *alert,
+                              ina219_alert_channel_t channel, ina219_alert_type_t type,
+                              double limit, double hysteresis, uint8_t n, uint8_t m, uint8_t *index);
+
+/**
+ * @brief     enable or disable an alert rule
+ * @param[in] *alert pointer to an ina219 alert structure
+ * @param[in] index rule index
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 alert is NULL
+ *            - 4 index is invalid
+ * @note      disabling a rule resets its state
+ */
+uint8_t ina219_alert_set_rule_enable(ina219_alert_t *alert, uint8_t index, uint8_t enable);
+
+/**
+ * @brief      get the alert rule state
+ * @param[in]  *alert pointer to an ina219 alert structure
+ * @param[in]  index rule index
+ * @param[out] *active pointer to an active flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 alert is NULL
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t ina219_alert_get_rule_state(ina219_alert_t *alert, uint8_t index, uint8_t *active);
+
+/**
+ * @brief     evaluate all rules with a sample
+ * @param[in] *alert pointer to an ina219 alert structure
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 alert is NULL
+ * @note      only integer operations are used
+ */
+uint8_t ina219_alert_update(ina219_alert_t *alert, const ina219_sample_t *sample);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,432 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_capture.c
+ * @brief     driver ina219 capture source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_capture.h"
+
+/**
+ * @brief     get the raw channel value of a sample
+ * @param[in] *sample pointer to a raw sample structure
+ * @param[in] channel alert channel
+ * @return    raw value
+ * @note      none
+ */
+static int32_t a_ina219_capture_value(const ina219_sample_t *sample, uint8_t channel)
+{
+    switch (channel)                                                /* select the channel */
+    {
+        case INA219_ALERT_CHANNEL_SHUNT_VOLTAGE :
+        {
+            return (int32_t)sample->shunt_voltage;                  /* shunt voltage */
+        }
+        case INA219_ALERT_CHANNEL_BUS_VOLTAGE :
+        {
+            return (int32_t)(sample->bus_voltage >> 3);             /* bus voltage */
+        }
+        case INA219_ALERT_CHANNEL_CURRENT :
+        {
+            return (int32_t)sample->current;                        /* current */
+        }
+        default :
+        {
+            return (int32_t)sample->power;                          /* power */
+        }
+    }
+}
+
+/**
+ * @brief     reverse a part of the ring buffer
+ * @param[in] *buf pointer to an entry buffer
+ * @param[in] start start position
+ * @param[in] end end position, not included
+ * @note      none
+ */
+static void a_ina219_capture_reverse(ina219_capture_entry_t *buf, uint32_t start, uint32_t end)
+{
+    ina219_capture_entry_t t;
+    
+    while ((start + 1) < end)                    /* loop the range */
+    {
+        end--;                                   /* end-- */
+        t = buf[start];                          /* swap */
+        buf[start] = buf[end];                   /* swap */
+        buf[end] = t;                            /* swap */
+        start++;                                 /* start++ */
+    }
+}
+
+/**
+ * @brief     freeze the capture
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @note      the ring is rotated in place so that the oldest entry is first
+ */
+static void a_ina219_capture_freeze(ina219_capture_t *capture)
+{
+    uint32_t oldest;
+    
+    oldest = (capture->head + capture->len - capture->count) % capture->len;        /* get the oldest entry */
+    if (oldest != 0)                                                                /* check the position */
+    {
+        a_ina219_capture_reverse(capture->buf, 0, oldest);                          /* reverse the first part */
+        a_ina219_capture_reverse(capture->buf, oldest, capture->len);               /* reverse the second part */
+        a_ina219_capture_reverse(capture->buf, 0, capture->len);                    /* reverse all */
+    }
+    capture->head = capture->count % capture->len;                                  /* update the head */
+    capture->state = INA219_CAPTURE_STATE_DONE;                                     /* set done */
+}
+
+/**
+ * @brief     commit the entry at the head
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @note      none
+ */
+static void a_ina219_capture_commit(ina219_capture_t *capture)
+{
+    ina219_capture_entry_t *entry;
+    uint8_t fire;
+    
+    entry = &capture->buf[capture->head];                                           /* get the entry */
+    capture->head = (capture->head + 1) % capture->len;                             /* head++ */
+    if (capture->count < capture->len)                                              /* check the count */
+    {
+        capture->count++;                                                           /* count++ */
+    }
+    
+    if (capture->state == INA219_CAPTURE_STATE_ARMED)                               /* armed */
+    {
+        fire = 0;                                                                   /* init 0 */
+        if (capture->trigger_enable != 0)                                           /* check the trigger */
+        {
+            int32_t v;
+            
+            v = a_ina219_capture_value(&entry->sample, capture->trigger_channel);  /* get the value */
+            if (capture->trigger_type == INA219_ALERT_TYPE_OVER)                    /* over */
+            {
+                fire = (v > capture->trigger_limit) ? 1 : 0;                        /* check the limit */
+            }
+            else if (capture->trigger_type == INA219_ALERT_TYPE_UNDER)              /* under */
+            {
+                fire = (v < capture->trigger_limit) ? 1 : 0;                        /* check the limit */
+            }
+            else                                                                    /* slope */
+            {
+                int32_t d;
+                
+                d = v - capture->last;                                              /* get the change */
+                d = (d < 0) ? -d : d;                                               /* abs */
+                fire = ((capture->last_valid != 0) &&
+                        (d > capture->trigger_limit)) ? 1 : 0;                      /* check the limit */
+                capture->last = v;                                                  /* save the value */
+                capture->last_valid = 1;                                            /* set valid */
+            }
+        }
+        if (fire != 0)                                                              /* fire */
+        {
+            capture->state = INA219_CAPTURE_STATE_TRIGGERED;                        /* set triggered */
+            capture->remain = capture->post;                                        /* set the remain */
+            if (capture->remain == 0)                                               /* no post trigger */
+            {
+                a_ina219_capture_freeze(capture);                                   /* freeze */
+            }
+        }
+    }
+    else                                                                            /* triggered */
+    {
+        capture->remain--;                                                          /* remain-- */
+        if (capture->remain == 0)                                                   /* check the remain */
+        {
+            a_ina219_capture_freeze(capture);                                       /* freeze */
+        }
+    }
+}
+
+/**
+ * @brief     initialize the capture
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @param[in] *buf pointer to a preallocated entry buffer
+ * @param[in] len entry buffer length
+ * @param[in] pre pre trigger entries
+ * @param[in] post post trigger entries
+ * @return    status code
+ *            - 0 success
+ *            - 2 capture or buf is NULL
+ *            - 4 buffer is too small
+ * @note      len >= pre + 1 + post, the capture is armed after init
+ */
+uint8_t ina219_capture_init(ina219_capture_t *capture, ina219_capture_entry_t *buf, uint32_t len, uint32_t pre, uint32_t post)
+{
+    if ((capture == NULL) || (buf == NULL))                                 /* check capture and buf */
+    {
+        return 2;                                                           /* return error */
+    }
+    if ((pre >= len) || (post >= (len - pre)))                             /* check the length */
+    {
+        return 4;                                                           /* return error */
+    }
+    
+    memset(capture, 0, sizeof(ina219_capture_t));                          /* clear the capture */
+    capture->buf = buf;                                                     /* set the buffer */
+    capture->len = pre + 1 + post;                                          /* set the length */
+    capture->pre = pre;                                                     /* set the pre */
+    capture->post = post;                                                   /* set the post */
+    capture->state = INA219_CAPTURE_STATE_ARMED;                            /* set armed */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the trigger condition
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @param[in] channel trigger channel
+ * @param[in] type trigger type
+ * @param[in] limit trigger limit in mV, mA or mW
+ * @return    status code
+ *            - 0 success
+ *            - 1 convert limit failed
+ *            - 2 handle or capture is NULL
+ * @note      the rate type is a slope trigger, the limit is the change per sample
+ */
+uint8_t ina219_capture_set_trigger(ina219_handle_t *handle, ina219_capture_t *capture,
+                                   ina219_alert_channel_t channel, ina219_alert_type_t type, double limit)
+{
+    uint8_t res;
+    int32_t raw;
+    
+    if ((handle == NULL) || (capture == NULL))                              /* check handle and capture */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (type > INA219_ALERT_TYPE_RATE)                                      /* check the type */
+    {
+        handle->debug_print("ina219: type is invalid.\n");                  /* type is invalid */
+        
+        return 1;                                                           /* return error */
+    }
+    
+    res = ina219_alert_convert_to_raw(handle, channel, limit, &raw);        /* convert the limit */
+    if (res != 0)                                                           /* check the result */
+    {
+        handle->debug_print("ina219: convert limit failed.\n");             /* convert limit failed */
+        
+        return 1;                                                           /* return error */
+    }
+    capture->trigger_channel = (uint8_t)channel;                            /* set the channel */
+    capture->trigger_type = (uint8_t)type;                                  /* set the type */
+    capture->trigger_limit = raw;                                           /* set the limit */
+    capture->last_valid = 0;                                                /* clear the last */
+    capture->trigger_enable = 1;                                            /* enable */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     re-arm the capture
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 capture is NULL
+ * @note      the previous capture is dropped
+ */
+uint8_t ina219_capture_arm(ina219_capture_t *capture)
+{
+    if (capture == NULL)                                      /* check capture */
+    {
+        return 2;                                             /* return error */
+    }
+    
+    capture->head = 0;                                        /* reset the head */
+    capture->count = 0;                                       /* reset the count */
+    capture->remain = 0;                                      /* reset the remain */
+    capture->last_valid = 0;                                  /* clear the last */
+    capture->state = INA219_CAPTURE_STATE_ARMED;              /* set armed */
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief     trigger the capture from outside
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 capture is NULL
+ *            - 4 capture is not armed
+ * @note      the latest pushed entry becomes the trigger entry
+ */
+uint8_t ina219_capture_trigger(ina219_capture_t *capture)
+{
+    if (capture == NULL)                                                  /* check capture */
+    {
+        return 2;                                                         /* return error */
+    }
+    if ((capture->state != INA219_CAPTURE_STATE_ARMED) ||
+        (capture->count == 0))                                            /* check the state */
+    {
+        return 4;                                                         /* return error */
+    }
+    
+    capture->state = INA219_CAPTURE_STATE_TRIGGERED;                      /* set triggered */
+    capture->remain = capture->post;                                      /* set the remain */
+    if (capture->remain == 0)                                             /* no post trigger */
+    {
+        a_ina219_capture_freeze(capture);                                 /* freeze */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     push a sample into the capture
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @param[in] timestamp user timestamp
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 capture or sample is NULL
+ * @note      samples pushed after the capture is done are ignored
+ */
+uint8_t ina219_capture_push(ina219_capture_t *capture, uint32_t timestamp, const ina219_sample_t *sample)
+{
+    if ((capture == NULL) || (sample == NULL))                            /* check capture and sample */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (capture->state == INA219_CAPTURE_STATE_DONE)                      /* check the state */
+    {
+        return 0;                                                         /* success return 0 */
+    }
+    
+    capture->buf[capture->head].timestamp = timestamp;                    /* set the timestamp */
+    capture->buf[capture->head].sample = *sample;                         /* set the sample */
+    a_ina219_capture_commit(capture);                                     /* commit */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     read a sample from the chip into the capture
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @param[in] timestamp user timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 read sample failed
+ *            - 2 handle or capture is NULL
+ *            - 3 handle is not initialized
+ * @note      the registers are read straight into the ring entry
+ */
+uint8_t ina219_capture_read(ina219_handle_t *handle, ina219_capture_t *capture, uint32_t timestamp)
+{
+    uint8_t res;
+    
+    if ((handle == NULL) || (capture == NULL))                                        /* check handle and capture */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (capture->state == INA219_CAPTURE_STATE_DONE)                                  /* check the state */
+    {
+        return 0;                                                                     /* success return 0 */
+    }
+    
+    if (capture->count == capture->len)                                               /* the oldest entry is overwritten */
+    {
+        capture->count--;                                                             /* drop the oldest entry */
+    }
+    res = ina219_read_sample(handle, &capture->buf[capture->head].sample);            /* read into the ring */
+    if (res != 0)                                                                     /* check the result */
+    {
+        return 1;                                                                     /* return error */
+    }
+    capture->buf[capture->head].timestamp = timestamp;                                /* set the timestamp */
+    a_ina219_capture_commit(capture);                                                 /* commit */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the capture state
+ * @param[in]  *capture pointer to an ina219 capture structure
+ * @param[out] *state pointer to a capture state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 capture is NULL
+ * @note       none
+ */
+uint8_t ina219_capture_get_state(ina219_capture_t *capture, ina219_capture_state_t *state)
+{
+    if (capture == NULL)                                              /* check capture */
+    {
+        return 2;                                                     /* return error */
+    }
+    
+    *state = (ina219_capture_state_t)(capture->state);                /* get the state */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the frozen capture
+ * @param[in]  *capture pointer to an ina219 capture structure
+ * @param[out] **entry pointer to an entry pointer buffer
+ * @param[out] *len pointer to an entry number buffer
+ * @param[out] *trigger_index pointer to a trigger index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 capture is NULL
+ *             - 4 capture is not done
+ * @note       the entries are ordered oldest first in the user buffer,
+ *             they stay valid until the capture is re-armed
+ */
+uint8_t ina219_capture_get(ina219_capture_t *capture, ina219_capture_entry_t **entry, uint32_t *len, uint32_t *trigger_index)
+{
+    if (capture == NULL)                                              /* check capture */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (capture->state != INA219_CAPTURE_STATE_DONE)                  /* check the state */
+    {
+        return 4;                                                     /* return error */
+    }
+    
+    *entry = capture->buf;                                            /* set the entry */
+    *len = capture->count;                                            /* set the length */
+    *trigger_index = capture->count - 1 - capture->post;              /* set the trigger index */
+    
+    return 0;                                                         /* success return 0 */
+}
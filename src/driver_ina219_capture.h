@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_capture.h
+ * @brief     driver ina219 capture header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_CAPTURE_H
+#define DRIVER_INA219_CAPTURE_H
+
+#include "driver_ina219_alert.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_capture_driver ina219 capture driver function
+ * @brief    ina219 capture driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 capture state enumeration definition
+ */
+typedef enum
+{
+    INA219_CAPTURE_STATE_ARMED     = 0x00,        /**< filling the pre trigger ring */
+    INA219_CAPTURE_STATE_TRIGGERED = 0x01,        /**< collecting the post trigger samples */
+    INA219_CAPTURE_STATE_DONE      = 0x02,        /**< capture is frozen */
+} ina219_capture_state_t;
+
+/**
+ * @brief ina219 capture entry structure definition
+ */
+typedef struct ina219_capture_entry_s
+{
+    uint32_t timestamp;           /**< user timestamp */
+    ina219_sample_t sample;       /**< raw sample */
+} ina219_capture_entry_t;
+
+/**
+ * @brief ina219 capture structure definition
+ */
+typedef struct ina219_capture_s
+{
+    ina219_capture_entry_t *buf;        /**< ring buffer */
+    uint32_t len;                       /**< ring length, pre + 1 + post */
+    uint32_t pre;                       /**< pre trigger entries */
+    uint32_t post;                      /**< post trigger entries */
+    uint32_t head;                      /**< next write position */
+    uint32_t count;                     /**< valid entries */
+    uint32_t remain;                    /**< remaining post trigger entries */
+    uint8_t state;                      /**< capture state */
+    uint8_t trigger_enable;             /**< trigger enable flag */
+    uint8_t trigger_channel;            /**< trigger channel */
+    uint8_t trigger_type;               /**< trigger type */
+    uint8_t last_valid;                 /**< last value valid flag */
+    int32_t trigger_limit;              /**< raw trigger limit */
+    int32_t last;                       /**< last raw value */
+} ina219_capture_t;
+
+/**
+ * @brief     initialize the capture
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @param[in] *buf pointer to a preallocated entry buffer
+ * @param[in] len entry buffer length
+ * @param[in] pre pre trigger entries
+ * @param[in] post post trigger entries
+ * @return    status code
+ *            - 0 success
+ *            - 2 capture or buf is NULL
+ *            - 4 buffer is too small
+ * @note      len >= pre + 1 + post, the capture is armed after init
+ */
+uint8_t ina219_capture_init(ina219_capture_t *capture, ina219_capture_entry_t *buf, uint32_t len, uint32_t pre, uint32_t post);
+
+/**
+ * @brief     set the trigger condition
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @param[in] channel trigger channel
+ * @param[in] type trigger type
+ * @param[in] limit trigger limit in mV, mA or mW
+ * @return    status code
+ *            - 0 success
+ *            - 1 convert limit failed
+ *            - 2 handle or capture is NULL
+ * @note      the rate type is a slope trigger, the limit is the change per sample
+ */
+uint8_t ina219_capture_set_trigger(ina219_handle_t *handle, ina219_capture_t *capture,
+                                   ina219_alert_channel_t channel, ina219_alert_type_t type, double limit);
+
+/**
+ * @brief     re-arm the capture
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 capture is NULL
+ * @note      the previous capture is dropped
+ */
+uint8_t ina219_capture_arm(ina219_capture_t *capture);
+
+/**
+ * @brief     trigger the capture from outside
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 capture is NULL
+ *            - 4 capture is not armed
+ * @note      the latest pushed entry becomes the trigger entry
+ */
+uint8_t ina219_capture_trigger(ina219_capture_t *capture);
+
+/**
+ * @brief     push a sample into the capture
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @param[in] timestamp user timestamp
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 capture or sample is NULL
+ * @note      samples pushed after the capture is done are ignored
+ */
+uint8_t ina219_capture_push(ina219_capture_t *capture, uint32_t timestamp, const ina219_sample_t *sample);
+
+/**
+ * @brief     read a sample from the chip into the capture
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] *capture pointer to an ina219 capture structure
+ * @param[in] timestamp user timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 read sample failed
+ *            - 2 handle or capture is NULL
+ *            - 3 handle is not initialized
+ * @note      the registers are read straight into the ring entry
+ */
+uint8_t ina219_capture_read(ina219_handle_t *handle, ina219_capture_t *capture, uint32_t timestamp);
+
+/**
+ * @brief      get the capture state
+ * @param[in]  *capture pointer to an ina219 capture structure
+ * @param[out] *state pointer to a capture state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 capture is NULL
+ * @note       none
+ */
+uint8_t ina219_capture_get_state(ina219_capture_t *capture, ina219_capture_state_t *state);
+
+/**
+ * @brief      get the frozen capture
+ * @param[in]  *capture pointer to an ina219 capture structure
+ * @param[out] **entry pointer to an entry pointer buffer
+ * @param[out] *len pointer to an entry number buffer
+ * @param[out] *trigger_index pointer to a trigger index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 capture is NULL
+ *             - 4 capture is not done
+ * @note       the entries are ordered oldest first in the user buffer,
+ *             they stay valid until the capture is re-armed
+ */
+uint8_t ina219_capture_get(ina219_capture_t *capture, ina219_capture_entry_t **entry, uint32_t *len, uint32_t *trigger_index);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
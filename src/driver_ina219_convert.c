@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_convert.c
+ * @brief     driver ina219 convert source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_convert.h"
+#include <math.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief     convert a signed register array to a float array
+ * @param[in] *in pointer to a register array
+ * @param[in] *out pointer to a float array
+ * @param[in] len array length
+ * @param[in] scale lsb scale
+ * @note      none
+ */
+static void a_ina219_convert_s16(const int16_t *in, float *out, uint32_t len, float scale)
+{
+    uint32_t i = 0;
+
+#if defined(__SSE2__)
+    __m128 s = _mm_set1_ps(scale);                                                       /* set the scale */
+    
+    for (; (i + 8) <= len; i += 8)                                                       /* 8 values per loop */
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(in + i));                          /* load 8 values */
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);                       /* sign extend low part */
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);                       /* sign extend high part */
+        
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), s));                      /* store low part */
+        _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), s));                  /* store high part */
+    }
+#elif defined(__ARM_NEON)
+    for (; (i + 8) <= len; i += 8)                                                       /* 8 values per loop */
+    {
+        int16x8_t v = vld1q_s16(in + i);                                                 /* load 8 values */
+        
+        vst1q_f32(out + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))), scale));         /* store low part */
+        vst1q_f32(out + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))), scale));    /* store high part */
+    }
+#endif
+    for (; i < len; i++)                                                                 /* scalar tail */
+    {
+        out[i] = (float)in[i] * scale;                                                   /* convert */
+    }
+}
+
+/**
+ * @brief     convert an unsigned register array to a float array
+ * @param[in] *in pointer to a register array
+ * @param[in] *out pointer to a float array
+ * @param[in] len array length
+ * @param[in] shift right shift of the register
+ * @param[in] scale lsb scale
+ * @note      none
+ */
+static void a_ina219_convert_u16(const uint16_t *in, float *out, uint32_t len, uint8_t shift, float scale)
+{
+    uint32_t i = 0;
+
+#if defined(__SSE2__)
+    __m128 s = _mm_set1_ps(scale);                                                       /* set the scale */
+    __m128i z = _mm_setzero_si128();                                                     /* set zero */
+    
+    for (; (i + 8) <= len; i += 8)                                                       /* 8 values per loop */
+    {
+        __m128i v = _mm_srli_epi16(_mm_loadu_si128((const __m128i *)(in + i)), shift);   /* load 8 values */
+        
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, z)), s));        /* store low part */
+        _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, z)), s));    /* store high part */
+    }
+#elif defined(__ARM_NEON)
+    int16x8_t sh = vdupq_n_s16(-(int16_t)shift);                                         /* set the shift */
+    
+    for (; (i + 8) <= len; i += 8)                                                       /* 8 values per loop */
+    {
+        uint16x8_t v = vshlq_u16(vld1q_u16(in + i), sh);                                 /* load 8 values */
+        
+        vst1q_f32(out + i, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), scale));         /* store low part */
+        vst1q_f32(out + i + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), scale));    /* store high part */
+    }
+#endif
+    for (; i < len; i++)                                                                 /* scalar tail */
+    {
+        out[i] = (float)(in[i] >> shift) * scale;                                        /* convert */
+    }
+}
+
+/**
+ * @brief      initialize the convert context
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *convert pointer to an ina219 convert structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or convert is NULL
+ *             - 4 current lsb is invalid
+ * @note       call it again after the calibration is changed,
+ *             the full scale current must fit in int32 uA
+ */
+uint8_t ina219_convert_init(ina219_handle_t *handle, ina219_convert_t *convert)
+{
+    if ((handle == NULL) || (convert == NULL))                                                  /* check handle and convert */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if ((handle->current_lsb <= 0.0) ||                                                         /* check the current lsb */
+        ((handle->current_lsb * 1000000.0 * 32768.0) > 2147483647.0))                           /* check the full scale current */
+    {
+        handle->debug_print("ina219: current lsb is invalid.\n");                               /* current lsb is invalid */
+        
+        return 4;                                                                               /* return error */
+    }
+    
+    convert->current_lsb = (float)(handle->current_lsb * 1000.0);                               /* set the current lsb */
+    convert->power_lsb = (float)(handle->current_lsb * 20.0 * 1000.0);                          /* set the power lsb */
+    convert->current_lsb_q16 = (int64_t)floor(handle->current_lsb * 1000000.0 * 65536.0 + 0.5);            /* set the current lsb */
+    convert->power_lsb_q16 = (int64_t)floor(handle->current_lsb * 20.0 * 1000000.0 * 65536.0 + 0.5);       /* set the power lsb */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      convert raw register arrays to float arrays
+ * @param[in]  *convert pointer to an ina219 convert structure
+ * @param[in]  *raw pointer to an ina219 batch raw structure
+ * @param[out] *out pointer to an ina219 batch float structure
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 convert, raw or out is NULL
+ * @note       a channel is skipped when its input or output array is NULL,
+ *             the bus voltage input is the unshifted register value
+ */
+uint8_t ina219_convert_batch(const ina219_convert_t *convert, const ina219_batch_raw_t *raw, ina219_batch_float_t *out, uint32_t len)
+{
+    if ((convert == NULL) || (raw == NULL) || (out == NULL))                                    /* check convert, raw and out */
+    {
+        return 2;                                                                               /* return error */
+    }
+    
+    if ((raw->shunt_voltage != NULL) && (out->shunt_voltage != NULL))                          /* shunt voltage */
+    {
+        a_ina219_convert_s16(raw->shunt_voltage, out->shunt_voltage, len, 0.01f);              /* 10uV lsb */
+    }
+    if ((raw->bus_voltage != NULL) && (out->bus_voltage != NULL))                              /* bus voltage */
+    {
+        a_ina219_convert_u16(raw->bus_voltage, out->bus_voltage, len, 3, 4.0f);                /* 4mV lsb */
+    }
+    if ((raw->current != NULL) && (out->current != NULL))                                      /* current */
+    {
+        a_ina219_convert_s16(raw->current, out->current, len, convert->current_lsb);           /* current lsb */
+    }
+    if ((raw->power != NULL) && (out->power != NULL))                                          /* power */
+    {
+        a_ina219_convert_u16(raw->power, out->power, len, 0, convert->power_lsb);              /* power lsb */
+    }
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      convert raw register arrays to fixed point arrays
+ * @param[in]  *convert pointer to an ina219 convert structure
+ * @param[in]  *raw pointer to an ina219 batch raw structure
+ * @param[out] *out pointer to an ina219 batch fixed structure
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 convert, raw or out is NULL
+ * @note       a channel is skipped when its input or output array is NULL,
+ *             the bus voltage input is the unshifted register value,
+ *             the current and power are rounded to the nearest uA and uW
+ */
+uint8_t ina219_convert_batch_fixed(const ina219_convert_t *convert, const ina219_batch_raw_t *raw, ina219_batch_fixed_t *out, uint32_t len)
+{
+    uint32_t i;
+    
+    if ((convert == NULL) || (raw == NULL) || (out == NULL))                                    /* check convert, raw and out */
+    {
+        return 2;                                                                               /* return error */
+    }
+    
+    if ((raw->shunt_voltage != NULL) && (out->shunt_voltage != NULL))                          /* shunt voltage */
+    {
+        const int16_t *in = raw->shunt_voltage;                                                 /* input array */
+        int32_t *o = out->shunt_voltage;                                                        /* output array */
+        
+        for (i = 0; i < len; i++)                                                               /* loop all */
+        {
+            o[i] = (int32_t)in[i] * 10;                                                         /* 10uV lsb */
+        }
+    }
+    if ((raw->bus_voltage != NULL) && (out->bus_voltage != NULL))                              /* bus voltage */
+    {
+        const uint16_t *in = raw->bus_voltage;                                                  /* input array */
+        int32_t *o = out->bus_voltage;                                                          /* output array */
+        
+        for (i = 0; i < len; i++)                                                               /* loop all */
+        {
+            o[i] = (int32_t)(in[i] >> 3) * 4;                                                   /* 4mV lsb */
+        }
+    }
+    if ((raw->current != NULL) && (out->current != NULL))                                      /* current */
+    {
+        const int16_t *in = raw->current;                                                       /* input array */
+        int32_t *o = out->current;                                                              /* output array */
+        int64_t q = convert->current_lsb_q16;                                                   /* q16 lsb */
+        
+        for (i = 0; i < len; i++)                                                               /* loop all */
+        {
+            o[i] = (int32_t)(((int64_t)in[i] * q + 32768) >> 16);                              /* current lsb */
+        }
+    }
+    if ((raw->power != NULL) && (out->power != NULL))                                          /* power */
+    {
+        const uint16_t *in = raw->power;                                                        /* input array */
+        int64_t *o = out->power;                                                                /* output array */
+        int64_t q = convert->power_lsb_q16;                                                     /* q16 lsb */
+        
+        for (i = 0; i < len; i++)                                                               /* loop all */
+        {
+            o[i] = ((int64_t)in[i] * q + 32768) >> 16;                                          /* power lsb */
+        }
+    }
+    
+    return 0;                                                                                   /* success return 0 */
+}
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_convert.h
+ * @brief     driver ina219 convert header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_CONVERT_H
+#define DRIVER_INA219_CONVERT_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_convert_driver ina219 convert driver function
+ * @brief    ina219 convert driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 convert structure definition
+ */
+typedef struct ina219_convert_s
+{
+    float current_lsb;             /**< current lsb in mA */
+    float power_lsb;               /**< power lsb in mW */
+    int64_t current_lsb_q16;       /**< current lsb in uA, q16 */
+    int64_t power_lsb_q16;         /**< power lsb in uW, q16 */
+} ina219_convert_t;
+
+/**
+ * @brief ina219 batch raw structure definition
+ */
+typedef struct ina219_batch_raw_s
+{
+    const int16_t *shunt_voltage;         /**< shunt voltage register array */
+    const uint16_t *bus_voltage;          /**< bus voltage register array */
+    const int16_t *current;               /**< current register array */
+    const uint16_t *power;                /**< power register array */
+} ina219_batch_raw_t;
+
+/**
+ * @brief ina219 batch float structure definition
+ */
+typedef struct ina219_batch_float_s
+{
+    float *shunt_voltage;         /**< shunt voltage array in mV */
+    float *bus_voltage;           /**< bus voltage array in mV */
+    float *current;               /**< current array in mA */
+    float *power;                 /**< power array in mW */
+} ina219_batch_float_t;
+
+/**
+ * @brief ina219 batch fixed structure definition
+ */
+typedef struct ina219_batch_fixed_s
+{
+    int32_t *shunt_voltage;         /**< shunt voltage array in uV */
+    int32_t *bus_voltage;           /**< bus voltage array in mV */
+    int32_t *current;               /**< current array in uA */
+    int64_t *power;                 /**< power array in uW */
+} ina219_batch_fixed_t;
+
+/**
+ * @brief      initialize the convert context
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *convert pointer to an ina219 convert structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or convert is NULL
+ *             - 4 current lsb is invalid
+ * @note       call it again after the calibration is changed,
+ *             the full scale current must fit in int32 uA
+ */
+uint8_t ina219_convert_init(ina219_handle_t *handle, ina219_convert_t *convert);
+
+/**
+ * @brief      convert raw register arrays to float arrays
+ * @param[in]  *convert pointer to an ina219 convert structure
+ * @param[in]  *raw pointer to an ina219 batch raw structure
+ * @param[out] *out pointer to an ina219 batch float structure
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 convert, raw or out is NULL
+ * @note       a channel is skipped when its input or output array is NULL,
+ *             the bus voltage input is the unshifted register value
+ */
+uint8_t ina219_convert_batch(const ina219_convert_t *convert, const ina219_batch_raw_t *raw, ina219_batch_float_t *out, uint32_t len);
+
+/**
+ * @brief      convert raw register arrays to fixed point arrays
+ * @param[in]  *convert pointer to an ina219 convert structure
+ * @param[in]  *raw pointer to an ina219 batch raw structure
+ * @param[out] *out pointer to an ina219 batch fixed structure
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 convert, raw or out is NULL
+ * @note       a channel is skipped when its input or output array is NULL,
+ *             the bus voltage input is the unshifted register value,
+ *             the current and power are rounded to the nearest uA and uW
+ */
+uint8_t ina219_convert_batch_fixed(const ina219_convert_t *convert, const ina219_batch_raw_t *raw, ina219_batch_fixed_t *out, uint32_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
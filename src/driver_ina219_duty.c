@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_duty.c
+ * @brief     driver ina219 duty source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_duty.h"
+#include "driver_ina219_timing.h"
+#include <string.h>
+
+/**
+ * @brief chip register definition
+ */
+#define INA219_DUTY_REG_CONF        0x00        /**< configuration register */
+
+/**
+ * @brief chip bit definition
+ */
+#define INA219_DUTY_CNVR            0x0002      /**< conversion ready flag */
+
+/**
+ * @brief     initialize a power down duty cycle
+ * @param[in] *duty pointer to an ina219 duty structure
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] mode triggered mode
+ * @param[in] idle idle mode
+ * @param[in] supply_mv supply voltage in mV
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 duty, handle or timestamp is NULL
+ *            - 3 handle is not initialized
+ *            - 4 mode is not a triggered mode
+ *            - 5 idle is not the power down or the adc off mode
+ * @note      the conf is read once and cached with the triggered and the idle mode,
+ *            so init the duty cycle again after the configuration is changed,
+ *            the chip is put in the idle mode at once
+ */
+uint8_t ina219_duty_init(ina219_duty_t *duty, ina219_handle_t *handle, ina219_mode_t mode, ina219_mode_t idle,
+                         uint16_t supply_mv, uint64_t (*timestamp)(void))
+{
+    uint8_t buf[2];
+    uint16_t conf;
+    uint32_t period;
+    
+    if ((duty == NULL) || (handle == NULL) || (timestamp == NULL))                        /* check duty, handle and timestamp */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if ((mode < INA219_MODE_SHUNT_VOLTAGE_TRIGGERED) ||
+        (mode > INA219_MODE_SHUNT_BUS_VOLTAGE_TRIGGERED))                                 /* check the mode */
+    {
+        return 4;                                                                         /* return error */
+    }
+    if ((idle != INA219_MODE_POWER_DOWN) && (idle != INA219_MODE_ADC_OFF))                /* check the idle mode */
+    {
+        return 5;                                                                         /* return error */
+    }
+    
+    memset(duty, 0, sizeof(ina219_duty_t));                                               /* clear the duty */
+    if (handle->iic_read(handle->iic_addr, INA219_DUTY_REG_CONF, buf, 2) != 0)            /* read the conf */
+    {
+        handle->debug_print("ina219: read conf register failed.\n");                      /* read conf register failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    conf = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);                                    /* get the conf */
+    conf = (uint16_t)(conf & ~0x0007);                                                    /* clear the mode */
+    duty->conf[0] = (uint8_t)((conf | mode) >> 8);                                        /* set the triggered conf msb */
+    duty->conf[1] = (uint8_t)((conf | mode) & 0xFF);                                      /* set the triggered conf lsb */
+    duty->idle[0] = (uint8_t)((conf | idle) >> 8);                                        /* set the idle conf msb */
+    duty->idle[1] = (uint8_t)((conf | idle) & 0xFF);                                      /* set the idle conf lsb */
+    (void)ina219_timing_get_period((uint16_t)(conf | mode), &period);                     /* get the conversion time */
+    if (idle == INA219_MODE_POWER_DOWN)                                                   /* power down */
+    {
+        duty->settle_us = INA219_DUTY_POWER_UP_US;                                        /* set the power up time */
+        duty->idle_ua = INA219_DUTY_POWER_DOWN_UA;                                        /* set the idle current */
+    }
+    else
+    {
+        duty->settle_us = 0;                                                              /* the analog front end stays on */
+        duty->idle_ua = INA219_DUTY_ACTIVE_UA;                                            /* set the idle current */
+    }
+    duty->wait_us = duty->settle_us + period;                                             /* set the wait */
+    duty->supply_mv = supply_mv;                                                          /* set the supply voltage */
+    duty->timestamp = timestamp;                                                          /* set the timestamp */
+    duty->handle = handle;                                                                /* set the handle */
+    if (handle->iic_write(handle->iic_addr, INA219_DUTY_REG_CONF, duty->idle, 2) != 0)    /* enter the idle mode */
+    {
+        handle->debug_print("ina219: write conf register failed.\n");                     /* write conf register failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    duty->sleep = timestamp();                                                            /* set the idle start */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      wake the chip, read one conversion and put it back in the idle mode
+ * @param[in]  *duty pointer to an ina219 duty structure
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 duty or sample is NULL
+ *             - 3 duty is not initialized
+ *             - 5 conversion timeout
+ * @note       the cached triggered conf wakes the chip and starts the conversion in one write,
+ *             the wait covers the power up time and the conversion time, a conversion ready
+ *             flag that is still clear is polled every 1 ms, the chip goes back to the idle
+ *             mode even when the read fails
+ */
+uint8_t ina219_duty_read(ina219_duty_t *duty, ina219_sample_t *sample)
+{
+    uint8_t res = 0;
+    uint8_t times;
+    uint64_t wake;
+    uint64_t elapsed;
+    ina219_handle_t *handle;
+    
+    if ((duty == NULL) || (sample == NULL))                                               /* check duty and sample */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (duty->handle == NULL)                                                             /* check duty initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    handle = duty->handle;                                                                /* get the handle */
+    wake = duty->timestamp();                                                             /* get the wake time */
+    if (handle->iic_write(handle->iic_addr, INA219_DUTY_REG_CONF, duty->conf, 2) != 0)    /* wake and trigger */
+    {
+        handle->debug_print("ina219: write conf register failed.\n");                     /* write conf register failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    elapsed = duty->timestamp() - wake;                                                   /* time since the wake */
+    if (elapsed < duty->wait_us)                                                          /* still settling or converting */
+    {
+        handle->delay_ms((uint32_t)((duty->wait_us - elapsed + 999) / 1000));             /* wait once */
+    }
+    for (times = 0; times <= INA219_DUTY_MAX_POLL; times++)                               /* poll the ready flag */
+    {
+        if (ina219_read_sample(handle, sample) != 0)                                      /* read the sample */
+        {
+            res = 1;                                                                      /* read failed */
+            
+            break;                                                                        /* break */
+        }
+        if ((sample->bus_voltage & INA219_DUTY_CNVR) != 0)                                /* check the ready flag */
+        {
+            break;                                                                        /* break */
+        }
+        handle->delay_ms(1);                                                              /* delay 1 ms */
+    }
+    if ((res == 0) && (times > INA219_DUTY_MAX_POLL))                                     /* check the times */
+    {
+        handle->debug_print("ina219: conversion timeout.\n");                             /* conversion timeout */
+        res = 5;                                                                          /* timeout */
+    }
+    if (handle->iic_write(handle->iic_addr, INA219_DUTY_REG_CONF, duty->idle, 2) != 0)    /* back to the idle mode */
+    {
+        handle->debug_print("ina219: write conf register failed.\n");                     /* write conf register failed */
+        
+        return 1;                                                                         /* return error */
+    }
+    duty->idle_us = wake - duty->sleep;                                                   /* set the idle time */
+    duty->sleep = duty->timestamp();                                                      /* set the idle start */
+    duty->active_us = (uint32_t)(duty->sleep - wake);                                     /* set the active time */
+    
+    return res;                                                                           /* return the result */
+}
+
+/**
+ * @brief      get the estimated energy of the last sample
+ * @param[in]  *duty pointer to an ina219 duty structure
+ * @param[out] *active_us pointer to an active time buffer in us
+ * @param[out] *idle_us pointer to an idle time buffer in us
+ * @param[out] *nj pointer to an energy buffer in nJ
+ * @return     status code
+ *             - 0 success
+ *             - 2 duty, active_us, idle_us or nj is NULL
+ * @note       the energy covers the idle time before the last wake and the active time
+ *             from the wake to the power down, it is the supply voltage times the typical
+ *             datasheet supply current of each state, the idle time is 64 bit so that
+ *             a sample period of hours does not wrap
+ */
+uint8_t ina219_duty_get_energy(ina219_duty_t *duty, uint32_t *active_us, uint64_t *idle_us, uint64_t *nj)
+{
+    uint64_t charge;
+    
+    if ((duty == NULL) || (active_us == NULL) ||
+        (idle_us == NULL) || (nj == NULL))                                          /* check duty, active_us, idle_us and nj */
+    {
+        return 2;                                                                   /* return error */
+    }
+    
+    *active_us = duty->active_us;                                                   /* set the active time */
+    *idle_us = duty->idle_us;                                                       /* set the idle time */
+    charge = (uint64_t)INA219_DUTY_ACTIVE_UA * duty->active_us +
+             (uint64_t)duty->idle_ua * duty->idle_us;                               /* uA x us is 1e-12 C */
+    *nj = (charge / 1000000) * duty->supply_mv +
+          (charge % 1000000) * duty->supply_mv / 1000000;                           /* mV x uA x us is 1e-15 J */
+    
+    return 0;                                                                       /* success return 0 */
+}
@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_duty.h
+ * @brief     driver ina219 duty header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_DUTY_H
+#define DRIVER_INA219_DUTY_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_duty_driver ina219 duty driver function
+ * @brief    ina219 duty driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 duty max poll definition
+ */
+#ifndef INA219_DUTY_MAX_POLL
+    #define INA219_DUTY_MAX_POLL 10        /**< 10 ms */
+#endif
+
+/**
+ * @brief ina219 duty power up time definition
+ */
+#ifndef INA219_DUTY_POWER_UP_US
+    #define INA219_DUTY_POWER_UP_US 40        /**< 40 us from the power down mode */
+#endif
+
+/**
+ * @brief ina219 duty active supply current definition
+ */
+#ifndef INA219_DUTY_ACTIVE_UA
+    #define INA219_DUTY_ACTIVE_UA 700        /**< 0.7 mA typical quiescent current */
+#endif
+
+/**
+ * @brief ina219 duty power down supply current definition
+ */
+#ifndef INA219_DUTY_POWER_DOWN_UA
+    #define INA219_DUTY_POWER_DOWN_UA 6        /**< 6 uA typical power down current */
+#endif
+
+/**
+ * @brief ina219 duty structure definition
+ */
+typedef struct ina219_duty_s
+{
+    ina219_handle_t *handle;              /**< ina219 handle */
+    uint8_t conf[2];                      /**< triggered conf word, msb first */
+    uint8_t idle[2];                      /**< idle conf word, msb first */
+    uint16_t supply_mv;                   /**< supply voltage in mV */
+    uint32_t idle_ua;                     /**< idle supply current in uA */
+    uint32_t settle_us;                   /**< power up time in us */
+    uint32_t wait_us;                     /**< power up and conversion time in us */
+    uint32_t active_us;                   /**< last active time in us */
+    uint64_t idle_us;                     /**< last idle time in us */
+    uint64_t sleep;                       /**< last idle start in us */
+    uint64_t (*timestamp)(void);          /**< point to a timestamp function address */
+} ina219_duty_t;
+
+/**
+ * @brief     initialize a power down duty cycle
+ * @param[in] *duty pointer to an ina219 duty structure
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] mode triggered mode
+ * @param[in] idle idle mode
+ * @param[in] supply_mv supply voltage in mV
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 duty, handle or timestamp is NULL
+ *            - 3 handle is not initialized
+ *            - 4 mode is not a triggered mode
+ *            - 5 idle is not the power down or the adc off mode
+ * @note      the conf is read once and cached with the triggered and the idle mode,
+ *            so init the duty cycle again after the configuration is changed,
+ *            the chip is put in the idle mode at once
+ */
+uint8_t ina219_duty_init(ina219_duty_t *duty, ina219_handle_t *handle, ina219_mode_t mode, ina219_mode_t idle,
+                         uint16_t supply_mv, uint64_t (*timestamp)(void));
+
+/**
+ * @brief      wake the chip, read one conversion and put it back in the idle mode
+ * @param[in]  *duty pointer to an ina219 duty structure
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 duty or sample is NULL
+ *             - 3 duty is not initialized
+ *             - 5 conversion timeout
+ * @note       the cached triggered conf wakes the chip and starts the conversion in one write,
+ *             the wait covers the power up time and the conversion time, a conversion ready
+ *             flag that is still clear is polled every 1 ms, the chip goes back to the idle
+ *             mode even when the read fails
+ */
+uint8_t ina219_duty_read(ina219_duty_t *duty, ina219_sample_t *sample);
+
+/**
+ * @brief      get the estimated energy of the last sample
+ * @param[in]  *duty pointer to an ina219 duty structure
+ * @param[out] *active_us pointer to an active time buffer in us
+ * @param[out] *idle_us pointer to an idle time buffer in us
+ * @param[out] *nj pointer to an energy buffer in nJ
+ * @return     status code
+ *             - 0 success
+ *             - 2 duty, active_us, idle_us or nj is NULL
+ * @note       the energy covers the idle time before the last wake and the active time
+ *             from the wake to the power down, it is the supply voltage times the typical
+ *             datasheet supply current of each state, the idle time is 64 bit so that
+ *             a sample period of hours does not wrap
+ */
+uint8_t ina219_duty_get_energy(ina219_duty_t *duty, uint32_t *active_us, uint64_t *idle_us, uint64_t *nj);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,406 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_export.c
+ * @brief     driver ina219 export source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_export.h"
+#include <string.h>
+
+/**
+ * @brief two digit table definition
+ */
+static const char gs_digits[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";        /**< two digits per entry */
+
+/**
+ * @brief     put a string
+ * @param[in] *p pointer to an output position
+ * @param[in] *s pointer to a string
+ * @return    next output position
+ * @note      none
+ */
+static uint8_t *a_ina219_export_put_string(uint8_t *p, const char *s)
+{
+    while (*s != 0)                        /* copy all */
+    {
+        *p++ = (uint8_t)(*s++);            /* copy one char */
+    }
+    
+    return p;                              /* return the position */
+}
+
+/**
+ * @brief     put an unsigned decimal
+ * @param[in] *p pointer to an output position
+ * @param[in] v value
+ * @return    next output position
+ * @note      two digits are converted per division
+ */
+static uint8_t *a_ina219_export_put_u64(uint8_t *p, uint64_t v)
+{
+    uint8_t tmp[20];
+    uint8_t n = 20;
+    
+    while (v >= 100)                                      /* two digits per loop */
+    {
+        uint32_t r = (uint32_t)(v % 100);                 /* get the low digits */
+        
+        v /= 100;                                         /* next digits */
+        n -= 2;                                           /* n -= 2 */
+        tmp[n] = (uint8_t)gs_digits[r * 2];               /* set the high digit */
+        tmp[n + 1] = (uint8_t)gs_digits[r * 2 + 1];       /* set the low digit */
+    }
+    if (v >= 10)                                          /* two digits left */
+    {
+        n -= 2;                                           /* n -= 2 */
+        tmp[n] = (uint8_t)gs_digits[v * 2];               /* set the high digit */
+        tmp[n + 1] = (uint8_t)gs_digits[v * 2 + 1];       /* set the low digit */
+    }
+    else                                                  /* one digit left */
+    {
+        tmp[--n] = (uint8_t)('0' + v);                    /* set the digit */
+    }
+    memcpy(p, &tmp[n], 20 - n);                           /* copy the digits */
+    
+    return p + (20 - n);                                  /* return the position */
+}
+
+/**
+ * @brief     put a milli unit value with 3 decimals
+ * @param[in] *p pointer to an output position
+ * @param[in] v value in the milli unit
+ * @return    next output position
+ * @note      e.g. 12345 is put as 12.345
+ */
+static uint8_t *a_ina219_export_put_milli(uint8_t *p, int64_t v)
+{
+    uint64_t u;
+    uint32_t r;
+    
+    if (v < 0)                                            /* negative value */
+    {
+        *p++ = '-';                                       /* set the sign */
+        u = (uint64_t)0 - (uint64_t)v;                    /* get the absolute value */
+    }
+    else
+    {
+        u = (uint64_t)v;                                  /* get the value */
+    }
+    p = a_ina219_export_put_u64(p, u / 1000);             /* integer part */
+    r = (uint32_t)(u % 1000);                             /* get the fraction */
+    p[0] = '.';                                           /* set the point */
+    p[1] = (uint8_t)('0' + r / 100);                      /* set the first decimal */
+    p[2] = (uint8_t)gs_digits[(r % 100) * 2];             /* set the second decimal */
+    p[3] = (uint8_t)gs_digits[(r % 100) * 2 + 1];         /* set the third decimal */
+    
+    return p + 4;                                         /* return the position */
+}
+
+/**
+ * @brief     initialize the exporter
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @param[in] *buf pointer to an output buffer
+ * @param[in] len length of the output buffer
+ * @param[in] format export format
+ * @param[in] *output pointer to an output function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 exporter, buf or output is NULL
+ *            - 4 buffer is too small
+ * @note      len >= INA219_EXPORT_ROW_MAX_SIZE, a larger buffer means fewer and bigger writes
+ */
+uint8_t ina219_export_init(ina219_export_t *exporter, uint8_t *buf, uint32_t len, ina219_export_format_t format,
+                          uint8_t (*output)(const uint8_t *buf, uint32_t len))
+{
+    if ((exporter == NULL) || (buf == NULL) || (output == NULL))        /* check exporter, buf and output */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (len < INA219_EXPORT_ROW_MAX_SIZE)                               /* check the length */
+    {
+        return 4;                                                       /* return error */
+    }
+    
+    exporter->buf = buf;                                                /* set the buffer */
+    exporter->len = len;                                                /* set the length */
+    exporter->pos = 0;                                                  /* set the position */
+    exporter->format = (uint8_t)format;                                 /* set the format */
+    exporter->field = INA219_SAMPLE_FIELD_ALL;                          /* all the fields are valid */
+    exporter->count = 0;                                                /* no buffered row */
+    exporter->first = 0;                                                /* no first timestamp */
+    exporter->output = output;                                          /* set the output */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     write the header row
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 exporter is NULL
+ * @note      only the csv format has a header row
+ */
+uint8_t ina219_export_write_header(ina219_export_t *exporter)
+{
+    static const char header[] = "timestamp,device,shunt_voltage_mv,bus_voltage_mv,current_ma,power_mw\n";
+    
+    if (exporter == NULL)                                                                 /* check exporter */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (exporter->format != INA219_EXPORT_FORMAT_CSV)                                     /* no header */
+    {
+        return 0;                                                                         /* success return 0 */
+    }
+    
+    if ((exporter->pos + INA219_EXPORT_ROW_MAX_SIZE) > exporter->len)                     /* check the space */
+    {
+        if (ina219_export_flush(exporter) != 0)                                           /* flush the buffer */
+        {
+            return 1;                                                                     /* return error */
+        }
+    }
+    memcpy(&exporter->buf[exporter->pos], header, sizeof(header) - 1);                   /* copy the header */
+    exporter->pos += (uint32_t)(sizeof(header) - 1);                                      /* update the position */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     write a sample row
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @param[in] timestamp timestamp in us
+ * @param[in] device device id, e.g. the 7 bit iic address
+ * @param[in] *convert pointer to an ina219 convert structure of the device
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 exporter, convert or sample is NULL
+ * @note      the row is formatted with integer operations only,
+ *            the voltages are printed in mV, the current in mA and the power in mW with 3 decimals
+ */
+uint8_t ina219_export_write(ina219_export_t *exporter, uint64_t timestamp, uint8_t device,
+                           const ina219_convert_t *convert, const ina219_sample_t *sample)
+{
+    uint8_t *p;
+    int32_t current;
+    int64_t power;
+    
+    if ((exporter == NULL) || (convert == NULL) || (sample == NULL))                          /* check exporter, convert and sample */
+    {
+        return 2;                                                                             /* return error */
+    }
+    
+    if ((exporter->pos + INA219_EXPORT_ROW_MAX_SIZE) > exporter->len)                         /* check the space */
+    {
+        if (ina219_export_flush(exporter) != 0)                                               /* flush the buffer */
+        {
+            return 1;                                                                         /* return error */
+        }
+    }
+    if (exporter->count == 0)                                                                 /* first buffered row */
+    {
+        exporter->first = timestamp;                                                          /* set the first */
+    }
+    exporter->count++;                                                                        /* count++ */
+    current = (int32_t)(((int64_t)sample->current * convert->current_lsb_q16 + 32768) >> 16); /* current in uA */
+    power = ((int64_t)sample->power * convert->power_lsb_q16 + 32768) >> 16;                  /* power in uW */
+    p = &exporter->buf[exporter->pos];                                                        /* row start */
+    if (exporter->format == INA219_EXPORT_FORMAT_NDJSON)                                      /* ndjson */
+    {
+        p = a_ina219_export_put_string(p, "{\"timestamp\":");                                /* timestamp key */
+        p = a_ina219_export_put_u64(p, timestamp);                                            /* timestamp */
+        p = a_ina219_export_put_string(p, ",\"device\":");                                   /* device key */
+        p = a_ina219_export_put_u64(p, device);                                               /* device */
+        p = a_ina219_export_put_string(p, ",\"shunt_voltage_mv\":");                         /* shunt voltage key */
+        if ((exporter->field & INA219_SAMPLE_FIELD_SHUNT_VOLTAGE) != 0)                       /* check the field */
+        {
+            p = a_ina219_export_put_milli(p, (int32_t)sample->shunt_voltage * 10);            /* 10uV lsb */
+        }
+        else
+        {
+            p = a_ina219_export_put_string(p, "null");                                        /* unavailable */
+        }
+        p = a_ina219_export_put_string(p, ",\"bus_voltage_mv\":");                           /* bus voltage key */
+        if ((exporter->field & INA219_SAMPLE_FIELD_BUS_VOLTAGE) != 0)                         /* check the field */
+        {
+            p = a_ina219_export_put_u64(p, (uint64_t)(sample->bus_voltage >> 3) * 4);         /* 4mV lsb */
+        }
+        else
+        {
+            p = a_ina219_export_put_string(p, "null");                                        /* unavailable */
+        }
+        p = a_ina219_export_put_string(p, ",\"current_ma\":");                               /* current key */
+        if ((exporter->field & INA219_SAMPLE_FIELD_CURRENT) != 0)                             /* check the field */
+        {
+            p = a_ina219_export_put_milli(p, current);                                        /* current */
+        }
+        else
+        {
+            p = a_ina219_export_put_string(p, "null");                                        /* unavailable */
+        }
+        p = a_ina219_export_put_string(p, ",\"power_mw\":");                                 /* power key */
+        if ((exporter->field & INA219_SAMPLE_FIELD_POWER) != 0)                               /* check the field */
+        {
+            p = a_ina219_export_put_milli(p, power);                                          /* power */
+        }
+        else
+        {
+            p = a_ina219_export_put_string(p, "null");                                        /* unavailable */
+        }
+        p = a_ina219_export_put_string(p, "}\n");                                             /* row end */
+    }
+    else                                                                                      /* csv */
+    {
+        p = a_ina219_export_put_u64(p, timestamp);                                            /* timestamp */
+        *p++ = ',';                                                                           /* separator */
+        p = a_ina219_export_put_u64(p, device);                                               /* device */
+        *p++ = ',';                                                                           /* separator */
+        if ((exporter->field & INA219_SAMPLE_FIELD_SHUNT_VOLTAGE) != 0)                       /* check the field */
+        {
+            p = a_ina219_export_put_milli(p, (int32_t)sample->shunt_voltage * 10);            /* 10uV lsb */
+        }
+        *p++ = ',';                                                                           /* separator */
+        if ((exporter->field & INA219_SAMPLE_FIELD_BUS_VOLTAGE) != 0)                         /* check the field */
+        {
+            p = a_ina219_export_put_u64(p, (uint64_t)(sample->bus_voltage >> 3) * 4);         /* 4mV lsb */
+        }
+        *p++ = ',';                                                                           /* separator */
+        if ((exporter->field & INA219_SAMPLE_FIELD_CURRENT) != 0)                             /* check the field */
+        {
+            p = a_ina219_export_put_milli(p, current);                                        /* current */
+        }
+        *p++ = ',';                                                                           /* separator */
+        if ((exporter->field & INA219_SAMPLE_FIELD_POWER) != 0)                               /* check the field */
+        {
+            p = a_ina219_export_put_milli(p, power);                                          /* power */
+        }
+        *p++ = '\n';                                                                          /* row end */
+    }
+    exporter->pos = (uint32_t)(p - exporter->buf);                                            /* update the position */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the valid fields of the next rows
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @param[in] field valid field mask
+ * @return    status code
+ *            - 0 success
+ *            - 2 exporter is NULL
+ * @note      field is a mask of ina219_sample_field_t, all the fields are valid after the init,
+ *            an invalid field is left empty in csv and is null in ndjson
+ */
+uint8_t ina219_export_set_field(ina219_export_t *exporter, uint8_t field)
+{
+    if (exporter == NULL)                                       /* check exporter */
+    {
+        return 2;                                               /* return error */
+    }
+    
+    exporter->field = field & INA219_SAMPLE_FIELD_ALL;          /* set the field */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     flush the buffered rows
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 exporter is NULL
+ * @note      the buffered rows are dropped if the output fails
+ */
+uint8_t ina219_export_flush(ina219_export_t *exporter)
+{
+    uint32_t pos;
+    
+    if (exporter == NULL)                                      /* check exporter */
+    {
+        return 2;                                              /* return error */
+    }
+    if (exporter->pos == 0)                                    /* empty buffer */
+    {
+        return 0;                                              /* success return 0 */
+    }
+    
+    pos = exporter->pos;                                       /* save the position */
+    exporter->pos = 0;                                         /* reset the position */
+    exporter->count = 0;                                       /* reset the count */
+    if (exporter->output(exporter->buf, pos) != 0)             /* output the rows */
+    {
+        return 1;                                              /* return error */
+    }
+    
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief     flush the buffered rows when the first one gets too old
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @param[in] timestamp time of the next row in us
+ * @param[in] age_us max time in us a row is held in the buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 exporter is NULL
+ * @note      call it after the rows of a sample with the time of the next sample, so a slow
+ *            rate outputs each sample at once and a fast rate still outputs big writes,
+ *            a buffered header without rows is output at once
+ */
+uint8_t ina219_export_flush_age(ina219_export_t *exporter, uint64_t timestamp, uint32_t age_us)
+{
+    if (exporter == NULL)                                                        /* check exporter */
+    {
+        return 2;                                                                /* return error */
+    }
+    
+    if ((exporter->pos != 0) &&
+        ((exporter->count == 0) || (timestamp < exporter->first) ||
+         ((timestamp - exporter->first) >= age_us)))                             /* check the age */
+    {
+        return ina219_export_flush(exporter);                                    /* flush the rows */
+    }
+    
+    return 0;                                                                    /* success return 0 */
+}
@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_export.h
+ * @brief     driver ina219 export header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_EXPORT_H
+#define DRIVER_INA219_EXPORT_H
+
+#include "driver_ina219_convert.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_export_driver ina219 export driver function
+ * @brief    ina219 export driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 export row max size definition
+ */
+#define INA219_EXPORT_ROW_MAX_SIZE 160        /**< 160 bytes */
+
+/**
+ * @brief ina219 export format enumeration definition
+ */
+typedef enum
+{
+    INA219_EXPORT_FORMAT_CSV    = 0x00,        /**< comma separated values */
+    INA219_EXPORT_FORMAT_NDJSON = 0x01,        /**< newline delimited json */
+} ina219_export_format_t;
+
+/**
+ * @brief ina219 export structure definition
+ */
+typedef struct ina219_export_s
+{
+    uint8_t *buf;                                              /**< output buffer */
+    uint32_t len;                                              /**< output buffer length */
+    uint32_t pos;                                              /**< write position */
+    uint8_t format;                                            /**< export format */
+    uint8_t field;                                             /**< valid field mask */
+    uint32_t count;                                            /**< buffered row number */
+    uint64_t first;                                            /**< first buffered row timestamp */
+    uint8_t (*output)(const uint8_t *buf, uint32_t len);       /**< point to an output function address */
+} ina219_export_t;
+
+/**
+ * @brief     initialize the exporter
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @param[in] *buf pointer to an output buffer
+ * @param[in] len length of the output buffer
+ * @param[in] format export format
+ * @param[in] *output pointer to an output function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 exporter, buf or output is NULL
+ *            - 4 buffer is too small
+ * @note      len >= INA219_EXPORT_ROW_MAX_SIZE, a larger buffer means fewer and bigger writes
+ */
+uint8_t ina219_export_init(ina219_export_t *exporter, uint8_t *buf, uint32_t len, ina219_export_format_t format,
+                          uint8_t (*output)(const uint8_t *buf, uint32_t len));
+
+/**
+ * @brief     write the header row
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 exporter is NULL
+ * @note      only the csv format has a header row
+ */
+uint8_t ina219_export_write_header(ina219_export_t *exporter);
+
+/**
+ * @brief     write a sample row
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @param[in] timestamp timestamp in us
+ * @param[in] device device id, e.g. the 7 bit iic address
+ * @param[in] *convert pointer to an ina219 convert structure of the device
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 exporter, convert or sample is NULL
+ * @note      the row is formatted with integer operations only,
+ *            the voltages are printed in mV, the current in mA and the power in mW with 3 decimals
+ */
+uint8_t ina219_export_write(ina219_export_t *exporter, uint64_t timestamp, uint8_t device,
+                           const ina219_convert_t *convert, const ina219_sample_t *sample);
+
+/**
+ * @brief     set the valid fields of the next rows
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @param[in] field valid field mask
+ * @return    status code
+ *            - 0 success
+ *            - 2 exporter is NULL
+ * @note      field is a mask of ina219_sample_field_t, all the fields are valid after the init,
+ *            an invalid field is left empty in csv and is null in ndjson
+ */
+uint8_t ina219_export_set_field(ina219_export_t *exporter, uint8_t field);
+
+/**
+ * @brief     flush the buffered rows
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 exporter is NULL
+ * @note      the buffered rows are dropped if the output fails
+ */
+uint8_t ina219_export_flush(ina219_export_t *exporter);
+
+/**
+ * @brief     flush the buffered rows when the first one gets too old
+ * @param[in] *exporter pointer to an ina219 export structure
+ * @param[in] timestamp time of the next row in us
+ * @param[in] age_us max time in us a row is held in the buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 exporter is NULL
+ * @note      call it after the rows of a sample with the time of the next sample, so a slow
+ *            rate outputs each sample at once and a fast rate still outputs big writes,
+ *            a buffered header without rows is output at once
+ */
+uint8_t ina219_export_flush_age(ina219_export_t *exporter, uint64_t timestamp, uint32_t age_us);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
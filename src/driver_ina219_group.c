@@ -0,0 +1,280 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_group.c
+ * @brief     driver ina219 group source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_group.h"
+#include "driver_ina219_timing.h"
+#include <string.h>
+
+/**
+ * @brief chip register definition
+ */
+#define INA219_GROUP_REG_CONF        0x00        /**< configuration register */
+
+/**
+ * @brief chip bit definition
+ */
+#define INA219_GROUP_CNVR            0x0002      /**< conversion ready flag */
+
+/**
+ * @brief     initialize the trigger group
+ * @param[in] *group pointer to an ina219 group structure
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @param[in] *iic_write_batch pointer to a batched iic write function
+ * @return    status code
+ *            - 0 success
+ *            - 2 group or timestamp is NULL
+ * @note      iic_write_batch can be NULL, then the conf words are written back to back
+ */
+uint8_t ina219_group_init(ina219_group_t *group, uint64_t (*timestamp)(void), uint8_t (*iic_write_batch)(const uint8_t *addr, uint8_t reg, uint8_t *buf, uint8_t num))
+{
+    if ((group == NULL) || (timestamp == NULL))              /* check group and timestamp */
+    {
+        return 2;                                            /* return error */
+    }
+    
+    memset(group, 0, sizeof(ina219_group_t));                /* clear the group */
+    group->timestamp = timestamp;                            /* set the timestamp */
+    group->iic_write_batch = iic_write_batch;                /* set the batched write */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     add a device to the trigger group
+ * @param[in] *group pointer to an ina219 group structure
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] mode triggered mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 read conf failed
+ *            - 2 group or handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 group is full
+ *            - 5 mode is not a triggered mode
+ * @note      the conf is read once and cached with the triggered mode,
+ *            so add the device again after its configuration is changed,
+ *            all the handles must share the same bus
+ */
+uint8_t ina219_group_add(ina219_group_t *group, ina219_handle_t *handle, ina219_mode_t mode)
+{
+    uint8_t buf[2];
+    uint16_t conf;
+    uint32_t period;
+    
+    if ((group == NULL) || (handle == NULL))                                            /* check group and handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    if (group->num >= INA219_GROUP_MAX_DEVICE)                                          /* check the table */
+    {
+        return 4;                                                                       /* return error */
+    }
+    if ((mode < INA219_MODE_SHUNT_VOLTAGE_TRIGGERED) ||
+        (mode > INA219_MODE_SHUNT_BUS_VOLTAGE_TRIGGERED))                               /* check the mode */
+    {
+        return 5;                                                                       /* return error */
+    }
+    
+    if (handle->iic_read(handle->iic_addr, INA219_GROUP_REG_CONF, buf, 2) != 0)         /* read the conf */
+    {
+        handle->debug_print("ina219: read conf register failed.\n");                    /* read conf register failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    conf = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);                                  /* get the conf */
+    conf = (uint16_t)((conf & ~0x0007) | mode);                                         /* set the triggered mode */
+    (void)ina219_timing_get_period(conf, &period);                                      /* get the conversion time */
+    if (period > group->wait_us)                                                        /* slowest conversion */
+    {
+        group->wait_us = period;                                                        /* set the wait */
+    }
+    group->handle[group->num] = handle;                                                 /* set the handle */
+    group->addr[group->num] = handle->iic_addr;                                         /* set the address */
+    group->conf[group->num * 2 + 0] = (uint8_t)(conf >> 8);                             /* set the conf msb */
+    group->conf[group->num * 2 + 1] = (uint8_t)(conf & 0xFF);                           /* set the conf lsb */
+    group->num++;                                                                       /* num++ */
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     start a conversion on every device of the group
+ * @param[in] *group pointer to an ina219 group structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 group is NULL
+ *            - 4 group is empty
+ * @note      the cached conf words are written without any delay between them,
+ *            the skew is the time from the end of the first write to the end of the last one,
+ *            a batched write only gives its whole duration so that is used as the skew
+ */
+uint8_t ina219_group_trigger(ina219_group_t *group)
+{
+    uint64_t first = 0;
+    uint64_t last = 0;
+    uint8_t i;
+    
+    if (group == NULL)                                                                   /* check the group */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (group->num == 0)                                                                 /* check the number */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    if (group->iic_write_batch != NULL)                                                  /* one transfer */
+    {
+        first = group->timestamp();                                                      /* get the start */
+        if (group->iic_write_batch(group->addr, INA219_GROUP_REG_CONF,
+                                   group->conf, group->num) != 0)                        /* write all the conf words */
+        {
+            group->handle[0]->debug_print("ina219: write conf register failed.\n");      /* write conf register failed */
+            
+            return 1;                                                                    /* return error */
+        }
+        last = group->timestamp();                                                       /* get the end */
+    }
+    else
+    {
+        for (i = 0; i < group->num; i++)                                                 /* back to back */
+        {
+            ina219_handle_t *handle = group->handle[i];                                  /* get the handle */
+            
+            if (handle->iic_write(handle->iic_addr, INA219_GROUP_REG_CONF,
+                                  &group->conf[i * 2], 2) != 0)                          /* write the conf */
+            {
+                handle->debug_print("ina219: write conf register failed.\n");            /* write conf register failed */
+                
+                return 1;                                                                /* return error */
+            }
+            last = group->timestamp();                                                   /* get the time */
+            if (i == 0)                                                                  /* first device */
+            {
+                first = last;                                                            /* set the first */
+            }
+        }
+    }
+    group->trigger = first;                                                              /* set the trigger time */
+    group->skew_us = (uint32_t)(last - first);                                           /* set the skew */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      wait for the slowest conversion and read every device of the group
+ * @param[in]  *group pointer to an ina219 group structure
+ * @param[out] *sample pointer to a raw sample array with one sample for each device
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 group or sample is NULL
+ *             - 4 group is empty
+ *             - 5 conversion timeout
+ * @note       the group waits once from the trigger time, a device whose conversion
+ *             ready flag is still clear is polled every 1 ms
+ */
+uint8_t ina219_group_read(ina219_group_t *group, ina219_sample_t *sample)
+{
+    uint64_t elapsed;
+    uint8_t i;
+    
+    if ((group == NULL) || (sample == NULL))                                             /* check group and sample */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (group->num == 0)                                                                 /* check the number */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    elapsed = group->timestamp() - group->trigger;                                       /* time since the trigger */
+    if (elapsed < group->wait_us)                                                        /* still converting */
+    {
+        group->handle[0]->delay_ms((uint32_t)((group->wait_us - elapsed + 999) / 1000)); /* wait once */
+    }
+    for (i = 0; i < group->num; i++)                                                     /* read all the devices */
+    {
+        uint8_t times;
+        
+        for (times = 0; times <= INA219_GROUP_MAX_POLL; times++)                         /* poll the ready flag */
+        {
+            if (ina219_read_sample(group->handle[i], &sample[i]) != 0)                   /* read the sample */
+            {
+                return 1;                                                                /* return error */
+            }
+            if ((sample[i].bus_voltage & INA219_GROUP_CNVR) != 0)                        /* check the ready flag */
+            {
+                break;                                                                   /* break */
+            }
+            group->handle[i]->delay_ms(1);                                               /* delay 1 ms */
+        }
+        if (times > INA219_GROUP_MAX_POLL)                                               /* check the times */
+        {
+            group->handle[i]->debug_print("ina219: conversion timeout.\n");              /* conversion timeout */
+            
+            return 5;                                                                    /* return error */
+        }
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the skew of the last trigger
+ * @param[in]  *group pointer to an ina219 group structure
+ * @param[out] *skew_us pointer to a skew buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 2 group or skew_us is NULL
+ * @note       none
+ */
+uint8_t ina219_group_get_skew(ina219_group_t *group, uint32_t *skew_us)
+{
+    if ((group == NULL) || (skew_us == NULL))        /* check group and skew_us */
+    {
+        return 2;                                    /* return error */
+    }
+    
+    *skew_us = group->skew_us;                       /* set the skew */
+    
+    return 0;                                        /* success return 0 */
+}
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_group.h
+ * @brief     driver ina219 group header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_GROUP_H
+#define DRIVER_INA219_GROUP_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_group_driver ina219 group driver function
+ * @brief    ina219 group driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 group max device definition
+ */
+#ifndef INA219_GROUP_MAX_DEVICE
+    #define INA219_GROUP_MAX_DEVICE 16        /**< 16 devices */
+#endif
+
+/**
+ * @brief ina219 group max poll definition
+ */
+#ifndef INA219_GROUP_MAX_POLL
+    #define INA219_GROUP_MAX_POLL 10        /**< 10 ms */
+#endif
+
+/**
+ * @brief ina219 group structure definition
+ */
+typedef struct ina219_group_s
+{
+    ina219_handle_t *handle[INA219_GROUP_MAX_DEVICE];                                           /**< handle table */
+    uint8_t addr[INA219_GROUP_MAX_DEVICE];                                                      /**< iic address table */
+    uint8_t conf[INA219_GROUP_MAX_DEVICE * 2];                                                  /**< triggered conf words, msb first */
+    uint8_t num;                                                                                /**< device number */
+    uint32_t wait_us;                                                                           /**< slowest conversion time in us */
+    uint32_t skew_us;                                                                           /**< last trigger skew in us */
+    uint64_t trigger;                                                                           /**< last trigger time in us */
+    uint64_t (*timestamp)(void);                                                                /**< point to a timestamp function address */
+    uint8_t (*iic_write_batch)(const uint8_t *addr, uint8_t reg, uint8_t *buf, uint8_t num);    /**< point to an iic_write_batch function address */
+} ina219_group_t;
+
+/**
+ * @brief     initialize the trigger group
+ * @param[in] *group pointer to an ina219 group structure
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @param[in] *iic_write_batch pointer to a batched iic write function
+ * @return    status code
+ *            - 0 success
+ *            - 2 group or timestamp is NULL
+ * @note      iic_write_batch can be NULL, then the conf words are written back to back
+ */
+uint8_t ina219_group_init(ina219_group_t *group, uint64_t (*timestamp)(void), uint8_t (*iic_write_batch)(const uint8_t *addr, uint8_t reg, uint8_t *buf, uint8_t num));
+
+/**
+ * @brief     add a device to the trigger group
+ * @param[in] *group pointer to an ina219 group structure
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] mode triggered mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 read conf failed
+ *            - 2 group or handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 group is full
+ *            - 5 mode is not a triggered mode
+ * @note      the conf is read once and cached with the triggered mode,
+ *            so add the device again after its configuration is changed,
+ *            all the handles must share the same bus
+ */
+uint8_t ina219_group_add(ina219_group_t *group, ina219_handle_t *handle, ina219_mode_t mode);
+
+/**
+ * @brief     start a conversion on every device of the group
+ * @param[in] *group pointer to an ina219 group structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 group is NULL
+ *            - 4 group is empty
+ * @note      the cached conf words are written without any delay between them,
+ *            the skew is the time from the end of the first write to the end of the last one,
+ *            a batched write only gives its whole duration so that is used as the skew
+ */
+uint8_t ina219_group_trigger(ina219_group_t *group);
+
+/**
+ * @brief      wait for the slowest conversion and read every device of the group
+ * @param[in]  *group pointer to an ina219 group structure
+ * @param[out] *sample pointer to a raw sample array with one sample for each device
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 group or sample is NULL
+ *             - 4 group is empty
+ *             - 5 conversion timeout
+ * @note       the group waits once from the trigger time, a device whose conversion
+ *             ready flag is still clear is polled every 1 ms
+ */
+uint8_t ina219_group_read(ina219_group_t *group, ina219_sample_t *sample);
+
+/**
+ * @brief      get the skew of the last trigger
+ * @param[in]  *group pointer to an ina219 group structure
+ * @param[out] *skew_us pointer to a skew buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 2 group or skew_us is NULL
+ * @note       none
+ */
+uint8_t ina219_group_get_skew(ina219_group_t *group, uint32_t *skew_us);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
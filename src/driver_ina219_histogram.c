@@ -0,0 +1,468 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_histogram.c
+ * @brief     driver ina219 histogram source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_histogram.h"
+
+/**
+ * @brief histogram serialize definition
+ */
+#define INA219_HISTOGRAM_MAGIC          "IHST"        /**< magic */
+#define INA219_HISTOGRAM_VERSION        1             /**< format version */
+#define INA219_HISTOGRAM_HEADER_SIZE    30            /**< header size */
+
+/**
+ * @brief     get the bucket index of a magnitude
+ * @param[in] v magnitude
+ * @return    bucket index
+ * @note      values below 2 * half bucket are exact, the others share
+ *            half bucket linear buckets per power of two
+ */
+static uint32_t a_ina219_histogram_index(uint32_t v)
+{
+    uint32_t k;
+    uint32_t msb;
+    
+    if (v < (2 * INA219_HISTOGRAM_HALF_BUCKET))                            /* exact range */
+    {
+        return v;                                                          /* return the value */
+    }
+    msb = 0;                                                               /* init 0 */
+    while ((v >> (msb + 1)) != 0)                                          /* find the msb */
+    {
+        msb++;                                                             /* msb++ */
+    }
+    k = msb - INA219_HISTOGRAM_SUB_BUCKET_BITS + 1;                        /* get the shift */
+    
+    return INA219_HISTOGRAM_HALF_BUCKET * k + (v >> k);                    /* return the index */
+}
+
+/**
+ * @brief     get the highest magnitude of a bucket
+ * @param[in] index bucket index
+ * @return    highest magnitude
+ * @note      none
+ */
+static uint32_t a_ina219_histogram_upper(uint32_t index)
+{
+    uint32_t k;
+    uint32_t m;
+    
+    if (index < (2 * INA219_HISTOGRAM_HALF_BUCKET))                        /* exact range */
+    {
+        return index;                                                      /* return the index */
+    }
+    k = index / INA219_HISTOGRAM_HALF_BUCKET - 1;                          /* get the shift */
+    m = index - INA219_HISTOGRAM_HALF_BUCKET * k;                          /* get the sub bucket */
+    
+    return ((m + 1) << k) - 1;                                             /* return the upper */
+}
+
+/**
+ * @brief     get the lowest magnitude of a bucket
+ * @param[in] index bucket index
+ * @return    lowest magnitude
+ * @note      none
+ */
+static uint32_t a_ina219_histogram_lower(uint32_t index)
+{
+    uint32_t k;
+    uint32_t m;
+    
+    if (index < (2 * INA219_HISTOGRAM_HALF_BUCKET))                        /* exact range */
+    {
+        return index;                                                      /* return the index */
+    }
+    k = index / INA219_HISTOGRAM_HALF_BUCKET - 1;                          /* get the shift */
+    m = index - INA219_HISTOGRAM_HALF_BUCKET * k;                          /* get the sub bucket */
+    
+    return m << k;                                                         /* return the lower */
+}
+
+/**
+ * @brief     write a little endian value
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v written value
+ * @param[in] len value length
+ * @note      none
+ */
+static void a_ina219_histogram_put(uint8_t *buf, uint64_t v, uint8_t len)
+{
+    uint8_t i;
+    
+    for (i = 0; i < len; i++)                      /* loop all bytes */
+    {
+        buf[i] = (uint8_t)((v >> (8 * i)) & 0xFF); /* set the byte */
+    }
+}
+
+/**
+ * @brief     read a little endian value
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len value length
+ * @return    read value
+ * @note      none
+ */
+static uint64_t a_ina219_histogram_get(const uint8_t *buf, uint8_t len)
+{
+    uint8_t i;
+    uint64_t v;
+    
+    v = 0;                                         /* init 0 */
+    for (i = 0; i < len; i++)                      /* loop all bytes */
+    {
+        v |= (uint64_t)buf[i] << (8 * i);          /* get the byte */
+    }
+    
+    return v;                                      /* return the value */
+}
+
+/**
+ * @brief     initialize the histogram
+ * @param[in] *hist pointer to an ina219 histogram structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 hist is NULL
+ * @note      also used to reset the histogram
+ */
+uint8_t ina219_histogram_init(ina219_histogram_t *hist)
+{
+    if (hist == NULL)                                     /* check hist */
+    {
+        return 2;                                         /* return error */
+    }
+    
+    memset(hist, 0, sizeof(ina219_histogram_t));          /* clear the histogram */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     record a raw value
+ * @param[in] *hist pointer to an ina219 histogram structure
+ * @param[in] raw raw current or power register value
+ * @return    status code
+ *            - 0 success
+ *            - 2 hist is NULL
+ *            - 4 raw is out of range
+ * @note      -65535 <= raw <= 65535
+ */
+uint8_t ina219_histogram_record(ina219_histogram_t *hist, int32_t raw)
+{
+    uint32_t index;
+    
+    if (hist == NULL)                                                               /* check hist */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if ((raw > 65535) || (raw < -65535))                                            /* check the range */
+    {
+        return 4;                                                                   /* return error */
+    }
+    
+    if (raw < 0)                                                                    /* negative */
+    {
+        index = INA219_HISTOGRAM_SIDE_BUCKET + a_ina219_histogram_index((uint32_t)(-raw));  /* negative side */
+    }
+    else                                                                            /* positive */
+    {
+        index = a_ina219_histogram_index((uint32_t)raw);                            /* positive side */
+    }
+    if (hist->bucket[index] != 0xFFFFFFFFU)                                         /* check the saturation */
+    {
+        hist->bucket[index]++;                                                      /* count++ */
+    }
+    if ((hist->count == 0) || (raw < hist->min))                                    /* check the min */
+    {
+        hist->min = raw;                                                            /* set the min */
+    }
+    if ((hist->count == 0) || (raw > hist->max))                                    /* check the max */
+    {
+        hist->max = raw;                                                            /* set the max */
+    }
+    if (hist->count != 0xFFFFFFFFU)                                                 /* check the saturation */
+    {
+        hist->count++;                                                              /* count++ */
+    }
+    hist->sum += raw;                                                               /* sum */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     merge a histogram into another one
+ * @param[in] *dst pointer to a destination histogram structure
+ * @param[in] *src pointer to a source histogram structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 dst or src is NULL
+ * @note      counts saturate at 0xFFFFFFFF
+ */
+uint8_t ina219_histogram_merge(ina219_histogram_t *dst, const ina219_histogram_t *src)
+{
+    uint32_t i;
+    uint32_t v;
+    
+    if ((dst == NULL) || (src == NULL))                                             /* check dst and src */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (src->count == 0)                                                            /* check the source */
+    {
+        return 0;                                                                   /* success return 0 */
+    }
+    
+    for (i = 0; i < INA219_HISTOGRAM_BUCKET; i++)                                   /* loop all buckets */
+    {
+        v = dst->bucket[i] + src->bucket[i];                                        /* add */
+        dst->bucket[i] = (v < dst->bucket[i]) ? 0xFFFFFFFFU : v;                    /* saturate */
+    }
+    if ((dst->count == 0) || (src->min < dst->min))                                 /* check the min */
+    {
+        dst->min = src->min;                                                        /* set the min */
+    }
+    if ((dst->count == 0) || (src->max > dst->max))                                 /* check the max */
+    {
+        dst->max = src->max;                                                        /* set the max */
+    }
+    v = dst->count + src->count;                                                    /* add */
+    dst->count = (v < dst->count) ? 0xFFFFFFFFU : v;                                /* saturate */
+    dst->sum += src->sum;                                                           /* sum */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the value at a quantile
+ * @param[in]  *hist pointer to an ina219 histogram structure
+ * @param[in]  quantile quantile in [0.0, 1.0]
+ * @param[out] *raw pointer to a raw value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 hist is NULL
+ *             - 4 histogram is empty
+ *             - 5 quantile is invalid
+ * @note       the highest value of the matched bucket is returned
+ */
+uint8_t ina219_histogram_get_quantile(ina219_histogram_t *hist, double quantile, int32_t *raw)
+{
+    uint32_t i;
+    uint64_t rank;
+    uint64_t total;
+    uint64_t acc;
+    int32_t v;
+    uint8_t found;
+    
+    if (hist == NULL)                                                               /* check hist */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (hist->count == 0)                                                           /* check the count */
+    {
+        return 4;                                                                   /* return error */
+    }
+    if ((quantile < 0.0) || (quantile > 1.0))                                       /* check the quantile */
+    {
+        return 5;                                                                   /* return error */
+    }
+    
+    total = 0;                                                                      /* init 0 */
+    for (i = 0; i < INA219_HISTOGRAM_BUCKET; i++)                                   /* loop all buckets */
+    {
+        total += hist->bucket[i];                                                   /* sum the buckets */
+    }
+    rank = (uint64_t)(quantile * (double)total + 0.5);                              /* get the rank */
+    if (rank == 0)                                                                  /* at least one */
+    {
+        rank = 1;                                                                   /* set 1 */
+    }
+    
+    acc = 0;                                                                        /* init 0 */
+    v = hist->max;                                                                  /* default max */
+    found = 0;                                                                      /* not found */
+    for (i = INA219_HISTOGRAM_BUCKET; i > INA219_HISTOGRAM_SIDE_BUCKET; i--)        /* negative side, most negative first */
+    {
+        acc += hist->bucket[i - 1];                                                 /* accumulate */
+        if (acc >= rank)                                                            /* check the rank */
+        {
+            v = -(int32_t)a_ina219_histogram_lower(i - 1 - INA219_HISTOGRAM_SIDE_BUCKET);  /* highest value of the bucket */
+            found = 1;                                                              /* found */
+            
+            break;
+        }
+    }
+    for (i = 0; (found == 0) && (i < INA219_HISTOGRAM_SIDE_BUCKET); i++)            /* positive side */
+    {
+        acc += hist->bucket[i];                                                     /* accumulate */
+        if (acc >= rank)                                                            /* check the rank */
+        {
+            v = (int32_t)a_ina219_histogram_upper(i);                               /* highest value of the bucket */
+            found = 1;                                                              /* found */
+        }
+    }
+    if (v > hist->max)                                                              /* clamp to the max */
+    {
+        v = hist->max;                                                              /* set the max */
+    }
+    if (v < hist->min)                                                              /* clamp to the min */
+    {
+        v = hist->min;                                                              /* set the min */
+    }
+    *raw = v;                                                                       /* set the raw */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      serialize the histogram
+ * @param[in]  *hist pointer to an ina219 histogram structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *out_len pointer to a written length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 hist is NULL
+ *             - 4 buffer is too small
+ * @note       only the non zero buckets are stored, little endian
+ */
+uint8_t ina219_histogram_serialize(ina219_histogram_t *hist, uint8_t *buf, uint32_t len, uint32_t *out_len)
+{
+    uint32_t i;
+    uint32_t num;
+    uint32_t pos;
+    
+    if (hist == NULL)                                                               /* check hist */
+    {
+        return 2;                                                                   /* return error */
+    }
+    
+    num = 0;                                                                        /* init 0 */
+    for (i = 0; i < INA219_HISTOGRAM_BUCKET; i++)                                   /* loop all buckets */
+    {
+        if (hist->bucket[i] != 0)                                                   /* check the bucket */
+        {
+            num++;                                                                  /* num++ */
+        }
+    }
+    if (len < (INA219_HISTOGRAM_HEADER_SIZE + num * 6))                             /* check the length */
+    {
+        return 4;                                                                   /* return error */
+    }
+    
+    memcpy(buf, INA219_HISTOGRAM_MAGIC, 4);                                         /* set the magic */
+    buf[4] = INA219_HISTOGRAM_VERSION;                                              /* set the version */
+    buf[5] = INA219_HISTOGRAM_SUB_BUCKET_BITS;                                      /* set the bits */
+    buf[6] = 0;                                                                     /* reserved */
+    buf[7] = 0;                                                                     /* reserved */
+    a_ina219_histogram_put(&buf[8], hist->count, 4);                                /* set the count */
+    a_ina219_histogram_put(&buf[12], (uint32_t)hist->min, 4);                       /* set the min */
+    a_ina219_histogram_put(&buf[16], (uint32_t)hist->max, 4);                       /* set the max */
+    a_ina219_histogram_put(&buf[20], (uint64_t)hist->sum, 8);                       /* set the sum */
+    a_ina219_histogram_put(&buf[28], num, 2);                                       /* set the bucket number */
+    pos = INA219_HISTOGRAM_HEADER_SIZE;                                             /* set the position */
+    for (i = 0; i < INA219_HISTOGRAM_BUCKET; i++)                                   /* loop all buckets */
+    {
+        if (hist->bucket[i] != 0)                                                   /* check the bucket */
+        {
+            a_ina219_histogram_put(&buf[pos], i, 2);                                /* set the index */
+            a_ina219_histogram_put(&buf[pos + 2], hist->bucket[i], 4);              /* set the count */
+            pos += 6;                                                               /* position += 6 */
+        }
+    }
+    *out_len = pos;                                                                 /* set the length */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     deserialize the histogram
+ * @param[in] *hist pointer to an ina219 histogram structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 hist is NULL
+ *            - 4 data is invalid
+ * @note      the sub bucket bits must be the same
+ */
+uint8_t ina219_histogram_deserialize(ina219_histogram_t *hist, const uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+    uint32_t num;
+    uint32_t index;
+    uint32_t pos;
+    
+    if (hist == NULL)                                                               /* check hist */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (len < INA219_HISTOGRAM_HEADER_SIZE)                                         /* check the length */
+    {
+        return 4;                                                                   /* return error */
+    }
+    if ((memcmp(buf, INA219_HISTOGRAM_MAGIC, 4) != 0) ||                            /* check the magic */
+        (buf[4] != INA219_HISTOGRAM_VERSION) ||                                     /* check the version */
+        (buf[5] != INA219_HISTOGRAM_SUB_BUCKET_BITS))                               /* check the bits */
+    {
+        return 4;                                                                   /* return error */
+    }
+    num = (uint32_t)a_ina219_histogram_get(&buf[28], 2);                            /* get the bucket number */
+    if ((num > INA219_HISTOGRAM_BUCKET) ||
+        (len < (INA219_HISTOGRAM_HEADER_SIZE + num * 6)))                           /* check the length */
+    {
+        return 4;                                                                   /* return error */
+    }
+    
+    memset(hist, 0, sizeof(ina219_histogram_t));                                    /* clear the histogram */
+    hist->count = (uint32_t)a_ina219_histogram_get(&buf[8], 4);                     /* get the count */
+    hist->min = (int32_t)(uint32_t)a_ina219_histogram_get(&buf[12], 4);             /* get the min */
+    hist->max = (int32_t)(uint32_t)a_ina219_histogram_get(&buf[16], 4);             /* get the max */
+    hist->sum = (int64_t)a_ina219_histogram_get(&buf[20], 8);                       /* get the sum */
+    pos = INA219_HISTOGRAM_HEADER_SIZE;                                             /* set the position */
+    for (i = 0; i < num; i++)                                                       /* loop all buckets */
+    {
+        index = (uint32_t)a_ina219_histogram_get(&buf[pos], 2);                     /* get the index */
+        if (index >= INA219_HISTOGRAM_BUCKET)                                       /* check the index */
+        {
+            (void)ina219_histogram_init(hist);                                      /* clear the histogram */
+            
+            return 4;                                                               /* return error */
+        }
+        hist->bucket[index] = (uint32_t)a_ina219_histogram_get(&buf[pos + 2], 4);   /* get the count */
+        pos += 6;                                                                   /* position += 6 */
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
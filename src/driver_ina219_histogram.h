@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_histogram.h
+ * @brief     driver ina219 histogram header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_HISTOGRAM_H
+#define DRIVER_INA219_HISTOGRAM_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_histogram_driver ina219 histogram driver function
+ * @brief    ina219 histogram driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 histogram sub bucket bits definition
+ * @note  the relative error of a bucket is 1 / 2^(bits - 1)
+ */
+#ifndef INA219_HISTOGRAM_SUB_BUCKET_BITS
+    #define INA219_HISTOGRAM_SUB_BUCKET_BITS 5        /**< 6.25% */
+#endif
+
+/**
+ * @brief ina219 histogram size definition
+ */
+#define INA219_HISTOGRAM_HALF_BUCKET         (1 << (INA219_HISTOGRAM_SUB_BUCKET_BITS - 1))                             /**< half sub bucket count */
+#define INA219_HISTOGRAM_SIDE_BUCKET         (INA219_HISTOGRAM_HALF_BUCKET * (18 - INA219_HISTOGRAM_SUB_BUCKET_BITS))  /**< buckets of one sign */
+#define INA219_HISTOGRAM_BUCKET              (INA219_HISTOGRAM_SIDE_BUCKET * 2)                                        /**< all buckets */
+#define INA219_HISTOGRAM_SERIALIZE_MAX_SIZE  (30 + INA219_HISTOGRAM_BUCKET * 6)                                        /**< max serialized size */
+
+/**
+ * @brief ina219 histogram structure definition
+ */
+typedef struct ina219_histogram_s
+{
+    uint32_t count;                                   /**< total count */
+    int32_t min;                                      /**< min raw value */
+    int32_t max;                                      /**< max raw value */
+    int64_t sum;                                      /**< sum of raw values */
+    uint32_t bucket[INA219_HISTOGRAM_BUCKET];         /**< bucket table */
+} ina219_histogram_t;
+
+/**
+ * @brief     initialize the histogram
+ * @param[in] *hist pointer to an ina219 histogram structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 hist is NULL
+ * @note      also used to reset the histogram
+ */
+uint8_t ina219_histogram_init(ina219_histogram_t *hist);
+
+/**
+ * @brief     record a raw value
+ * @param[in] *hist pointer to an ina219 histogram structure
+ * @param[in] raw raw current or power register value
+ * @return    status code
+ *            - 0 success
+ *            - 2 hist is NULL
+ *            - 4 raw is out of range
+ * @note      -65535 <= raw <= 65535
+ */
+uint8_t ina219_histogram_record(ina219_histogram_t *hist, int32_t raw);
+
+/**
+ * @brief     merge a histogram into another one
+ * @param[in] *dst pointer to a destination histogram structure
+ * @param[in] *src pointer to a source histogram structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 dst or src is NULL
+ * @note      counts saturate at 0xFFFFFFFF
+ */
+uint8_t ina219_histogram_merge(ina219_histogram_t *dst, const ina219_histogram_t *src);
+
+/**
+ * @brief      get the value at a quantile
+ * @param[in]  *hist pointer to an ina219 histogram structure
+ * @param[in]  quantile quantile in [0.0, 1.0]
+ * @param[out] *raw pointer to a raw value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 hist is NULL
+ *             - 4 histogram is empty
+ *             - 5 quantile is invalid
+ * @note       the highest value of the matched bucket is returned
+ */
+uint8_t ina219_histogram_get_quantile(ina219_histogram_t *hist, double quantile, int32_t *raw);
+
+/**
+ * @brief      serialize the histogram
+ * @param[in]  *hist pointer to an ina219 histogram structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *out_len pointer to a written length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 hist is NULL
+ *             - 4 buffer is too small
+ * @note       only the non zero buckets are stored, little endian
+ */
+uint8_t ina219_histogram_serialize(ina219_histogram_t *hist, uint8_t *buf, uint32_t len, uint32_t *out_len);
+
+/**
+ * @brief     deserialize the histogram
+ * @param[in] *hist pointer to an ina219 histogram structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 hist is NULL
+ *            - 4 data is invalid
+ * @note      the sub bucket bits must be the same
+ */
+uint8_t ina219_histogram_deserialize(ina219_histogram_t *hist, const uint8_t *buf, uint32_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
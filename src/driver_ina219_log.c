@@ -0,0 +1,920 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_log.c
+ * @brief     driver ina219 log source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_log.h"
+
+/**
+ * @brief     put a 16 bit little endian value
+ * @param[in] *p pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_ina219_log_put16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v);              /* low byte */
+    p[1] = (uint8_t)(v >> 8);         /* high byte */
+}
+
+/**
+ * @brief     put a 32 bit little endian value
+ * @param[in] *p pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_ina219_log_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v);               /* byte 0 */
+    p[1] = (uint8_t)(v >> 8);          /* byte 1 */
+    p[2] = (uint8_t)(v >> 16);         /* byte 2 */
+    p[3] = (uint8_t)(v >> 24);         /* byte 3 */
+}
+
+/**
+ * @brief     put a 64 bit little endian value
+ * @param[in] *p pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_ina219_log_put64(uint8_t *p, uint64_t v)
+{
+    a_ina219_log_put32(p, (uint32_t)v);                  /* low word */
+    a_ina219_log_put32(p + 4, (uint32_t)(v >> 32));      /* high word */
+}
+
+/**
+ * @brief     get a 16 bit little endian value
+ * @param[in] *p pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint16_t a_ina219_log_get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));        /* return the value */
+}
+
+/**
+ * @brief     get a 32 bit little endian value
+ * @param[in] *p pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_ina219_log_get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);        /* return the value */
+}
+
+/**
+ * @brief     get a 64 bit little endian value
+ * @param[in] *p pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint64_t a_ina219_log_get64(const uint8_t *p)
+{
+    return (uint64_t)a_ina219_log_get32(p) | ((uint64_t)a_ina219_log_get32(p + 4) << 32);        /* return the value */
+}
+
+/**
+ * @brief     zig-zag encode a signed value
+ * @param[in] v signed value
+ * @return    unsigned value
+ * @note      none
+ */
+static uint64_t a_ina219_log_zigzag(int64_t v)
+{
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);        /* zig-zag */
+}
+
+/**
+ * @brief     zig-zag decode an unsigned value
+ * @param[in] u unsigned value
+ * @return    signed value
+ * @note      none
+ */
+static int64_t a_ina219_log_unzigzag(uint64_t u)
+{
+    return (int64_t)(u >> 1) ^ -(int64_t)(u & 1);        /* zig-zag */
+}
+
+/**
+ * @brief     put a varint
+ * @param[in] *p pointer to a data buffer
+ * @param[in] u unsigned value
+ * @return    written length
+ * @note      none
+ */
+static uint32_t a_ina219_log_put_varint(uint8_t *p, uint64_t u)
+{
+    uint32_t n = 0;
+    
+    while (u >= 0x80)                                /* more than 7 bits */
+    {
+        p[n++] = (uint8_t)(u | 0x80);                /* set the byte */
+        u >>= 7;                                     /* next 7 bits */
+    }
+    p[n++] = (uint8_t)u;                             /* set the last byte */
+    
+    return n;                                        /* return the length */
+}
+
+/**
+ * @brief         get a varint
+ * @param[in]     *p pointer to a data buffer
+ * @param[in]     len length of the data buffer
+ * @param[in,out] *pos pointer to a position buffer
+ * @param[out]    *u pointer to a value buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 data is corrupted
+ * @note          none
+ */
+static uint8_t a_ina219_log_get_varint(const uint8_t *p, uint32_t len, uint32_t *pos, uint64_t *u)
+{
+    uint8_t shift = 0;
+    
+    *u = 0;                                                /* init 0 */
+    while (*pos < len)                                     /* check the length */
+    {
+        uint8_t b = p[(*pos)++];                           /* get the byte */
+        
+        *u |= (uint64_t)(b & 0x7F) << shift;               /* set the bits */
+        if ((b & 0x80) == 0)                               /* last byte */
+        {
+            return 0;                                      /* success return 0 */
+        }
+        shift += 7;                                        /* next 7 bits */
+        if (shift > 63)                                    /* check the shift */
+        {
+            return 1;                                      /* return error */
+        }
+    }
+    
+    return 1;                                              /* return error */
+}
+
+/**
+ * @brief     calculate the crc32 of a buffer
+ * @param[in] crc initial crc, 0 for a new crc
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    crc32
+ * @note      ieee 802.3 polynomial, pass the last result to continue
+ */
+uint32_t ina219_log_crc32(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+    static const uint32_t table[16] =
+    {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    uint32_t i;
+    
+    crc = ~crc;                                                    /* invert */
+    for (i = 0; i < len; i++)                                      /* loop all bytes */
+    {
+        crc = (crc >> 4) ^ table[(crc ^ buf[i]) & 0x0F];           /* low nibble */
+        crc = (crc >> 4) ^ table[(crc ^ (buf[i] >> 4)) & 0x0F];    /* high nibble */
+    }
+    
+    return ~crc;                                                   /* return the crc */
+}
+
+/**
+ * @brief     initialize the log writer
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] *buf pointer to a block buffer
+ * @param[in] len length of the block buffer
+ * @param[in] *output pointer to an output function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 output file header failed
+ *            - 2 writer, buf or output is NULL
+ *            - 4 buffer is too small
+ * @note      the file header is written at once, each block is output as one call
+ */
+uint8_t ina219_log_writer_init(ina219_log_writer_t *writer, uint8_t *buf, uint32_t len, uint8_t (*output)(const uint8_t *buf, uint32_t len))
+{
+    uint8_t header[INA219_LOG_FILE_HEADER_SIZE];
+    
+    if ((writer == NULL) || (buf == NULL) || (output == NULL))                /* check writer, buf and output */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (len < (INA219_LOG_BLOCK_HEADER_SIZE + INA219_LOG_SAMPLE_MAX_SIZE))    /* check the length */
+    {
+        return 4;                                                             /* return error */
+    }
+    
+    memset(writer, 0, sizeof(ina219_log_writer_t));                           /* clear the writer */
+    writer->buf = buf;                                                        /* set the buffer */
+    writer->len = len;                                                        /* set the length */
+    writer->pos = INA219_LOG_BLOCK_HEADER_SIZE;                               /* set the position */
+    writer->mask = INA219_LOG_CHANNEL_ALL;                                    /* log all channels */
+    writer->output = output;                                                  /* set the output */
+    header[0] = 'I';                                                          /* set the magic */
+    header[1] = 'N';                                                          /* set the magic */
+    header[2] = 'A';                                                          /* set the magic */
+    header[3] = 'L';                                                          /* set the magic */
+    a_ina219_log_put16(&header[4], INA219_LOG_VERSION);                       /* set the version */
+    a_ina219_log_put16(&header[6], INA219_LOG_BLOCK_HEADER_SIZE);             /* set the block header size */
+    if (output(header, INA219_LOG_FILE_HEADER_SIZE) != 0)                     /* output the header */
+    {
+        return 1;                                                             /* return error */
+    }
+    writer->offset = INA219_LOG_FILE_HEADER_SIZE;                             /* set the offset */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the block index table
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] *index pointer to an index table
+ * @param[in] len index table length
+ * @return    status code
+ *            - 0 success
+ *            - 2 writer or index is NULL
+ *            - 4 len is invalid or blocks are already output
+ * @note      when the table is full every second entry is dropped,
+ *            so the index stays sparse and bounded, len >= 2
+ */
+uint8_t ina219_log_writer_set_index(ina219_log_writer_t *writer, ina219_log_index_entry_t *index, uint32_t len)
+{
+    if ((writer == NULL) || (index == NULL))                    /* check writer and index */
+    {
+        return 2;                                               /* return error */
+    }
+    if ((len < 2) || (writer->block != 0))                      /* check the length */
+    {
+        return 4;                                               /* return error */
+    }
+    
+    writer->index = index;                                      /* set the index */
+    writer->index_len = len;                                    /* set the length */
+    writer->index_num = 0;                                      /* reset the number */
+    writer->index_interval = 1;                                 /* index every block */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     set the block context
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] calibration calibration register
+ * @param[in] conf conf register
+ * @param[in] mask logged channel mask
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 writer is NULL
+ *            - 4 mask is invalid
+ * @note      the current block is flushed when it is not empty
+ */
+uint8_t ina219_log_writer_set_context(ina219_log_writer_t *writer, uint16_t calibration, uint16_t conf, uint8_t mask)
+{
+    if (writer == NULL)                                         /* check writer */
+    {
+        return 2;                                               /* return error */
+    }
+    if ((mask == 0) || (mask > INA219_LOG_CHANNEL_ALL))         /* check the mask */
+    {
+        return 4;                                               /* return error */
+    }
+    
+    if (ina219_log_writer_flush(writer) != 0)                   /* flush the block */
+    {
+        return 1;                                               /* return error */
+    }
+    writer->calibration = calibration;                          /* set the calibration */
+    writer->conf = conf;                                        /* set the conf */
+    writer->mask = mask;                                        /* set the mask */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     write a sample
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] timestamp timestamp in us
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 writer or sample is NULL
+ * @note      the block is flushed when it is full
+ */
+uint8_t ina219_log_writer_write(ina219_log_writer_t *writer, uint64_t timestamp, const ina219_sample_t *sample)
+{
+    int32_t v[4];
+    uint8_t i;
+    
+    if ((writer == NULL) || (sample == NULL))                                             /* check writer and sample */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    if ((writer->pos + INA219_LOG_SAMPLE_MAX_SIZE) > writer->len)                         /* check the space */
+    {
+        if (ina219_log_writer_flush(writer) != 0)                                         /* flush the block */
+        {
+            return 1;                                                                     /* return error */
+        }
+    }
+    if (writer->count == 0)                                                               /* first sample */
+    {
+        writer->first = timestamp;                                                        /* set the first */
+        writer->delta = 0;                                                                /* reset the delta */
+        memset(writer->prev, 0, sizeof(writer->prev));                                    /* reset the values */
+    }
+    else
+    {
+        int64_t d;
+        
+        d = (int64_t)(timestamp - writer->last);                                          /* get the delta */
+        writer->pos += a_ina219_log_put_varint(&writer->buf[writer->pos],
+                                               a_ina219_log_zigzag(d - writer->delta));   /* delta of delta */
+        writer->delta = d;                                                                /* save the delta */
+    }
+    writer->last = timestamp;                                                             /* save the timestamp */
+    v[0] = sample->shunt_voltage;                                                         /* shunt voltage */
+    v[1] = sample->bus_voltage;                                                           /* bus voltage */
+    v[2] = sample->current;                                                               /* current */
+    v[3] = sample->power;                                                                 /* power */
+    for (i = 0; i < 4; i++)                                                               /* loop all channels */
+    {
+        if ((writer->mask & (1 << i)) != 0)                                               /* check the mask */
+        {
+            writer->pos += a_ina219_log_put_varint(&writer->buf[writer->pos],
+                                                   a_ina219_log_zigzag(v[i] - writer->prev[i]));    /* value delta */
+            writer->prev[i] = v[i];                                                       /* save the value */
+        }
+    }
+    writer->count++;                                                                      /* count++ */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     flush the current block
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 writer is NULL
+ * @note      an empty block is not output
+ */
+uint8_t ina219_log_writer_flush(ina219_log_writer_t *writer)
+{
+    uint8_t *h;
+    uint32_t crc;
+    
+    if (writer == NULL)                                                                       /* check writer */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (writer->count == 0)                                                                   /* empty block */
+    {
+        return 0;                                                                             /* success return 0 */
+    }
+    
+    h = writer->buf;                                                                          /* header */
+    h[0] = 'I';                                                                               /* set the magic */
+    h[1] = 'N';                                                                               /* set the magic */
+    h[2] = 'A';                                                                               /* set the magic */
+    h[3] = 'B';                                                                               /* set the magic */
+    a_ina219_log_put32(&h[4], writer->pos - INA219_LOG_BLOCK_HEADER_SIZE);                    /* set the payload length */
+    a_ina219_log_put32(&h[8], writer->count);                                                 /* set the count */
+    a_ina219_log_put64(&h[16], writer->first);                                                /* set the first */
+    a_ina219_log_put64(&h[24], writer->last);                                                 /* set the last */
+    a_ina219_log_put16(&h[32], writer->calibration);                                          /* set the calibration */
+    a_ina219_log_put16(&h[34], writer->conf);                                                 /* set the conf */
+    h[36] = writer->mask;                                                                     /* set the mask */
+    h[37] = 0;                                                                                /* reserved */
+    h[38] = 0;                                                                                /* reserved */
+    h[39] = 0;                                                                                /* reserved */
+    crc = ina219_log_crc32(0, &h[16], writer->pos - 16);                                      /* get the crc */
+    a_ina219_log_put32(&h[12], crc);                                                          /* set the crc */
+    writer->count = 0;                                                                        /* reset the count */
+    if (writer->output(writer->buf, writer->pos) != 0)                                        /* output the block */
+    {
+        writer->pos = INA219_LOG_BLOCK_HEADER_SIZE;                                           /* reset the position */
+        
+        return 1;                                                                             /* return error */
+    }
+    if ((writer->index != NULL) && ((writer->block % writer->index_interval) == 0))          /* index this block */
+    {
+        if (writer->index_num == writer->index_len)                                           /* index is full */
+        {
+            uint32_t i;
+            
+            for (i = 0; (i * 2) < writer->index_num; i++)                                     /* keep every second entry */
+            {
+                writer->index[i] = writer->index[i * 2];                                      /* move the entry */
+            }
+            writer->index_num = i;                                                            /* set the number */
+            writer->index_interval *= 2;                                                      /* double the interval */
+        }
+        if ((writer->block % writer->index_interval) == 0)                                    /* check the interval */
+        {
+            writer->index[writer->index_num].timestamp = writer->first;                       /* set the timestamp */
+            writer->index[writer->index_num].offset = writer->offset;                         /* set the offset */
+            writer->index_num++;                                                              /* index_num++ */
+        }
+    }
+    writer->offset += writer->pos;                                                            /* update the offset */
+    writer->block++;                                                                          /* block++ */
+    writer->pos = INA219_LOG_BLOCK_HEADER_SIZE;                                               /* reset the position */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     flush the current block when its first sample gets too old
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] timestamp time of the next write in us
+ * @param[in] age_us max time in us a sample is held in the block
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 writer is NULL
+ * @note      call it after each write with the time of the next one, so a sample
+ *            is never held longer than age_us whatever the sample rate
+ */
+uint8_t ina219_log_writer_flush_age(ina219_log_writer_t *writer, uint64_t timestamp, uint32_t age_us)
+{
+    if (writer == NULL)                                                   /* check writer */
+    {
+        return 2;                                                         /* return error */
+    }
+    
+    if ((writer->count != 0) && (timestamp >= writer->first) &&
+        ((timestamp - writer->first) >= age_us))                          /* check the age */
+    {
+        return ina219_log_writer_flush(writer);                           /* flush the block */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     finish the log
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 writer is NULL
+ * @note      the last block is flushed and the index footer is written when an index table is set
+ */
+uint8_t ina219_log_writer_finish(ina219_log_writer_t *writer)
+{
+    uint8_t trailer[INA219_LOG_TRAILER_SIZE];
+    uint64_t index_offset;
+    uint32_t crc;
+    uint32_t i;
+    uint32_t n;
+    
+    if (writer == NULL)                                                                   /* check writer */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    if (ina219_log_writer_flush(writer) != 0)                                             /* flush the block */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (writer->index == NULL)                                                            /* no index */
+    {
+        return 0;                                                                         /* success return 0 */
+    }
+    index_offset = writer->offset;                                                        /* save the index offset */
+    crc = 0;                                                                              /* init 0 */
+    n = 0;                                                                                /* init 0 */
+    for (i = 0; i < writer->index_num; i++)                                               /* loop all entries */
+    {
+        a_ina219_log_put64(&writer->buf[n], writer->index[i].timestamp);                  /* set the timestamp */
+        a_ina219_log_put64(&writer->buf[n + 8], writer->index[i].offset);                 /* set the offset */
+        n += INA219_LOG_INDEX_ENTRY_SIZE;                                                 /* next entry */
+        if (((n + INA219_LOG_INDEX_ENTRY_SIZE) > writer->len) || ((i + 1) == writer->index_num))    /* buffer full or last */
+        {
+            crc = ina219_log_crc32(crc, writer->buf, n);                                  /* update the crc */
+            if (writer->output(writer->buf, n) != 0)                                      /* output the entries */
+            {
+                return 1;                                                                 /* return error */
+            }
+            writer->offset += n;                                                          /* update the offset */
+            n = 0;                                                                        /* reset */
+        }
+    }
+    a_ina219_log_put64(&trailer[0], index_offset);                                        /* set the index offset */
+    a_ina219_log_put32(&trailer[8], writer->index_num);                                   /* set the entry number */
+    a_ina219_log_put32(&trailer[12], crc);                                                /* set the crc */
+    trailer[16] = 'I';                                                                    /* set the magic */
+    trailer[17] = 'N';                                                                    /* set the magic */
+    trailer[18] = 'A';                                                                    /* set the magic */
+    trailer[19] = 'X';                                                                    /* set the magic */
+    if (writer->output(trailer, INA219_LOG_TRAILER_SIZE) != 0)                            /* output the trailer */
+    {
+        return 1;                                                                         /* return error */
+    }
+    writer->offset += INA219_LOG_TRAILER_SIZE;                                            /* update the offset */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     check the file header
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 buf is NULL
+ *            - 4 header is invalid
+ *            - 5 version is not supported
+ * @note      none
+ */
+uint8_t ina219_log_check_file_header(const uint8_t *buf, uint32_t len)
+{
+    if (buf == NULL)                                                                  /* check buf */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if ((len < INA219_LOG_FILE_HEADER_SIZE) ||
+        (buf[0] != 'I') || (buf[1] != 'N') || (buf[2] != 'A') || (buf[3] != 'L'))     /* check the magic */
+    {
+        return 4;                                                                     /* return error */
+    }
+    if ((a_ina219_log_get16(&buf[4]) != INA219_LOG_VERSION) ||
+        (a_ina219_log_get16(&buf[6]) != INA219_LOG_BLOCK_HEADER_SIZE))                /* check the version */
+    {
+        return 5;                                                                     /* return error */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      parse a block
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *block pointer to an ina219 log block structure
+ * @param[out] *size pointer to a block size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf, block or size is NULL
+ *             - 4 block is incomplete
+ *             - 5 magic is invalid
+ *             - 6 crc is invalid
+ * @note       the block payload points into buf, nothing is copied
+ */
+uint8_t ina219_log_parse_block(const uint8_t *buf, uint32_t len, ina219_log_block_t *block, uint32_t *size)
+{
+    uint32_t payload;
+    
+    if ((buf == NULL) || (block == NULL) || (size == NULL))                               /* check buf, block and size */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (len < INA219_LOG_BLOCK_HEADER_SIZE)                                               /* check the header */
+    {
+        return 4;                                                                         /* return error */
+    }
+    if ((buf[0] != 'I') || (buf[1] != 'N') || (buf[2] != 'A') || (buf[3] != 'B'))         /* check the magic */
+    {
+        return 5;                                                                         /* return error */
+    }
+    payload = a_ina219_log_get32(&buf[4]);                                                /* get the payload length */
+    if (payload > (len - INA219_LOG_BLOCK_HEADER_SIZE))                                   /* check the payload */
+    {
+        return 4;                                                                         /* return error */
+    }
+    if (ina219_log_crc32(0, &buf[16], payload + INA219_LOG_BLOCK_HEADER_SIZE - 16) !=
+        a_ina219_log_get32(&buf[12]))                                                     /* check the crc */
+    {
+        return 6;                                                                         /* return error */
+    }
+    
+    block->len = payload;                                                                 /* set the length */
+    block->count = a_ina219_log_get32(&buf[8]);                                           /* set the count */
+    block->first = a_ina219_log_get64(&buf[16]);                                          /* set the first */
+    block->last = a_ina219_log_get64(&buf[24]);                                           /* set the last */
+    block->calibration = a_ina219_log_get16(&buf[32]);                                    /* set the calibration */
+    block->conf = a_ina219_log_get16(&buf[34]);                                           /* set the conf */
+    block->mask = buf[36];                                                                /* set the mask */
+    block->payload = &buf[INA219_LOG_BLOCK_HEADER_SIZE];                                  /* set the payload */
+    *size = INA219_LOG_BLOCK_HEADER_SIZE + payload;                                       /* set the size */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     initialize a block decoder
+ * @param[in] *decoder pointer to an ina219 log decoder structure
+ * @param[in] *block pointer to a parsed block structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder or block is NULL
+ * @note      the block must stay valid while decoding
+ */
+uint8_t ina219_log_decoder_init(ina219_log_decoder_t *decoder, const ina219_log_block_t *block)
+{
+    if ((decoder == NULL) || (block == NULL))                   /* check decoder and block */
+    {
+        return 2;                                               /* return error */
+    }
+    
+    memset(decoder, 0, sizeof(ina219_log_decoder_t));           /* clear the decoder */
+    decoder->block = block;                                     /* set the block */
+    decoder->timestamp = block->first;                          /* set the timestamp */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief      decode the next sample
+ * @param[in]  *decoder pointer to an ina219 log decoder structure
+ * @param[out] *timestamp pointer to a timestamp buffer
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 decoder is NULL
+ *             - 4 end of the block
+ *             - 5 data is corrupted
+ * @note       channels not in the block mask are set to 0
+ */
+uint8_t ina219_log_decoder_next(ina219_log_decoder_t *decoder, uint64_t *timestamp, ina219_sample_t *sample)
+{
+    const ina219_log_block_t *block;
+    uint64_t u;
+    int32_t v[4];
+    uint8_t i;
+    
+    if (decoder == NULL)                                                                  /* check decoder */
+    {
+        return 2;                                                                         /* return error */
+    }
+    block = decoder->block;                                                               /* get the block */
+    if (decoder->index >= block->count)                                                   /* check the index */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    if (decoder->index != 0)                                                              /* not the first sample */
+    {
+        if (a_ina219_log_get_varint(block->payload, block->len, &decoder->pos, &u) != 0)  /* delta of delta */
+        {
+            return 5;                                                                     /* return error */
+        }
+        decoder->delta += a_ina219_log_unzigzag(u);                                       /* update the delta */
+        decoder->timestamp += (uint64_t)decoder->delta;                                   /* update the timestamp */
+    }
+    for (i = 0; i < 4; i++)                                                               /* loop all channels */
+    {
+        v[i] = 0;                                                                         /* init 0 */
+        if ((block->mask & (1 << i)) != 0)                                                /* check the mask */
+        {
+            if (a_ina219_log_get_varint(block->payload, block->len, &decoder->pos, &u) != 0)    /* value delta */
+            {
+                return 5;                                                                 /* return error */
+            }
+            decoder->prev[i] += (int32_t)a_ina219_log_unzigzag(u);                        /* update the value */
+            v[i] = decoder->prev[i];                                                      /* set the value */
+        }
+    }
+    decoder->index++;                                                                     /* index++ */
+    *timestamp = decoder->timestamp;                                                      /* set the timestamp */
+    sample->shunt_voltage = (int16_t)v[0];                                                /* set the shunt voltage */
+    sample->bus_voltage = (uint16_t)v[1];                                                 /* set the bus voltage */
+    sample->current = (int16_t)v[2];                                                      /* set the current */
+    sample->power = (uint16_t)v[3];                                                       /* set the power */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     initialize the log reader
+ * @param[in] *reader pointer to an ina219 log reader structure
+ * @param[in] *buf pointer to a whole file view
+ * @param[in] len file length
+ * @return    status code
+ *            - 0 success
+ *            - 2 reader or buf is NULL
+ *            - 4 header is invalid
+ *            - 5 version is not supported
+ * @note      a file without a valid index footer is read without index
+ */
+uint8_t ina219_log_reader_init(ina219_log_reader_t *reader, const uint8_t *buf, uint64_t len)
+{
+    uint8_t res;
+    
+    if ((reader == NULL) || (buf == NULL))                                                /* check reader and buf */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    res = ina219_log_check_file_header(buf, (len > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)len);    /* check the header */
+    if (res != 0)                                                                         /* check the result */
+    {
+        return res;                                                                       /* return error */
+    }
+    reader->buf = buf;                                                                    /* set the buffer */
+    reader->len = len;                                                                    /* set the length */
+    reader->end = len;                                                                    /* no index */
+    reader->index = NULL;                                                                 /* no index */
+    reader->index_num = 0;                                                                /* no index */
+    if (len >= (INA219_LOG_FILE_HEADER_SIZE + INA219_LOG_TRAILER_SIZE))                   /* check the length */
+    {
+        const uint8_t *t = &buf[len - INA219_LOG_TRAILER_SIZE];                           /* trailer */
+        uint64_t offset = a_ina219_log_get64(&t[0]);                                      /* get the index offset */
+        uint32_t num = a_ina219_log_get32(&t[8]);                                         /* get the entry number */
+        
+        if ((t[16] == 'I') && (t[17] == 'N') && (t[18] == 'A') && (t[19] == 'X') &&
+            (offset >= INA219_LOG_FILE_HEADER_SIZE) &&
+            (offset + (uint64_t)num * INA219_LOG_INDEX_ENTRY_SIZE + INA219_LOG_TRAILER_SIZE == len) &&
+            (ina219_log_crc32(0, &buf[offset], num * INA219_LOG_INDEX_ENTRY_SIZE) ==
+             a_ina219_log_get32(&t[12])))                                                 /* check the trailer */
+        {
+            reader->end = offset;                                                         /* set the end */
+            reader->index = &buf[offset];                                                 /* set the index */
+            reader->index_num = num;                                                      /* set the number */
+        }
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      seek the block containing a timestamp
+ * @param[in]  *reader pointer to an ina219 log reader structure
+ * @param[in]  timestamp timestamp in us
+ * @param[out] *offset pointer to a block offset buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 reader or offset is NULL
+ *             - 4 timestamp is after the end of the log
+ *             - 5 block is invalid
+ * @note       the offset is the first block which ends at or after the timestamp,
+ *             the index is searched in O(log n) and at most one index interval of block headers is walked
+ */
+uint8_t ina219_log_reader_seek(ina219_log_reader_t *reader, uint64_t timestamp, uint64_t *offset)
+{
+    uint64_t pos;
+    uint32_t lo;
+    uint32_t hi;
+    
+    if ((reader == NULL) || (offset == NULL))                                             /* check reader and offset */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    pos = INA219_LOG_FILE_HEADER_SIZE;                                                    /* first block */
+    lo = 0;                                                                               /* init 0 */
+    hi = reader->index_num;                                                               /* init the number */
+    while (lo < hi)                                                                       /* binary search */
+    {
+        uint32_t mid = lo + (hi - lo) / 2;                                                /* get the middle */
+        
+        if (a_ina219_log_get64(&reader->index[mid * INA219_LOG_INDEX_ENTRY_SIZE]) <= timestamp)    /* check the timestamp */
+        {
+            lo = mid + 1;                                                                 /* right part */
+        }
+        else
+        {
+            hi = mid;                                                                     /* left part */
+        }
+    }
+    if (lo > 0)                                                                           /* found an entry */
+    {
+        pos = a_ina219_log_get64(&reader->index[(lo - 1) * INA219_LOG_INDEX_ENTRY_SIZE + 8]);     /* get the offset */
+    }
+    while ((pos + INA219_LOG_BLOCK_HEADER_SIZE) <= reader->end)                           /* walk the block headers */
+    {
+        const uint8_t *h = &reader->buf[pos];                                             /* header */
+        
+        if ((h[0] != 'I') || (h[1] != 'N') || (h[2] != 'A') || (h[3] != 'B'))             /* check the magic */
+        {
+            return 5;                                                                     /* return error */
+        }
+        if (a_ina219_log_get64(&h[24]) >= timestamp)                                      /* check the last timestamp */
+        {
+            *offset = pos;                                                                /* set the offset */
+            
+            return 0;                                                                     /* success return 0 */
+        }
+        pos += INA219_LOG_BLOCK_HEADER_SIZE + a_ina219_log_get32(&h[4]);                  /* next block */
+    }
+    
+    return 4;                                                                             /* return error */
+}
+
+/**
+ * @brief         read a block view
+ * @param[in]     *reader pointer to an ina219 log reader structure
+ * @param[in,out] *offset pointer to a block offset buffer
+ * @param[out]    *block pointer to an ina219 log block structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 reader, offset or block is NULL
+ *                - 4 end of the log
+ *                - 5 block is invalid
+ * @note          the block points into the file view, the offset is moved to the next block
+ */
+uint8_t ina219_log_reader_read_block(ina219_log_reader_t *reader, uint64_t *offset, ina219_log_block_t *block)
+{
+    uint64_t remain;
+    uint32_t size;
+    
+    if ((reader == NULL) || (offset == NULL) || (block == NULL))                         /* check reader, offset and block */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (((*offset) + INA219_LOG_BLOCK_HEADER_SIZE) > reader->end)                        /* check the end */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    remain = reader->end - (*offset);                                                     /* get the remain */
+    if (ina219_log_parse_block(&reader->buf[*offset], (remain > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)remain,
+                               block, &size) != 0)                                        /* parse the block */
+    {
+        return 5;                                                                         /* return error */
+    }
+    *offset += size;                                                                      /* next block */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      find the valid part of a log left by a crash
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *valid pointer to a valid length buffer
+ * @param[out] *block_num pointer to a valid block number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf, valid or block_num is NULL
+ *             - 4 header is invalid
+ *             - 5 version is not supported
+ * @note       a finished log is valid as a whole, otherwise the blocks are walked
+ *             until the first torn or corrupted one and the valid length ends before it
+ */
+uint8_t ina219_log_recover(const uint8_t *buf, uint64_t len, uint64_t *valid, uint32_t *block_num)
+{
+    ina219_log_reader_t reader;
+    ina219_log_block_t block;
+    uint64_t offset;
+    uint8_t res;
+    
+    if ((buf == NULL) || (valid == NULL) || (block_num == NULL))                          /* check buf, valid and block_num */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    res = ina219_log_reader_init(&reader, buf, len);                                      /* init the reader */
+    if (res != 0)                                                                         /* check the result */
+    {
+        return res;                                                                       /* return error */
+    }
+    offset = INA219_LOG_FILE_HEADER_SIZE;                                                 /* first block */
+    *block_num = 0;                                                                       /* init 0 */
+    while (ina219_log_reader_read_block(&reader, &offset, &block) == 0)                   /* walk the blocks */
+    {
+        (*block_num)++;                                                                   /* block_num++ */
+    }
+    *valid = (reader.index != NULL) ? len : offset;                                       /* keep the footer of a finished log */
+    
+    return 0;                                                                             /* success return 0 */
+}
@@ -0,0 +1,373 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_log.h
+ * @brief     driver ina219 log header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_LOG_H
+#define DRIVER_INA219_LOG_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_log_driver ina219 log driver function
+ * @brief    ina219 log driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 log format definition
+ */
+#define INA219_LOG_VERSION              1         /**< format version */
+#define INA219_LOG_FILE_HEADER_SIZE     8         /**< file header size */
+#define INA219_LOG_BLOCK_HEADER_SIZE    40        /**< block header size */
+#define INA219_LOG_SAMPLE_MAX_SIZE      22        /**< max encoded sample size */
+#define INA219_LOG_INDEX_ENTRY_SIZE     16        /**< index entry size */
+#define INA219_LOG_TRAILER_SIZE         20        /**< trailer size */
+
+/**
+ * @brief ina219 log channel enumeration definition
+ */
+typedef enum
+{
+    INA219_LOG_CHANNEL_SHUNT_VOLTAGE = (1 << 0),        /**< shunt voltage register */
+    INA219_LOG_CHANNEL_BUS_VOLTAGE   = (1 << 1),        /**< bus voltage register */
+    INA219_LOG_CHANNEL_CURRENT       = (1 << 2),        /**< current register */
+    INA219_LOG_CHANNEL_POWER         = (1 << 3),        /**< power register */
+    INA219_LOG_CHANNEL_ALL           = 0x0F,            /**< all registers */
+} ina219_log_channel_t;
+
+/**
+ * @brief ina219 log index entry structure definition
+ */
+typedef struct ina219_log_index_entry_s
+{
+    uint64_t timestamp;        /**< first timestamp of the block */
+    uint64_t offset;           /**< file offset of the block */
+} ina219_log_index_entry_t;
+
+/**
+ * @brief ina219 log writer structure definition
+ */
+typedef struct ina219_log_writer_s
+{
+    uint8_t *buf;                                              /**< block buffer */
+    uint32_t len;                                              /**< block buffer length */
+    uint32_t pos;                                              /**< write position */
+    uint32_t count;                                            /**< samples in the block */
+    uint16_t calibration;                                      /**< calibration register */
+    uint16_t conf;                                             /**< conf register */
+    uint8_t mask;                                              /**< channel mask */
+    uint64_t first;                                            /**< first timestamp */
+    uint64_t last;                                             /**< last timestamp */
+    int64_t delta;                                             /**< last timestamp delta */
+    int32_t prev[4];                                           /**< last register values */
+    uint64_t offset;                                           /**< output file offset */
+    uint32_t block;                                            /**< output block number */
+    ina219_log_index_entry_t *index;                           /**< index table */
+    uint32_t index_len;                                        /**< index table length */
+    uint32_t index_num;                                        /**< index entry number */
+    uint32_t index_interval;                                   /**< blocks between index entries */
+    uint8_t (*output)(const uint8_t *buf, uint32_t len);       /**< point to an output function address */
+} ina219_log_writer_t;
+
+/**
+ * @brief ina219 log block structure definition
+ */
+typedef struct ina219_log_block_s
+{
+    uint32_t len;                 /**< payload length */
+    uint32_t count;               /**< sample count */
+    uint64_t first;               /**< first timestamp */
+    uint64_t last;                /**< last timestamp */
+    uint16_t calibration;         /**< calibration register */
+    uint16_t conf;                /**< conf register */
+    uint8_t mask;                 /**< channel mask */
+    const uint8_t *payload;       /**< payload */
+} ina219_log_block_t;
+
+/**
+ * @brief ina219 log decoder structure definition
+ */
+typedef struct ina219_log_decoder_s
+{
+    const ina219_log_block_t *block;        /**< decoded block */
+    uint32_t pos;                           /**< read position */
+    uint32_t index;                         /**< sample index */
+    uint64_t timestamp;                     /**< last timestamp */
+    int64_t delta;                          /**< last timestamp delta */
+    int32_t prev[4];                        /**< last register values */
+} ina219_log_decoder_t;
+
+/**
+ * @brief ina219 log reader structure definition
+ */
+typedef struct ina219_log_reader_s
+{
+    const uint8_t *buf;             /**< file view */
+    uint64_t len;                   /**< file length */
+    uint64_t end;                   /**< end of the blocks */
+    const uint8_t *index;           /**< index table view */
+    uint32_t index_num;             /**< index entry number */
+} ina219_log_reader_t;
+
+/**
+ * @brief     calculate the crc32 of a buffer
+ * @param[in] crc initial crc, 0 for a new crc
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    crc32
+ * @note      ieee 802.3 polynomial, pass the last result to continue
+ */
+uint32_t ina219_log_crc32(uint32_t crc, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     initialize the log writer
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] *buf pointer to a block buffer
+ * @param[in] len length of the block buffer
+ * @param[in] *output pointer to an output function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 output file header failed
+ *            - 2 writer, buf or output is NULL
+ *            - 4 buffer is too small
+ * @note      the file header is written at once, each block is output as one call
+ */
+uint8_t ina219_log_writer_init(ina219_log_writer_t *writer, uint8_t *buf, uint32_t len, uint8_t (*output)(const uint8_t *buf, uint32_t len));
+
+/**
+ * @brief     set the block index table
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] *index pointer to an index table
+ * @param[in] len index table length
+ * @return    status code
+ *            - 0 success
+ *            - 2 writer or index is NULL
+ *            - 4 len is invalid or blocks are already output
+ * @note      when the table is full every second entry is dropped,
+ *            so the index stays sparse and bounded, len >= 2
+ */
+uint8_t ina219_log_writer_set_index(ina219_log_writer_t *writer, ina219_log_index_entry_t *index, uint32_t len);
+
+/**
+ * @brief     set the block context
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] calibration calibration register
+ * @param[in] conf conf register
+ * @param[in] mask logged channel mask
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 writer is NULL
+ *            - 4 mask is invalid
+ * @note      the current block is flushed when it is not empty
+ */
+uint8_t ina219_log_writer_set_context(ina219_log_writer_t *writer, uint16_t calibration, uint16_t conf, uint8_t mask);
+
+/**
+ * @brief     write a sample
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] timestamp timestamp in us
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 writer or sample is NULL
+ * @note      the block is flushed when it is full
+ */
+uint8_t ina219_log_writer_write(ina219_log_writer_t *writer, uint64_t timestamp, const ina219_sample_t *sample);
+
+/**
+ * @brief     flush the current block
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 writer is NULL
+ * @note      an empty block is not output
+ */
+uint8_t ina219_log_writer_flush(ina219_log_writer_t *writer);
+
+/**
+ * @brief     flush the current block when its first sample gets too old
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @param[in] timestamp time of the next write in us
+ * @param[in] age_us max time in us a sample is held in the block
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 writer is NULL
+ * @note      call it after each write with the time of the next one, so a sample
+ *            is never held longer than age_us whatever the sample rate
+ */
+uint8_t ina219_log_writer_flush_age(ina219_log_writer_t *writer, uint64_t timestamp, uint32_t age_us);
+
+/**
+ * @brief     finish the log
+ * @param[in] *writer pointer to an ina219 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ *            - 2 writer is NULL
+ * @note      the last block is flushed and the index footer is written when an index table is set
+ */
+uint8_t ina219_log_writer_finish(ina219_log_writer_t *writer);
+
+/**
+ * @brief     check the file header
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 buf is NULL
+ *            - 4 header is invalid
+ *            - 5 version is not supported
+ * @note      none
+ */
+uint8_t ina219_log_check_file_header(const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      parse a block
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *block pointer to an ina219 log block structure
+ * @param[out] *size pointer to a block size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf, block or size is NULL
+ *             - 4 block is incomplete
+ *             - 5 magic is invalid
+ *             - 6 crc is invalid
+ * @note       the block payload points into buf, nothing is copied
+ */
+uint8_t ina219_log_parse_block(const uint8_t *buf, uint32_t len, ina219_log_block_t *block, uint32_t *size);
+
+/**
+ * @brief     initialize a block decoder
+ * @param[in] *decoder pointer to an ina219 log decoder structure
+ * @param[in] *block pointer to a parsed block structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder or block is NULL
+ * @note      the block must stay valid while decoding
+ */
+uint8_t ina219_log_decoder_init(ina219_log_decoder_t *decoder, const ina219_log_block_t *block);
+
+/**
+ * @brief      decode the next sample
+ * @param[in]  *decoder pointer to an ina219 log decoder structure
+ * @param[out] *timestamp pointer to a timestamp buffer
+ * @param[out] *sample pointer to a raw sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 decoder is NULL
+ *             - 4 end of the block
+ *             - 5 data is corrupted
+ * @note       channels not in the block mask are set to 0
+ */
+uint8_t ina219_log_decoder_next(ina219_log_decoder_t *decoder, uint64_t *timestamp, ina219_sample_t *sample);
+
+/**
+ * @brief     initialize the log reader
+ * @param[in] *reader pointer to an ina219 log reader structure
+ * @param[in] *buf pointer to a whole file view
+ * @param[in] len file length
+ * @return    status code
+ *            - 0 success
+ *            - 2 reader or buf is NULL
+ *            - 4 header is invalid
+ *            - 5 version is not supported
+ * @note      a file without a valid index footer is read without index
+ */
+uint8_t ina219_log_reader_init(ina219_log_reader_t *reader, const uint8_t *buf, uint64_t len);
+
+/**
+ * @brief      seek the block containing a timestamp
+ * @param[in]  *reader pointer to an ina219 log reader structure
+ * @param[in]  timestamp timestamp in us
+ * @param[out] *offset pointer to a block offset buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 reader or offset is NULL
+ *             - 4 timestamp is after the end of the log
+ *             - 5 block is invalid
+ * @note       the offset is the first block which ends at or after the timestamp,
+ *             the index is searched in O(log n) and at most one index interval of block headers is walked
+ */
+uint8_t ina219_log_reader_seek(ina219_log_reader_t *reader, uint64_t timestamp, uint64_t *offset);
+
+/**
+ * @brief         read a block view
+ * @param[in]     *reader pointer to an ina219 log reader structure
+ * @param[in,out] *offset pointer to a block offset buffer
+ * @param[out]    *block pointer to an ina219 log block structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 reader, offset or block is NULL
+ *                - 4 end of the log
+ *                - 5 block is invalid
+ * @note          the block points into the file view, the offset is moved to the next block
+ */
+uint8_t ina219_log_reader_read_block(ina219_log_reader_t *reader, uint64_t *offset, ina219_log_block_t *block);
+
+/**
+ * @brief      find the valid part of a log left by a crash
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *valid pointer to a valid length buffer
+ * @param[out] *block_num pointer to a valid block number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf, valid or block_num is NULL
+ *             - 4 header is invalid
+ *             - 5 version is not supported
+ * @note       a finished log is valid as a whole, otherwise the blocks are walked
+ *             until the first torn or corrupted one and the valid length ends before it
+ */
+uint8_t ina219_log_recover(const uint8_t *buf, uint64_t len, uint64_t *valid, uint32_t *block_num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
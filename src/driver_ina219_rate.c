@@ -0,0 +1,380 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_rate.c
+ * @brief     driver ina219 rate source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_rate.h"
+#include "driver_ina219_timing.h"
+#include <string.h>
+
+/**
+ * @brief     get the greatest common divisor
+ * @param[in] a first value
+ * @param[in] b second value
+ * @return    greatest common divisor
+ * @note      none
+ */
+static uint32_t a_ina219_rate_gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0)                 /* euclid */
+    {
+        uint32_t t = a % b;        /* remainder */
+        
+        a = b;                     /* shift */
+        b = t;                     /* shift */
+    }
+    
+    return a;                      /* return the divisor */
+}
+
+/**
+ * @brief     initialize the rate groups
+ * @param[in] *rate pointer to an ina219 rate structure
+ * @param[in] budget usable bus time of each frame in percent
+ * @return    status code
+ *            - 0 success
+ *            - 2 rate is NULL
+ *            - 4 budget is invalid
+ * @note      1 <= budget <= 100, the rest of each frame is left for the jitter
+ */
+uint8_t ina219_rate_init(ina219_rate_t *rate, uint8_t budget)
+{
+    if (rate == NULL)                                  /* check the rate */
+    {
+        return 2;                                      /* return error */
+    }
+    if ((budget == 0) || (budget > 100))               /* check the budget */
+    {
+        return 4;                                      /* return error */
+    }
+    
+    memset(rate, 0, sizeof(ina219_rate_t));            /* clear the rate */
+    rate->budget = budget;                             /* set the budget */
+    
+    return 0;                                          /* success return 0 */
+}
+
+/**
+ * @brief      add a channel
+ * @param[in]  *rate pointer to an ina219 rate structure
+ * @param[in]  conf conf register value of the channel
+ * @param[in]  period_us target read period in us
+ * @param[in]  cost_us bus time of one read in us
+ * @param[in]  priority channel priority, 0 is the highest
+ * @param[out] *index pointer to a channel index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rate or index is NULL
+ *             - 4 channel table is full
+ *             - 5 conf is not a continuous mode
+ *             - 6 conversion is longer than the period
+ * @note       the schedule is built by ina219_rate_build
+ */
+uint8_t ina219_rate_add(ina219_rate_t *rate, uint16_t conf, uint32_t period_us, uint32_t cost_us, uint8_t priority, uint8_t *index)
+{
+    ina219_rate_channel_t *ch;
+    uint32_t conversion;
+    
+    if ((rate == NULL) || (index == NULL))                                      /* check rate and index */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (rate->channel_num >= INA219_RATE_MAX_CHANNEL)                           /* check the table */
+    {
+        return 4;                                                               /* return error */
+    }
+    if (((conf & 0x0004) == 0) || (ina219_timing_get_period(conf, &conversion) != 0))/* check the mode */
+    {
+        return 5;                                                               /* return error */
+    }
+    if (conversion > period_us)                                                 /* check the conversion */
+    {
+        return 6;                                                               /* return error */
+    }
+    
+    ch = &rate->channel[rate->channel_num];                                     /* get the channel */
+    memset(ch, 0, sizeof(ina219_rate_channel_t));                               /* clear the channel */
+    ch->conf = conf;                                                            /* set the conf */
+    ch->period_us = period_us;                                                  /* set the period */
+    ch->cost_us = cost_us;                                                      /* set the cost */
+    ch->priority = priority;                                                    /* set the priority */
+    *index = rate->channel_num;                                                 /* set the index */
+    rate->channel_num++;                                                        /* channel_num++ */
+    rate->frame_num = 0;                                                        /* the schedule is invalid */
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      build the hyperperiod schedule
+ * @param[in]  *rate pointer to an ina219 rate structure
+ * @param[out] *failed pointer to a failed channel index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rate or failed is NULL
+ *             - 4 no channel is added
+ *             - 5 channel period does not fit the frame table
+ *             - 6 channels do not fit the bus budget
+ * @note       from the shortest period on, a channel joins the frame table when the hyperperiod
+ *             still has at most INA219_RATE_MAX_FRAME frames, the frame is the greatest common
+ *             divisor of their periods and the hyperperiod is their least common multiple,
+ *             a slower channel is read once every whole number of hyperperiods when that
+ *             changes its period by at most INA219_RATE_MAX_ROUNDING percent, otherwise it is
+ *             reported in failed with status 5, the channels are placed by priority and then by
+ *             period, each one at the frame offset with the lowest peak load, a channel that
+ *             only fits by exceeding the budget of a frame is reported in failed and the
+ *             channels placed before it are never moved for it
+ */
+uint8_t ina219_rate_build(ina219_rate_t *rate, uint8_t *failed)
+{
+    uint64_t hyper;
+    uint32_t frame;
+    uint32_t frame_num;
+    uint32_t budget;
+    uint8_t order[INA219_RATE_MAX_CHANNEL];
+    uint8_t slow[INA219_RATE_MAX_CHANNEL];
+    uint8_t i;
+    uint8_t j;
+    
+    if ((rate == NULL) || (failed == NULL))                                              /* check rate and failed */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (rate->channel_num == 0)                                                          /* check the number */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    rate->frame_num = 0;                                                                 /* the schedule is invalid */
+    for (i = 0; i < rate->channel_num; i++)                                              /* sort by period */
+    {
+        for (j = i; j > 0; j--)                                                          /* insert */
+        {
+            if (rate->channel[order[j - 1]].period_us <= rate->channel[i].period_us)     /* check the order */
+            {
+                break;                                                                   /* break */
+            }
+            order[j] = order[j - 1];                                                     /* move */
+        }
+        order[j] = i;                                                                    /* set the order */
+    }
+    frame = rate->channel[order[0]].period_us;                                           /* shortest period */
+    hyper = frame;                                                                       /* shortest period */
+    memset(slow, 0, sizeof(slow));                                                       /* clear the slow flags */
+    for (i = 1; i < rate->channel_num; i++)                                              /* faster channels first */
+    {
+        uint32_t period = rate->channel[order[i]].period_us;                             /* get the period */
+        uint32_t g = a_ina219_rate_gcd(frame, period);                                   /* new frame */
+        uint64_t a = hyper / a_ina219_rate_gcd((uint32_t)(hyper % period), period);      /* hyperperiod multiplier */
+        uint32_t q = period / g;                                                         /* frame multiplier */
+        
+        if ((q > INA219_RATE_MAX_FRAME) || (a > (INA219_RATE_MAX_FRAME / q)))            /* check the frames */
+        {
+            slow[order[i]] = 1;                                                          /* read it per hyperperiods */
+            
+            continue;                                                                    /* next */
+        }
+        frame = g;                                                                       /* set the frame */
+        hyper = a * period;                                                              /* set the hyperperiod */
+    }
+    frame_num = (uint32_t)(hyper / frame);                                               /* frames in the hyperperiod */
+    for (i = 0; i < rate->channel_num; i++)                                              /* set the steps */
+    {
+        ina219_rate_channel_t *ch = &rate->channel[i];                                   /* get the channel */
+        
+        if (slow[i] != 0)                                                                /* slow channel */
+        {
+            uint64_t k = (ch->period_us + hyper / 2) / hyper;                            /* hyperperiods per read */
+            uint64_t diff;
+            
+            diff = (k * hyper > ch->period_us) ? (k * hyper - ch->period_us) :
+                                                 (ch->period_us - k * hyper);            /* rounding */
+            if ((k == 0) || ((diff * 100) > ((uint64_t)ch->period_us * INA219_RATE_MAX_ROUNDING)) ||
+                ((k * frame_num) > (UINT32_MAX - INA219_RATE_MAX_FRAME)))                 /* check the rounding */
+            {
+                *failed = i;                                                             /* set the failed channel */
+                
+                return 5;                                                                /* return error */
+            }
+            ch->step = (uint32_t)(k * frame_num);                                        /* frames per read */
+        }
+        else
+        {
+            ch->step = ch->period_us / frame;                                            /* frames per read */
+        }
+    }
+    memset(rate->load_us, 0, sizeof(rate->load_us));                                     /* clear the load */
+    rate->frame_us = frame;                                                              /* set the frame */
+    budget = (uint32_t)((uint64_t)frame * rate->budget / 100);                           /* bus time of a frame */
+    for (i = 0; i < rate->channel_num; i++)                                              /* sort by priority */
+    {
+        ina219_rate_channel_t *ch = &rate->channel[i];                                   /* get the channel */
+        
+        for (j = i; j > 0; j--)                                                          /* insert */
+        {
+            ina219_rate_channel_t *prev = &rate->channel[order[j - 1]];                  /* get the previous channel */
+            
+            if ((prev->priority < ch->priority) ||
+                ((prev->priority == ch->priority) && (prev->period_us <= ch->period_us)))/* check the order */
+            {
+                break;                                                                   /* break */
+            }
+            order[j] = order[j - 1];                                                     /* move */
+        }
+        order[j] = i;                                                                    /* set the order */
+    }
+    for (i = 0; i < rate->channel_num; i++)                                              /* place by priority */
+    {
+        ina219_rate_channel_t *ch = &rate->channel[order[i]];                            /* get the channel */
+        uint32_t span = (ch->step < frame_num) ? ch->step : frame_num;                   /* offsets in the table */
+        uint32_t best_peak = UINT32_MAX;                                                 /* init max */
+        uint32_t best = 0;                                                               /* init 0 */
+        uint32_t offset;
+        uint32_t k;
+        
+        for (offset = 0; offset < span; offset++)                                        /* try all offsets */
+        {
+            uint32_t peak = 0;                                                           /* init 0 */
+            
+            for (k = offset; k < frame_num; k += ch->step)                               /* loop the frames */
+            {
+                if ((rate->load_us[k] + ch->cost_us) > peak)                             /* check the load */
+                {
+                    peak = rate->load_us[k] + ch->cost_us;                               /* set the peak */
+                }
+            }
+            if (peak < best_peak)                                                        /* lower peak */
+            {
+                best_peak = peak;                                                        /* set the peak */
+                best = offset;                                                           /* set the offset */
+            }
+        }
+        if (best_peak > budget)                                                          /* check the budget */
+        {
+            *failed = order[i];                                                          /* set the failed channel */
+            
+            return 6;                                                                    /* return error */
+        }
+        ch->offset = best;                                                               /* set the offset */
+        for (k = best; k < frame_num; k += ch->step)                                     /* loop the frames */
+        {
+            rate->load_us[k] += ch->cost_us;                                             /* add the load */
+        }
+    }
+    memcpy(rate->order, order, sizeof(order));                                           /* save the order */
+    rate->frame_num = (uint16_t)frame_num;                                               /* set the frame number */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the channels read in a frame
+ * @param[in]  *rate pointer to an ina219 rate structure
+ * @param[in]  frame frame index since the start
+ * @param[out] *list pointer to a channel index buffer
+ * @param[out] *num pointer to a channel number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rate, list or num is NULL
+ *             - 3 schedule is not built
+ * @note       the list has INA219_RATE_MAX_CHANNEL entries and is in priority order,
+ *             the frame index keeps counting past the hyperperiod for the slow channels
+ */
+uint8_t ina219_rate_get_frame(ina219_rate_t *rate, uint64_t frame, uint8_t *list, uint8_t *num)
+{
+    uint8_t i;
+    
+    if ((rate == NULL) || (list == NULL) || (num == NULL))                   /* check rate, list and num */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (rate->frame_num == 0)                                                /* check the schedule */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    *num = 0;                                                                /* init 0 */
+    for (i = 0; i < rate->channel_num; i++)                                  /* loop all channels */
+    {
+        ina219_rate_channel_t *ch = &rate->channel[rate->order[i]];          /* get the channel */
+        
+        if ((frame % ch->step) == ch->offset)                                /* check the frame */
+        {
+            list[*num] = rate->order[i];                                     /* add the channel */
+            (*num)++;                                                        /* num++ */
+        }
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the bus load of the schedule
+ * @param[in]  *rate pointer to an ina219 rate structure
+ * @param[out] *peak pointer to a peak frame load buffer
+ * @param[out] *mean pointer to a mean load buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rate, peak or mean is NULL
+ *             - 3 schedule is not built
+ * @note       the load is the read time divided by the frame time
+ */
+uint8_t ina219_rate_get_load(ina219_rate_t *rate, double *peak, double *mean)
+{
+    uint32_t max = 0;
+    uint64_t sum = 0;
+    uint16_t k;
+    
+    if ((rate == NULL) || (peak == NULL) || (mean == NULL))                                /* check rate, peak and mean */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (rate->frame_num == 0)                                                              /* check the schedule */
+    {
+        return 3;                                                                          /* return error */
+    }
+    
+    for (k = 0; k < rate->frame_num; k++)                                                  /* loop all frames */
+    {
+        sum += rate->load_us[k];                                                           /* add the load */
+        if (rate->load_us[k] > max)                                                        /* check the peak */
+        {
+            max = rate->load_us[k];                                                        /* set the peak */
+        }
+    }
+    *peak = (double)max / (double)rate->frame_us;                                          /* set the peak */
+    *mean = (double)sum / (double)rate->frame_num / (double)rate->frame_us;                /* set the mean */
+    
+    return 0;                                                                              /* success return 0 */
+}
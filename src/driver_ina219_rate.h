@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_rate.h
+ * @brief     driver ina219 rate header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_RATE_H
+#define DRIVER_INA219_RATE_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_rate_driver ina219 rate driver function
+ * @brief    ina219 rate driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 rate max channel definition
+ */
+#ifndef INA219_RATE_MAX_CHANNEL
+    #define INA219_RATE_MAX_CHANNEL 16        /**< 16 channels */
+#endif
+
+/**
+ * @brief ina219 rate max frame definition
+ */
+#ifndef INA219_RATE_MAX_FRAME
+    #define INA219_RATE_MAX_FRAME 1024        /**< 1024 frames in a hyperperiod */
+#endif
+
+/**
+ * @brief ina219 rate max rounding definition
+ * @note  a slow channel is read once every whole number of hyperperiods of the faster channels
+ */
+#ifndef INA219_RATE_MAX_ROUNDING
+    #define INA219_RATE_MAX_ROUNDING 1        /**< 1% of the slow period */
+#endif
+
+/**
+ * @brief ina219 rate channel structure definition
+ */
+typedef struct ina219_rate_channel_s
+{
+    uint16_t conf;              /**< conf register value */
+    uint32_t period_us;         /**< target read period in us */
+    uint32_t cost_us;           /**< bus time of one read in us */
+    uint8_t priority;           /**< priority, 0 is the highest */
+    uint32_t step;              /**< frames between two reads */
+    uint32_t offset;            /**< first frame of the channel */
+} ina219_rate_channel_t;
+
+/**
+ * @brief ina219 rate structure definition
+ */
+typedef struct ina219_rate_s
+{
+    ina219_rate_channel_t channel[INA219_RATE_MAX_CHANNEL];        /**< channel table */
+    uint8_t channel_num;                                           /**< channel number */
+    uint8_t order[INA219_RATE_MAX_CHANNEL];                        /**< channels in priority order */
+    uint8_t budget;                                                /**< usable bus time of a frame in percent */
+    uint32_t frame_us;                                             /**< frame time in us */
+    uint16_t frame_num;                                            /**< frames in the hyperperiod */
+    uint32_t load_us[INA219_RATE_MAX_FRAME];                       /**< bus time of each frame in us */
+} ina219_rate_t;
+
+/**
+ * @brief     initialize the rate groups
+ * @param[in] *rate pointer to an ina219 rate structure
+ * @param[in] budget usable bus time of each frame in percent
+ * @return    status code
+ *            - 0 success
+ *            - 2 rate is NULL
+ *            - 4 budget is invalid
+ * @note      1 <= budget <= 100, the rest of each frame is left for the jitter
+ */
+uint8_t ina219_rate_init(ina219_rate_t *rate, uint8_t budget);
+
+/**
+ * @brief      add a channel
+ * @param[in]  *rate pointer to an ina219 rate structure
+ * @param[in]  conf conf register value of the channel
+ * @param[in]  period_us target read period in us
+ * @param[in]  cost_us bus time of one read in us
+ * @param[in]  priority channel priority, 0 is the highest
+ * @param[out] *index pointer to a channel index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rate or index is NULL
+ *             - 4 channel table is full
+ *             - 5 conf is not a continuous mode
+ *             - 6 conversion is longer than the period
+ * @note       the schedule is built by ina219_rate_build
+ */
+uint8_t ina219_rate_add(ina219_rate_t *rate, uint16_t conf, uint32_t period_us, uint32_t cost_us, uint8_t priority, uint8_t *index);
+
+/**
+ * @brief      build the hyperperiod schedule
+ * @param[in]  *rate pointer to an ina219 rate structure
+ * @param[out] *failed pointer to a failed channel index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rate or failed is NULL
+ *             - 4 no channel is added
+ *             - 5 channel period does not fit the frame table
+ *             - 6 channels do not fit the bus budget
+ * @note       from the shortest period on, a channel joins the frame table when the hyperperiod
+ *             still has at most INA219_RATE_MAX_FRAME frames, the frame is the greatest common
+ *             divisor of their periods and the hyperperiod is their least common multiple,
+ *             a slower channel is read once every whole number of hyperperiods when that
+ *             changes its period by at most INA219_RATE_MAX_ROUNDING percent, otherwise it is
+ *             reported in failed with status 5, the channels are placed by priority and then by
+ *             period, each one at the frame offset with the lowest peak load, a channel that
+ *             only fits by exceeding the budget of a frame is reported in failed and the
+ *             channels placed before it are never moved for it
+ */
+uint8_t ina219_rate_build(ina219_rate_t *rate, uint8_t *failed);
+
+/**
+ * @brief      get the channels read in a frame
+ * @param[in]  *rate pointer to an ina219 rate structure
+ * @param[in]  frame frame index since the start
+ * @param[out] *list pointer to a channel index buffer
+ * @param[out] *num pointer to a channel number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rate, list or num is NULL
+ *             - 3 schedule is not built
+ * @note       the list has INA219_RATE_MAX_CHANNEL entries and is in priority order,
+ *             the frame index keeps counting past the hyperperiod for the slow channels
+ */
+uint8_t ina219_rate_get_frame(ina219_rate_t *rate, uint64_t frame, uint8_t *list, uint8_t *num);
+
+/**
+ * @brief      get the bus load of the schedule
+ * @param[in]  *rate pointer to an ina219 rate structure
+ * @param[out] *peak pointer to a peak frame load buffer
+ * @param[out] *mean pointer to a mean load buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 rate, peak or mean is NULL
+ *             - 3 schedule is not built
+ * @note       the load is the read time divided by the frame time
+ */
+uint8_t ina219_rate_get_load(ina219_rate_t *rate, double *peak, double *mean);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
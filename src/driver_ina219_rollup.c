@@ -0,0 +1,377 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_rollup.c
+ * @brief     driver ina219 rollup source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_rollup.h"
+
+#define INA219_ROLLUP_MAGIC      0x55524E49U        /**< "INRU" */
+#define INA219_ROLLUP_VERSION    1                  /**< store version */
+
+/**
+ * @brief     get the bucket of a period index
+ * @param[in] *rollup pointer to an ina219 rollup structure
+ * @param[in] *t pointer to a tier structure
+ * @param[in] index period index
+ * @return    pointer to the bucket
+ * @note      none
+ */
+static ina219_rollup_bucket_t *a_ina219_rollup_bucket(ina219_rollup_t *rollup, ina219_rollup_tier_t *t, uint64_t index)
+{
+    ina219_rollup_bucket_t *array = (ina219_rollup_bucket_t *)(rollup->buf + t->offset);        /* bucket array */
+    
+    return &array[index % t->buckets];                                                         /* return the bucket */
+}
+
+/**
+ * @brief     add a sample to a stat
+ * @param[in] *stat pointer to a stat structure
+ * @param[in] raw raw value
+ * @note      none
+ */
+static void a_ina219_rollup_add(ina219_rollup_stat_t *stat, int32_t raw)
+{
+    if (stat->count == 0)                                                  /* first sample */
+    {
+        stat->min = raw;                                                   /* set the min */
+        stat->max = raw;                                                   /* set the max */
+        stat->sum = 0;                                                     /* reset the sum */
+        stat->sumsq = 0;                                                   /* reset the sum of squares */
+    }
+    if (raw < stat->min)                                                   /* check the min */
+    {
+        stat->min = raw;                                                   /* set the min */
+    }
+    if (raw > stat->max)                                                   /* check the max */
+    {
+        stat->max = raw;                                                   /* set the max */
+    }
+    stat->count++;                                                         /* count++ */
+    stat->sum += raw;                                                      /* add the sum */
+    stat->sumsq += (uint64_t)((int64_t)raw * raw);                         /* add the sum of squares */
+}
+
+/**
+ * @brief     merge a stat into another one
+ * @param[in] *dst pointer to a destination stat structure
+ * @param[in] *src pointer to a source stat structure
+ * @note      none
+ */
+static void a_ina219_rollup_merge(ina219_rollup_stat_t *dst, const ina219_rollup_stat_t *src)
+{
+    if (src->count == 0)                                                   /* empty source */
+    {
+        return;                                                            /* return */
+    }
+    if ((dst->count == 0) || (src->min < dst->min))                        /* check the min */
+    {
+        dst->min = src->min;                                               /* set the min */
+    }
+    if ((dst->count == 0) || (src->max > dst->max))                        /* check the max */
+    {
+        dst->max = src->max;                                               /* set the max */
+    }
+    dst->count += src->count;                                              /* add the count */
+    dst->sum += src->sum;                                                  /* add the sum */
+    dst->sumsq += src->sumsq;                                              /* add the sum of squares */
+}
+
+/**
+ * @brief     query a range from a tier and its finer tiers
+ * @param[in] *rollup pointer to an ina219 rollup structure
+ * @param[in] tier tier index
+ * @param[in] start range start in us
+ * @param[in] stop range stop in us, not included
+ * @param[in] *stat pointer to a stat structure
+ * @note      none
+ */
+static void a_ina219_rollup_query(ina219_rollup_t *rollup, uint8_t tier, uint64_t start, uint64_t stop, ina219_rollup_stat_t *stat)
+{
+    ina219_rollup_tier_t *t = &rollup->header->tier[tier];                         /* get the tier */
+    uint64_t first;
+    uint64_t end;
+    uint64_t index;
+    
+    if (start >= stop)                                                             /* empty range */
+    {
+        return;                                                                    /* return */
+    }
+    if (tier == 0)                                                                 /* finest tier */
+    {
+        first = start / t->period;                                                 /* every touched bucket */
+        end = (stop + t->period - 1) / t->period;                                  /* every touched bucket */
+    }
+    else
+    {
+        first = (start + t->period - 1) / t->period;                               /* whole buckets only */
+        end = stop / t->period;                                                    /* whole buckets only */
+        if (first >= end)                                                          /* no whole bucket */
+        {
+            a_ina219_rollup_query(rollup, (uint8_t)(tier - 1), start, stop, stat); /* use the finer tier */
+            
+            return;                                                                /* return */
+        }
+        a_ina219_rollup_query(rollup, (uint8_t)(tier - 1), start,
+                              first * t->period, stat);                            /* left edge */
+        a_ina219_rollup_query(rollup, (uint8_t)(tier - 1), end * t->period,
+                              stop, stat);                                         /* right edge */
+    }
+    first += 1;                                                                    /* period index, 0 is empty */
+    end += 1;                                                                      /* period index, 0 is empty */
+    if ((t->last >= t->buckets) && (first <= (t->last - t->buckets)))              /* clamp to the retention */
+    {
+        first = t->last - t->buckets + 1;                                          /* oldest kept period */
+    }
+    if (end > (t->last + 1))                                                       /* clamp to the latest */
+    {
+        end = t->last + 1;                                                         /* latest period */
+    }
+    for (index = first; index < end; index++)                                      /* merge all buckets */
+    {
+        ina219_rollup_bucket_t *b = a_ina219_rollup_bucket(rollup, t, index);      /* get the bucket */
+        
+        if (b->index == index)                                                     /* check the bucket */
+        {
+            a_ina219_rollup_merge(stat, &b->stat);                                 /* merge the bucket */
+        }
+    }
+}
+
+/**
+ * @brief      get the store size of a tier configuration
+ * @param[in]  *period pointer to a bucket period array in us
+ * @param[in]  *buckets pointer to a bucket number array
+ * @param[in]  num tier number
+ * @param[out] *size pointer to a store size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 period, buckets or size is NULL
+ *             - 4 tier is invalid
+ * @note       tiers are ordered from the finest to the coarsest,
+ *             each period is a multiple of the previous one
+ */
+uint8_t ina219_rollup_get_size(const uint64_t *period, const uint32_t *buckets, uint8_t num, uint32_t *size)
+{
+    uint32_t total;
+    uint8_t i;
+    
+    if ((period == NULL) || (buckets == NULL) || (size == NULL))                       /* check period, buckets and size */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((num == 0) || (num > INA219_ROLLUP_MAX_TIER))                                  /* check the number */
+    {
+        return 4;                                                                      /* return error */
+    }
+    
+    total = sizeof(ina219_rollup_header_t);                                            /* header */
+    for (i = 0; i < num; i++)                                                          /* check all tiers */
+    {
+        if ((period[i] == 0) || (buckets[i] == 0) ||
+            ((i != 0) && ((period[i] <= period[i - 1]) || ((period[i] % period[i - 1]) != 0))))    /* check the tier */
+        {
+            return 4;                                                                  /* return error */
+        }
+        if (buckets[i] > ((0xFFFFFFFFU - total) / sizeof(ina219_rollup_bucket_t)))     /* check the overflow */
+        {
+            return 4;                                                                  /* return error */
+        }
+        total += buckets[i] * sizeof(ina219_rollup_bucket_t);                          /* bucket array */
+    }
+    *size = total;                                                                     /* set the size */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     initialize the rollup store
+ * @param[in] *rollup pointer to an ina219 rollup structure
+ * @param[in] *buf pointer to a preallocated store buffer
+ * @param[in] len length of the store buffer
+ * @param[in] *period pointer to a bucket period array in us
+ * @param[in] *buckets pointer to a bucket number array
+ * @param[in] num tier number
+ * @return    status code
+ *            - 0 success, the store is formatted
+ *            - 1 success, the existing store is reused
+ *            - 2 rollup, buf, period or buckets is NULL
+ *            - 4 tier is invalid
+ *            - 5 buffer is too small or not 8 bytes aligned
+ * @note      the buffer can be a shared file mapping, a store written with
+ *            the same tiers is kept so the history survives a restart
+ */
+uint8_t ina219_rollup_init(ina219_rollup_t *rollup, void *buf, uint32_t len, const uint64_t *period, const uint32_t *buckets, uint8_t num)
+{
+    ina219_rollup_header_t *h;
+    uint32_t size;
+    uint32_t offset;
+    uint8_t res;
+    uint8_t i;
+    
+    if ((rollup == NULL) || (buf == NULL) || (period == NULL) || (buckets == NULL))        /* check the params */
+    {
+        return 2;                                                                          /* return error */
+    }
+    res = ina219_rollup_get_size(period, buckets, num, &size);                             /* get the size */
+    if (res != 0)                                                                          /* check the result */
+    {
+        return res;                                                                        /* return error */
+    }
+    if ((len < size) || ((((uintptr_t)buf) & 7) != 0))                                     /* check the buffer */
+    {
+        return 5;                                                                          /* return error */
+    }
+    
+    rollup->buf = (uint8_t *)buf;                                                          /* set the buffer */
+    rollup->header = (ina219_rollup_header_t *)buf;                                        /* set the header */
+    rollup->inited = 1;                                                                    /* set inited */
+    h = rollup->header;                                                                    /* get the header */
+    if ((h->magic == INA219_ROLLUP_MAGIC) && (h->version == INA219_ROLLUP_VERSION) &&
+        (h->tier_num == num))                                                              /* check the store */
+    {
+        for (i = 0; i < num; i++)                                                          /* check all tiers */
+        {
+            if ((h->tier[i].period != period[i]) || (h->tier[i].buckets != buckets[i]))    /* check the tier */
+            {
+                break;                                                                     /* break */
+            }
+        }
+        if (i == num)                                                                      /* same tiers */
+        {
+            return 1;                                                                      /* reuse the store */
+        }
+    }
+    memset(buf, 0, size);                                                                  /* clear the store */
+    offset = sizeof(ina219_rollup_header_t);                                               /* first bucket array */
+    for (i = 0; i < num; i++)                                                              /* set all tiers */
+    {
+        h->tier[i].period = period[i];                                                     /* set the period */
+        h->tier[i].last = 0;                                                               /* set the last */
+        h->tier[i].buckets = buckets[i];                                                   /* set the buckets */
+        h->tier[i].offset = offset;                                                        /* set the offset */
+        offset += buckets[i] * sizeof(ina219_rollup_bucket_t);                             /* next array */
+    }
+    h->tier_num = num;                                                                     /* set the number */
+    h->version = INA219_ROLLUP_VERSION;                                                    /* set the version */
+    h->magic = INA219_ROLLUP_MAGIC;                                                        /* set the magic last */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     add a sample to all tiers
+ * @param[in] *rollup pointer to an ina219 rollup structure
+ * @param[in] timestamp timestamp in us
+ * @param[in] raw raw register value
+ * @return    status code
+ *            - 0 success
+ *            - 2 rollup is NULL
+ *            - 3 rollup is not initialized
+ * @note      a bucket is reset when its slot is reused by a newer period,
+ *            samples older than the retention of a tier are ignored by that tier
+ */
+uint8_t ina219_rollup_update(ina219_rollup_t *rollup, uint64_t timestamp, int32_t raw)
+{
+    uint8_t i;
+    
+    if (rollup == NULL)                                                            /* check rollup */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (rollup->inited != 1)                                                       /* check rollup initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    for (i = 0; i < rollup->header->tier_num; i++)                                 /* update all tiers */
+    {
+        ina219_rollup_tier_t *t = &rollup->header->tier[i];                        /* get the tier */
+        uint64_t index = timestamp / t->period + 1;                                /* period index, 0 is empty */
+        ina219_rollup_bucket_t *b;
+        
+        if ((index + t->buckets) <= t->last)                                       /* out of the retention */
+        {
+            continue;                                                              /* skip */
+        }
+        b = a_ina219_rollup_bucket(rollup, t, index);                              /* get the bucket */
+        if (b->index != index)                                                     /* a new period */
+        {
+            b->index = index;                                                      /* set the index */
+            b->stat.count = 0;                                                     /* reset the bucket */
+        }
+        a_ina219_rollup_add(&b->stat, raw);                                        /* add the sample */
+        if (index > t->last)                                                       /* check the last */
+        {
+            t->last = index;                                                       /* set the last */
+        }
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      query the statistics of a time range
+ * @param[in]  *rollup pointer to an ina219 rollup structure
+ * @param[in]  start range start in us
+ * @param[in]  stop range stop in us, not included
+ * @param[out] *stat pointer to an ina219 rollup stat structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 rollup or stat is NULL
+ *             - 3 rollup is not initialized
+ *             - 4 range is invalid
+ * @note       whole buckets of the coarsest tier are used first and only the range edges
+ *             are taken from the finer tiers, the edges are rounded to the finest bucket
+ */
+uint8_t ina219_rollup_query(ina219_rollup_t *rollup, uint64_t start, uint64_t stop, ina219_rollup_stat_t *stat)
+{
+    if ((rollup == NULL) || (stat == NULL))                                        /* check rollup and stat */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (rollup->inited != 1)                                                       /* check rollup initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (start >= stop)                                                             /* check the range */
+    {
+        return 4;                                                                  /* return error */
+    }
+    
+    memset(stat, 0, sizeof(ina219_rollup_stat_t));                                /* clear the stat */
+    a_ina219_rollup_query(rollup, (uint8_t)(rollup->header->tier_num - 1),
+                          start, stop, stat);                                      /* query from the coarsest tier */
+    
+    return 0;                                                                      /* success return 0 */
+}
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_rollup.h
+ * @brief     driver ina219 rollup header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_ROLLUP_H
+#define DRIVER_INA219_ROLLUP_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_rollup_driver ina219 rollup driver function
+ * @brief    ina219 rollup driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 rollup max tier definition
+ */
+#ifndef INA219_ROLLUP_MAX_TIER
+    #define INA219_ROLLUP_MAX_TIER 4        /**< 4 tiers */
+#endif
+
+/**
+ * @brief ina219 rollup stat structure definition
+ */
+typedef struct ina219_rollup_stat_s
+{
+    uint32_t count;         /**< sample count */
+    int32_t min;            /**< min raw value */
+    int32_t max;            /**< max raw value */
+    int64_t sum;            /**< sum of raw values */
+    uint64_t sumsq;         /**< sum of squared raw values */
+} ina219_rollup_stat_t;
+
+/**
+ * @brief ina219 rollup bucket structure definition
+ */
+typedef struct ina219_rollup_bucket_s
+{
+    uint64_t index;                 /**< period index of the bucket */
+    ina219_rollup_stat_t stat;      /**< bucket statistics */
+} ina219_rollup_bucket_t;
+
+/**
+ * @brief ina219 rollup tier structure definition
+ */
+typedef struct ina219_rollup_tier_s
+{
+    uint64_t period;        /**< bucket period in us */
+    uint64_t last;          /**< latest period index */
+    uint32_t buckets;       /**< bucket number */
+    uint32_t offset;        /**< bucket array offset in the store */
+} ina219_rollup_tier_t;
+
+/**
+ * @brief ina219 rollup store header structure definition
+ */
+typedef struct ina219_rollup_header_s
+{
+    uint32_t magic;                                       /**< store magic */
+    uint16_t version;                                     /**< store version */
+    uint16_t tier_num;                                    /**< tier number */
+    ina219_rollup_tier_t tier[INA219_ROLLUP_MAX_TIER];    /**< tier table */
+} ina219_rollup_header_t;
+
+/**
+ * @brief ina219 rollup structure definition
+ */
+typedef struct ina219_rollup_s
+{
+    uint8_t *buf;                       /**< store buffer */
+    ina219_rollup_header_t *header;     /**< store header */
+    uint8_t inited;                     /**< inited flag */
+} ina219_rollup_t;
+
+/**
+ * @brief      get the store size of a tier configuration
+ * @param[in]  *period pointer to a bucket period array in us
+ * @param[in]  *buckets pointer to a bucket number array
+ * @param[in]  num tier number
+ * @param[out] *size pointer to a store size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 period, buckets or size is NULL
+ *             - 4 tier is invalid
+ * @note       tiers are ordered from the finest to the coarsest,
+ *             each period is a multiple of the previous one
+ */
+uint8_t ina219_rollup_get_size(const uint64_t *period, const uint32_t *buckets, uint8_t num, uint32_t *size);
+
+/**
+ * @brief     initialize the rollup store
+ * @param[in] *rollup pointer to an ina219 rollup structure
+ * @param[in] *buf pointer to a preallocated store buffer
+ * @param[in] len length of the store buffer
+ * @param[in] *period pointer to a bucket period array in us
+ * @param[in] *buckets pointer to a bucket number array
+ * @param[in] num tier number
+ * @return    status code
+ *            - 0 success, the store is formatted
+ *            - 1 success, the existing store is reused
+ *            - 2 rollup, buf, period or buckets is NULL
+ *            - 4 tier is invalid
+ *            - 5 buffer is too small or not 8 bytes aligned
+ * @note      the buffer can be a shared file mapping, a store written with
+ *            the same tiers is kept so the history survives a restart
+ */
+uint8_t ina219_rollup_init(ina219_rollup_t *rollup, void *buf, uint32_t len, const uint64_t *period, const uint32_t *buckets, uint8_t num);
+
+/**
+ * @brief     add a sample to all tiers
+ * @param[in] *rollup pointer to an ina219 rollup structure
+ * @param[in] timestamp timestamp in us
+ * @param[in] raw raw register value
+ * @return    status code
+ *            - 0 success
+ *            - 2 rollup is NULL
+ *            - 3 rollup is not initialized
+ * @note      a bucket is reset when its slot is reused by a newer period,
+ *            samples older than the retention of a tier are ignored by that tier
+ */
+uint8_t ina219_rollup_update(ina219_rollup_t *rollup, uint64_t timestamp, int32_t raw);
+
+/**
+ * @brief      query the statistics of a time range
+ * @param[in]  *rollup pointer to an ina219 rollup structure
+ * @param[in]  start range start in us
+ * @param[in]  stop range stop in us, not included
+ * @param[out] *stat pointer to an ina219 rollup stat structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 rollup or stat is NULL
+ *             - 3 rollup is not initialized
+ *             - 4 range is invalid
+ * @note       whole buckets of the coarsest tier are used first and only the range edges
+ *             are taken from the finer tiers, the edges are rounded to the finest bucket
+ */
+uint8_t ina219_rollup_query(ina219_rollup_t *rollup, uint64_t start, uint64_t stop, ina219_rollup_stat_t *stat);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_scan.c
+ * @brief     driver ina219 scan source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_scan.h"
+
+/**
+ * @brief chip register definition
+ */
+#define INA219_SCAN_REG_CONF           0x00        /**< configuration register */
+#define INA219_SCAN_REG_BUS_VOLTAGE    0x02        /**< bus voltage register */
+#define INA219_SCAN_REG_CALIBRATION    0x05        /**< calibration register */
+
+/**
+ * @brief power on default of the conf register
+ */
+#define INA219_SCAN_CONF_POR           0x399F
+
+/**
+ * @brief      read a register of an address
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[in]  addr iic device address
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_ina219_scan_read(ina219_handle_t *handle, uint8_t addr, uint8_t reg, uint16_t *data)
+{
+    uint8_t buf[2];
+    
+    buf[0] = 0;                                                   /* clear the buffer */
+    buf[1] = 0;                                                   /* clear the buffer */
+    if (handle->iic_read(addr, reg, (uint8_t *)buf, 2) != 0)      /* read data */
+    {
+        return 1;                                                 /* return error */
+    }
+    *data = (uint16_t)buf[0] << 8 | buf[1];                       /* get data */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief      probe all the ina219 addresses of a bus
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *device pointer to a device array
+ * @param[in]  len length of the device array
+ * @param[out] *num pointer to a found device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 iic initialization failed
+ *             - 2 handle, device or num is NULL
+ *             - 3 linked functions is NULL
+ *             - 4 device array is too small
+ * @note       the handle only needs the iic and debug functions linked, it is not initialized,
+ *             every address costs one conf read, a conf that is not the power on default
+ *             costs two more reads to check the bits that always read 0,
+ *             nothing is written so running devices are not disturbed
+ */
+uint8_t ina219_scan(ina219_handle_t *handle, ina219_scan_device_t *device, uint8_t len, uint8_t *num)
+{
+    uint8_t i;
+    uint8_t res = 0;
+    uint16_t conf;
+    uint16_t data;
+    
+    if ((handle == NULL) || (device == NULL) || (num == NULL))                           /* check handle, device and num */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->debug_print == NULL)                                                     /* check debug_print */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if ((handle->iic_init == NULL) || (handle->iic_deinit == NULL) ||
+        (handle->iic_read == NULL))                                                      /* check the linked functions */
+    {
+        handle->debug_print("ina219: linked functions is null.\n");                      /* linked functions is null */
+        
+        return 3;                                                                        /* return error */
+    }
+    
+    if (handle->iic_init() != 0)                                                         /* iic init */
+    {
+        handle->debug_print("ina219: iic init failed.\n");                               /* iic init failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    *num = 0;                                                                            /* init 0 */
+    for (i = 0; i < 16; i++)                                                             /* loop all addresses */
+    {
+        uint8_t addr = (uint8_t)(INA219_ADDRESS_0 + (i << 1));                           /* get the address */
+        uint8_t state;
+        
+        if (a_ina219_scan_read(handle, addr, INA219_SCAN_REG_CONF, &conf) != 0)          /* no ack */
+        {
+            continue;                                                                    /* next address */
+        }
+        if (conf == INA219_SCAN_CONF_POR)                                                /* power on default */
+        {
+            state = INA219_SCAN_STATE_POWER_ON;                                          /* set power on */
+        }
+        else
+        {
+            if ((conf & 0x8000) != 0)                                                    /* reset bit reads 0 */
+            {
+                continue;                                                                /* next address */
+            }
+            if ((a_ina219_scan_read(handle, addr, INA219_SCAN_REG_BUS_VOLTAGE, &data) != 0) ||
+                ((data & 0x0004) != 0))                                                  /* reserved bit reads 0 */
+            {
+                continue;                                                                /* next address */
+            }
+            if ((a_ina219_scan_read(handle, addr, INA219_SCAN_REG_CALIBRATION, &data) != 0) ||
+                ((data & 0x0001) != 0))                                                  /* fs0 reads 0 */
+            {
+                continue;                                                                /* next address */
+            }
+            state = INA219_SCAN_STATE_CONFIGURED;                                        /* set configured */
+        }
+        if (*num >= len)                                                                 /* check the length */
+        {
+            res = 4;                                                                     /* set error */
+            
+            break;                                                                       /* break */
+        }
+        device[*num].addr = (ina219_address_t)addr;                                      /* set the address */
+        device[*num].state = state;                                                      /* set the state */
+        device[*num].conf = conf;                                                        /* set the conf */
+        (*num)++;                                                                        /* num++ */
+    }
+    (void)handle->iic_deinit();                                                          /* iic deinit */
+    
+    return res;                                                                          /* return the result */
+}
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_scan.h
+ * @brief     driver ina219 scan header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_SCAN_H
+#define DRIVER_INA219_SCAN_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_scan_driver ina219 scan driver function
+ * @brief    ina219 scan driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 scan state enumeration definition
+ */
+typedef enum
+{
+    INA219_SCAN_STATE_POWER_ON   = 0x00,        /**< conf is the power on default */
+    INA219_SCAN_STATE_CONFIGURED = 0x01,        /**< conf was written, the fixed bits match */
+} ina219_scan_state_t;
+
+/**
+ * @brief ina219 scan device structure definition
+ */
+typedef struct ina219_scan_device_s
+{
+    ina219_address_t addr;        /**< iic device address */
+    uint8_t state;                /**< scan state */
+    uint16_t conf;                /**< conf register value */
+} ina219_scan_device_t;
+
+/**
+ * @brief      probe all the ina219 addresses of a bus
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *device pointer to a device array
+ * @param[in]  len length of the device array
+ * @param[out] *num pointer to a found device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 iic initialization failed
+ *             - 2 handle, device or num is NULL
+ *             - 3 linked functions is NULL
+ *             - 4 device array is too small
+ * @note       the handle only needs the iic and debug functions linked, it is not initialized,
+ *             every address costs one conf read, a conf that is not the power on default
+ *             costs two more reads to check the bits that always read 0,
+ *             nothing is written so running devices are not disturbed
+ */
+uint8_t ina219_scan(ina219_handle_t *handle, ina219_scan_device_t *device, uint8_t len, uint8_t *num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
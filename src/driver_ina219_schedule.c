@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_schedule.c
+ * @brief     driver ina219 schedule source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_schedule.h"
+#include "driver_ina219_timing.h"
+#include <string.h>
+
+/**
+ * @brief      get the guard time of a conf
+ * @param[in]  conf conf register value
+ * @param[in]  period_us target read period in us
+ * @param[in]  cost_us bus time of one read in us
+ * @param[out] *guard pointer to a guard time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 5 conf is not a continuous mode
+ *             - 6 period is shorter than the conversion and the read
+ * @note       the guard is the datasheet conversion time with the margin, so a read one guard
+ *             after the last one always gets a new result even with a slow oscillator
+ */
+static uint8_t a_ina219_schedule_guard(uint16_t conf, uint32_t period_us, uint32_t cost_us, uint32_t *guard)
+{
+    uint32_t us;
+    
+    if (((conf & 0x0004) == 0) || (ina219_timing_get_period(conf, &us) != 0))        /* check the mode */
+    {
+        return 5;                                                                     /* return error */
+    }
+    us = us + us * INA219_SCHEDULE_MARGIN / 100;                                      /* add the margin */
+    if (period_us < (us + cost_us))                                                   /* check the period */
+    {
+        return 6;                                                                     /* return error */
+    }
+    *guard = us;                                                                      /* set the guard */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     get the eligible time of an entry
+ * @param[in] *e pointer to an ina219 schedule entry structure
+ * @return    eligible time in us
+ * @note      none
+ */
+static uint64_t a_ina219_schedule_eligible(ina219_schedule_entry_t *e)
+{
+    return (e->ready > e->release) ? e->ready : e->release;        /* later of the result and the slot */
+}
+
+/**
+ * @brief     initialize the schedule
+ * @param[in] *sched pointer to an ina219 schedule structure
+ * @param[in] now current time in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched is NULL
+ * @note      none
+ */
+uint8_t ina219_schedule_init(ina219_schedule_t *sched, uint64_t now)
+{
+    if (sched == NULL)                                   /* check the sched */
+    {
+        return 2;                                        /* return error */
+    }
+    
+    memset(sched, 0, sizeof(ina219_schedule_t));         /* clear the sched */
+    sched->start = now;                                  /* set the start time */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      select the adc mode for a scheduled read period
+ * @param[in]  period_us target read period in us
+ * @param[in]  cost_us bus time of the reads in one period in us
+ * @param[in]  conversions conversions per sample, 1 for one channel and 2 for shunt and bus
+ * @param[out] *mode pointer to an adc mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 mode is NULL
+ *             - 4 conversions is invalid
+ *             - 5 period is shorter than the fastest conversion and the reads
+ * @note       the read time is subtracted and the conversion margin is applied before
+ *             ina219_timing_select_adc_mode, so the mode passes the check of ina219_schedule_add,
+ *             the fastest mode is still returned with status 5
+ */
+uint8_t ina219_schedule_select_adc_mode(uint32_t period_us, uint32_t cost_us, uint8_t conversions, ina219_adc_mode_t *mode)
+{
+    uint32_t budget;
+    
+    budget = 0;                                                                              /* init 0 */
+    if (period_us > cost_us)                                                                 /* check the period */
+    {
+        budget = (uint32_t)((uint64_t)(period_us - cost_us) * 100 /
+                            (100 + INA219_SCHEDULE_MARGIN));                                 /* remove the reads and the margin */
+    }
+    
+    return ina219_timing_select_adc_mode(budget, conversions, mode);                         /* select the adc mode */
+}
+
+/**
+ * @brief      add a device to the schedule
+ * @param[in]  *sched pointer to an ina219 schedule structure
+ * @param[in]  conf conf register value of the device
+ * @param[in]  period_us target read period in us
+ * @param[in]  cost_us bus time of one read in us
+ * @param[in]  now time of the last conf write in us
+ * @param[out] *index pointer to an entry index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched or index is NULL
+ *             - 4 schedule is full
+ *             - 5 conf is not a continuous mode
+ *             - 6 period is shorter than the conversion and the read
+ * @note       the first result is expected one conversion after now
+ */
+uint8_t ina219_schedule_add(ina219_schedule_t *sched, uint16_t conf, uint32_t period_us, uint32_t cost_us, uint64_t now, uint8_t *index)
+{
+    ina219_schedule_entry_t *e;
+    uint32_t guard;
+    uint8_t res;
+    
+    if ((sched == NULL) || (index == NULL))                             /* check sched and index */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (sched->num >= INA219_SCHEDULE_MAX_ENTRY)                        /* check the table */
+    {
+        return 4;                                                       /* return error */
+    }
+    
+    res = a_ina219_schedule_guard(conf, period_us, cost_us, &guard);    /* get the guard time */
+    if (res != 0)                                                       /* check the result */
+    {
+        return res;                                                     /* return error */
+    }
+    e = &sched->entry[sched->num];                                      /* get the entry */
+    memset(e, 0, sizeof(ina219_schedule_entry_t));                      /* clear the entry */
+    e->conf = conf;                                                     /* set the conf */
+    e->period_us = period_us;                                           /* set the period */
+    e->cost_us = cost_us;                                               /* set the cost */
+    e->guard_us = guard;                                                /* set the guard */
+    e->ready = now + guard;                                             /* first result */
+    e->release = now;                                                   /* first slot */
+    e->deadline = now + period_us;                                      /* first deadline */
+    *index = sched->num;                                                /* set the index */
+    sched->num++;                                                       /* num++ */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     update the conf of a scheduled device
+ * @param[in] *sched pointer to an ina219 schedule structure
+ * @param[in] index entry index
+ * @param[in] conf new conf register value
+ * @param[in] now time of the conf write in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched is NULL
+ *            - 4 index is invalid
+ *            - 5 conf is not a continuous mode
+ *            - 6 period is shorter than the conversion and the read
+ * @note      a conf write restarts the conversion, so the next result is one conversion after now
+ */
+uint8_t ina219_schedule_set_conf(ina219_schedule_t *sched, uint8_t index, uint16_t conf, uint64_t now)
+{
+    ina219_schedule_entry_t *e;
+    uint32_t guard;
+    uint8_t res;
+    
+    if (sched == NULL)                                                            /* check the sched */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (index >= sched->num)                                                      /* check the index */
+    {
+        return 4;                                                                 /* return error */
+    }
+    
+    e = &sched->entry[index];                                                     /* get the entry */
+    res = a_ina219_schedule_guard(conf, e->period_us, e->cost_us, &guard);        /* get the guard time */
+    if (res != 0)                                                                 /* check the result */
+    {
+        return res;                                                               /* return error */
+    }
+    e->conf = conf;                                                               /* set the conf */
+    e->guard_us = guard;                                                          /* set the guard */
+    e->ready = now + guard;                                                       /* next result */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the next read of the schedule
+ * @param[in]  *sched pointer to an ina219 schedule structure
+ * @param[in]  now current time in us
+ * @param[out] *index pointer to an entry index buffer
+ * @param[out] *at pointer to a read start time buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched, index or at is NULL
+ *             - 4 schedule is empty
+ * @note       a device is eligible when its slot has started and a new result is ready,
+ *             the eligible device with the earliest deadline is read first and the bus
+ *             only idles when no device is eligible
+ */
+uint8_t ina219_schedule_next(ina219_schedule_t *sched, uint64_t now, uint8_t *index, uint64_t *at)
+{
+    uint64_t t = UINT64_MAX;
+    uint64_t deadline = UINT64_MAX;
+    uint8_t i;
+    
+    if ((sched == NULL) || (index == NULL) || (at == NULL))                /* check sched, index and at */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (sched->num == 0)                                                   /* check the number */
+    {
+        return 4;                                                          /* return error */
+    }
+    
+    for (i = 0; i < sched->num; i++)                                       /* find the earliest eligible time */
+    {
+        uint64_t e = a_ina219_schedule_eligible(&sched->entry[i]);         /* get the eligible time */
+        
+        if (e < t)                                                         /* check the time */
+        {
+            t = e;                                                         /* set the time */
+        }
+    }
+    if (t < now)                                                           /* check the time */
+    {
+        t = now;                                                           /* not before now */
+    }
+    for (i = 0; i < sched->num; i++)                                       /* earliest deadline first */
+    {
+        ina219_schedule_entry_t *e = &sched->entry[i];                     /* get the entry */
+        
+        if ((a_ina219_schedule_eligible(e) <= t) &&
+            (e->deadline < deadline))                                      /* check the deadline */
+        {
+            deadline = e->deadline;                                        /* set the deadline */
+            *index = i;                                                    /* set the index */
+        }
+    }
+    *at = t;                                                               /* set the time */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     mark a read as done
+ * @param[in] *sched pointer to an ina219 schedule structure
+ * @param[in] index entry index
+ * @param[in] start read start time in us
+ * @param[in] end read end time in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched is NULL
+ *            - 4 index is invalid
+ * @note      a read that ends after its deadline and every slot it passed count as missed,
+ *            the next result is expected one conversion after the end of the read
+ */
+uint8_t ina219_schedule_done(ina219_schedule_t *sched, uint8_t index, uint64_t start, uint64_t end)
+{
+    ina219_schedule_entry_t *e;
+    
+    if (sched == NULL)                                                  /* check the sched */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (index >= sched->num)                                            /* check the index */
+    {
+        return 4;                                                       /* return error */
+    }
+    
+    e = &sched->entry[index];                                           /* get the entry */
+    e->read_num++;                                                      /* read_num++ */
+    if (end > e->deadline)                                              /* late */
+    {
+        e->miss_num++;                                                  /* miss_num++ */
+    }
+    e->release += e->period_us;                                         /* next slot */
+    if (end >= (e->release + e->period_us))                             /* slots are passed */
+    {
+        uint64_t skip = (end - e->release) / e->period_us;              /* passed slots */
+        
+        e->miss_num += (uint32_t)skip;                                  /* add the missed slots */
+        e->release += skip * e->period_us;                              /* skip the slots */
+    }
+    e->deadline = e->release + e->period_us;                            /* next deadline */
+    e->ready = end + e->guard_us;                                       /* next result */
+    if (end > start)                                                    /* check the time */
+    {
+        sched->busy_us += end - start;                                  /* add the bus time */
+    }
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      get the requested bus load
+ * @param[in]  *sched pointer to an ina219 schedule structure
+ * @param[out] *load pointer to a load buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched or load is NULL
+ * @note       the load is the sum of cost / period, above 1.0 some deadlines are missed
+ */
+uint8_t ina219_schedule_get_load(ina219_schedule_t *sched, double *load)
+{
+    uint8_t i;
+    
+    if ((sched == NULL) || (load == NULL))                                                           /* check sched and load */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    *load = 0.0;                                                                                     /* init 0 */
+    for (i = 0; i < sched->num; i++)                                                                 /* loop all entries */
+    {
+        *load += (double)sched->entry[i].cost_us / (double)sched->entry[i].period_us;                /* add the load */
+    }
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the bus utilization
+ * @param[in]  *sched pointer to an ina219 schedule structure
+ * @param[in]  now current time in us
+ * @param[out] *utilization pointer to a utilization buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched or utilization is NULL
+ * @note       the utilization is the read time divided by the time since the start
+ */
+uint8_t ina219_schedule_get_utilization(ina219_schedule_t *sched, uint64_t now, double *utilization)
+{
+    if ((sched == NULL) || (utilization == NULL))                                      /* check sched and utilization */
+    {
+        return 2;                                                                      /* return error */
+    }
+    
+    if (now > sched->start)                                                            /* check the time */
+    {
+        *utilization = (double)sched->busy_us / (double)(now - sched->start);          /* set the utilization */
+    }
+    else
+    {
+        *utilization = 0.0;                                                            /* set 0 */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
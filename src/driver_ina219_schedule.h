@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_schedule.h
+ * @brief     driver ina219 schedule header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_SCHEDULE_H
+#define DRIVER_INA219_SCHEDULE_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_schedule_driver ina219 schedule driver function
+ * @brief    ina219 schedule driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 schedule max entry definition
+ */
+#ifndef INA219_SCHEDULE_MAX_ENTRY
+    #define INA219_SCHEDULE_MAX_ENTRY 16        /**< 16 devices */
+#endif
+
+/**
+ * @brief ina219 schedule conversion margin definition
+ * @note  the datasheet max conversion time is about 10% above the typical one
+ */
+#ifndef INA219_SCHEDULE_MARGIN
+    #define INA219_SCHEDULE_MARGIN 10        /**< 10% */
+#endif
+
+/**
+ * @brief ina219 schedule entry structure definition
+ */
+typedef struct ina219_schedule_entry_s
+{
+    uint16_t conf;                /**< conf register value */
+    uint32_t period_us;           /**< target read period in us */
+    uint32_t cost_us;             /**< bus time of one read in us */
+    uint32_t guard_us;            /**< conversion time with the margin in us */
+    uint64_t ready;               /**< time of the next new result in us */
+    uint64_t release;             /**< start of the current slot in us */
+    uint64_t deadline;            /**< end of the current slot in us */
+    uint32_t read_num;            /**< read number */
+    uint32_t miss_num;            /**< missed slot number */
+} ina219_schedule_entry_t;
+
+/**
+ * @brief ina219 schedule structure definition
+ */
+typedef struct ina219_schedule_s
+{
+    ina219_schedule_entry_t entry[INA219_SCHEDULE_MAX_ENTRY];        /**< entry table */
+    uint8_t num;                                                     /**< entry number */
+    uint64_t start;                                                  /**< start time in us */
+    uint64_t busy_us;                                                /**< read time in us */
+} ina219_schedule_t;
+
+/**
+ * @brief     initialize the schedule
+ * @param[in] *sched pointer to an ina219 schedule structure
+ * @param[in] now current time in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched is NULL
+ * @note      none
+ */
+uint8_t ina219_schedule_init(ina219_schedule_t *sched, uint64_t now);
+
+/**
+ * @brief      select the adc mode for a scheduled read period
+ * @param[in]  period_us target read period in us
+ * @param[in]  cost_us bus time of the reads in one period in us
+ * @param[in]  conversions conversions per sample, 1 for one channel and 2 for shunt and bus
+ * @param[out] *mode pointer to an adc mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 mode is NULL
+ *             - 4 conversions is invalid
+ *             - 5 period is shorter than the fastest conversion and the reads
+ * @note       the read time is subtracted and the conversion margin is applied before
+ *             ina219_timing_select_adc_mode, so the mode passes the check of ina219_schedule_add,
+ *             the fastest mode is still returned with status 5
+ */
+uint8_t ina219_schedule_select_adc_mode(uint32_t period_us, uint32_t cost_us, uint8_t conversions, ina219_adc_mode_t *mode);
+
+/**
+ * @brief      add a device to the schedule
+ * @param[in]  *sched pointer to an ina219 schedule structure
+ * @param[in]  conf conf register value of the device
+ * @param[in]  period_us target read period in us
+ * @param[in]  cost_us bus time of one read in us
+ * @param[in]  now time of the last conf write in us
+ * @param[out] *index pointer to an entry index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched or index is NULL
+ *             - 4 schedule is full
+ *             - 5 conf is not a continuous mode
+ *             - 6 period is shorter than the conversion and the read
+ * @note       the first result is expected one conversion after now
+ */
+uint8_t ina219_schedule_add(ina219_schedule_t *sched, uint16_t conf, uint32_t period_us, uint32_t cost_us, uint64_t now, uint8_t *index);
+
+/**
+ * @brief     update the conf of a scheduled device
+ * @param[in] *sched pointer to an ina219 schedule structure
+ * @param[in] index entry index
+ * @param[in] conf new conf register value
+ * @param[in] now time of the conf write in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched is NULL
+ *            - 4 index is invalid
+ *            - 5 conf is not a continuous mode
+ *            - 6 period is shorter than the conversion and the read
+ * @note      a conf write restarts the conversion, so the next result is one conversion after now
+ */
+uint8_t ina219_schedule_set_conf(ina219_schedule_t *sched, uint8_t index, uint16_t conf, uint64_t now);
+
+/**
+ * @brief      get the next read of the schedule
+ * @param[in]  *sched pointer to an ina219 schedule structure
+ * @param[in]  now current time in us
+ * @param[out] *index pointer to an entry index buffer
+ * @param[out] *at pointer to a read start time buffer in us
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched, index or at is NULL
+ *             - 4 schedule is empty
+ * @note       a device is eligible when its slot has started and a new result is ready,
+ *             the eligible device with the earliest deadline is read first and the bus
+ *             only idles when no device is eligible
+ */
+uint8_t ina219_schedule_next(ina219_schedule_t *sched, uint64_t now, uint8_t *index, uint64_t *at);
+
+/**
+ * @brief     mark a read as done
+ * @param[in] *sched pointer to an ina219 schedule structure
+ * @param[in] index entry index
+ * @param[in] start read start time in us
+ * @param[in] end read end time in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sched is NULL
+ *            - 4 index is invalid
+ * @note      a read that ends after its deadline and every slot it passed count as missed,
+ *            the next result is expected one conversion after the end of the read
+ */
+uint8_t ina219_schedule_done(ina219_schedule_t *sched, uint8_t index, uint64_t start, uint64_t end);
+
+/**
+ * @brief      get the requested bus load
+ * @param[in]  *sched pointer to an ina219 schedule structure
+ * @param[out] *load pointer to a load buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched or load is NULL
+ * @note       the load is the sum of cost / period, above 1.0 some deadlines are missed
+ */
+uint8_t ina219_schedule_get_load(ina219_schedule_t *sched, double *load);
+
+/**
+ * @brief      get the bus utilization
+ * @param[in]  *sched pointer to an ina219 schedule structure
+ * @param[in]  now current time in us
+ * @param[out] *utilization pointer to a utilization buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sched or utilization is NULL
+ * @note       the utilization is the read time divided by the time since the start
+ */
+uint8_t ina219_schedule_get_utilization(ina219_schedule_t *sched, uint64_t now, double *utilization);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,547 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_series.c
+ * @brief     driver ina219 series source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_series.h"
+
+/**
+ * @brief     zig-zag encode a signed value
+ * @param[in] v signed value
+ * @return    unsigned value
+ * @note      none
+ */
+static uint32_t a_ina219_series_zigzag(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);        /* small magnitudes give small codes */
+}
+
+/**
+ * @brief     zig-zag decode an unsigned value
+ * @param[in] v unsigned value
+ * @return    signed value
+ * @note      none
+ */
+static int32_t a_ina219_series_unzigzag(uint32_t v)
+{
+    return (int32_t)(v >> 1) ^ (-(int32_t)(v & 1));         /* restore the sign */
+}
+
+/**
+ * @brief     put bits msb first
+ * @param[in] *series pointer to an ina219 series structure
+ * @param[in] v bit value
+ * @param[in] bits bit number
+ * @note      bits <= 32, the space is checked by the caller
+ */
+static void a_ina219_series_put(ina219_series_t *series, uint32_t v, uint8_t bits)
+{
+    while (bits != 0)                                                                           /* loop all bits */
+    {
+        uint8_t n = (uint8_t)(8 - series->acc_bits);                                            /* free bits of the byte */
+        
+        if (n > bits)                                                                           /* check the free bits */
+        {
+            n = bits;                                                                           /* set the bits */
+        }
+        bits -= n;                                                                              /* bits -= n */
+        series->acc = (series->acc << n) | ((v >> bits) & ((1U << n) - 1));                     /* append the bits */
+        series->acc_bits += n;                                                                  /* update the bits */
+        if (series->acc_bits == 8)                                                              /* byte is full */
+        {
+            series->buf[series->pos++] = (uint8_t)series->acc;                                  /* output the byte */
+            series->acc = 0;                                                                    /* clear the accumulator */
+            series->acc_bits = 0;                                                               /* clear the bits */
+        }
+    }
+}
+
+/**
+ * @brief     put a zig-zag timestamp delta of delta
+ * @param[in] *series pointer to an ina219 series structure
+ * @param[in] v zig-zag value
+ * @note      0 uses 1 bit, a jitter of a few ticks uses 9 bits
+ */
+static void a_ina219_series_put_dod(ina219_series_t *series, uint32_t v)
+{
+    if (v == 0)                                                     /* same interval */
+    {
+        a_ina219_series_put(series, 0x0, 1);                        /* '0' */
+    }
+    else if (v < (1U << 7))                                         /* 7 bits */
+    {
+        a_ina219_series_put(series, 0x2, 2);                        /* '10' */
+        a_ina219_series_put(series, v, 7);                          /* put the value */
+    }
+    else if (v < (1U << 9))                                         /* 9 bits */
+    {
+        a_ina219_series_put(series, 0x6, 3);                        /* '110' */
+        a_ina219_series_put(series, v, 9);                          /* put the value */
+    }
+    else if (v < (1U << 12))                                        /* 12 bits */
+    {
+        a_ina219_series_put(series, 0xE, 4);                        /* '1110' */
+        a_ina219_series_put(series, v, 12);                         /* put the value */
+    }
+    else                                                            /* 32 bits */
+    {
+        a_ina219_series_put(series, 0xF, 4);                        /* '1111' */
+        a_ina219_series_put(series, v, 32);                         /* put the value */
+    }
+}
+
+/**
+ * @brief     put a zig-zag channel delta
+ * @param[in] *series pointer to an ina219 series structure
+ * @param[in] v zig-zag value
+ * @note      the classes fit the noise of a 12 bit adc, a full scale step uses 21 bits
+ */
+static void a_ina219_series_put_value(ina219_series_t *series, uint32_t v)
+{
+    if (v == 0)                                                     /* same value */
+    {
+        a_ina219_series_put(series, 0x0, 1);                        /* '0' */
+    }
+    else if (v < (1U << 4))                                         /* 4 bits */
+    {
+        a_ina219_series_put(series, 0x2, 2);                        /* '10' */
+        a_ina219_series_put(series, v, 4);                          /* put the value */
+    }
+    else if (v < (1U << 8))                                         /* 8 bits */
+    {
+        a_ina219_series_put(series, 0x6, 3);                        /* '110' */
+        a_ina219_series_put(series, v, 8);                          /* put the value */
+    }
+    else if (v < (1U << 12))                                        /* 12 bits */
+    {
+        a_ina219_series_put(series, 0xE, 4);                        /* '1110' */
+        a_ina219_series_put(series, v, 12);                         /* put the value */
+    }
+    else                                                            /* 17 bits */
+    {
+        a_ina219_series_put(series, 0xF, 4);                        /* '1111' */
+        a_ina219_series_put(series, v, 17);                         /* put the value */
+    }
+}
+
+/**
+ * @brief      get bits msb first
+ * @param[in]  *decoder pointer to an ina219 series decoder structure
+ * @param[in]  bits bit number
+ * @param[out] *v pointer to a bit value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame is truncated
+ * @note       bits <= 32
+ */
+static uint8_t a_ina219_series_get(ina219_series_decoder_t *decoder, uint8_t bits, uint32_t *v)
+{
+    uint32_t r = 0;
+    
+    if ((decoder->bit + bits) > decoder->bits)                                                  /* check the length */
+    {
+        return 1;                                                                               /* return error */
+    }
+    while (bits != 0)                                                                           /* loop all bits */
+    {
+        uint8_t offset = (uint8_t)(decoder->bit & 7);                                           /* bit offset in the byte */
+        uint8_t n = (uint8_t)(8 - offset);                                                      /* bits left in the byte */
+        uint8_t byte = decoder->buf[decoder->bit >> 3];                                         /* get the byte */
+        
+        if (n > bits)                                                                           /* check the bits */
+        {
+            n = bits;                                                                           /* set the bits */
+        }
+        r = (r << n) | ((uint32_t)(byte >> (8 - offset - n)) & ((1U << n) - 1));                /* append the bits */
+        decoder->bit += n;                                                                      /* update the position */
+        bits -= n;                                                                              /* bits -= n */
+    }
+    *v = r;                                                                                     /* set the value */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      get a class prefix
+ * @param[in]  *decoder pointer to an ina219 series decoder structure
+ * @param[out] *ones pointer to a leading one number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame is truncated
+ * @note       at most 4 bits are read
+ */
+static uint8_t a_ina219_series_get_prefix(ina219_series_decoder_t *decoder, uint8_t *ones)
+{
+    uint32_t b;
+    
+    *ones = 0;                                                      /* init 0 */
+    while (*ones < 4)                                               /* at most 4 bits */
+    {
+        if (a_ina219_series_get(decoder, 1, &b) != 0)               /* get one bit */
+        {
+            return 1;                                               /* return error */
+        }
+        if (b == 0)                                                 /* end of the prefix */
+        {
+            break;                                                  /* break */
+        }
+        (*ones)++;                                                  /* ones++ */
+    }
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get a zig-zag timestamp delta of delta
+ * @param[in]  *decoder pointer to an ina219 series decoder structure
+ * @param[out] *v pointer to a zig-zag value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame is truncated
+ * @note       none
+ */
+static uint8_t a_ina219_series_get_dod(ina219_series_decoder_t *decoder, uint32_t *v)
+{
+    static const uint8_t bits[5] = {0, 7, 9, 12, 32};               /* bits of each class */
+    uint8_t ones;
+    
+    if (a_ina219_series_get_prefix(decoder, &ones) != 0)            /* get the class */
+    {
+        return 1;                                                   /* return error */
+    }
+    if (ones == 0)                                                  /* same interval */
+    {
+        *v = 0;                                                     /* set 0 */
+        
+        return 0;                                                   /* success return 0 */
+    }
+    
+    return a_ina219_series_get(decoder, bits[ones], v);             /* get the value */
+}
+
+/**
+ * @brief      get a zig-zag channel delta
+ * @param[in]  *decoder pointer to an ina219 series decoder structure
+ * @param[out] *v pointer to a zig-zag value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame is truncated
+ * @note       none
+ */
+static uint8_t a_ina219_series_get_value(ina219_series_decoder_t *decoder, uint32_t *v)
+{
+    static const uint8_t bits[5] = {0, 4, 8, 12, 17};               /* bits of each class */
+    uint8_t ones;
+    
+    if (a_ina219_series_get_prefix(decoder, &ones) != 0)            /* get the class */
+    {
+        return 1;                                                   /* return error */
+    }
+    if (ones == 0)                                                  /* same value */
+    {
+        *v = 0;                                                     /* set 0 */
+        
+        return 0;                                                   /* success return 0 */
+    }
+    
+    return a_ina219_series_get(decoder, bits[ones], v);             /* get the value */
+}
+
+/**
+ * @brief     initialize the series buffer
+ * @param[in] *series pointer to an ina219 series structure
+ * @param[in] *buf pointer to a frame buffer
+ * @param[in] len length of the frame buffer
+ * @param[in] mask channel mask
+ * @return    status code
+ *            - 0 success
+ *            - 2 series or buf is NULL
+ *            - 4 buffer is too small
+ *            - 5 mask is invalid
+ * @note      len >= INA219_SERIES_HEADER_SIZE + INA219_SERIES_SAMPLE_MAX_SIZE,
+ *            mask is a combination of INA219_LOG_CHANNEL_*
+ */
+uint8_t ina219_series_init(ina219_series_t *series, uint8_t *buf, uint32_t len, uint8_t mask)
+{
+    if ((series == NULL) || (buf == NULL))                                             /* check series and buf */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (len < (INA219_SERIES_HEADER_SIZE + INA219_SERIES_SAMPLE_MAX_SIZE))             /* check the length */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if ((mask == 0) || ((mask & (~INA219_LOG_CHANNEL_ALL)) != 0))                      /* check the mask */
+    {
+        return 5;                                                                      /* return error */
+    }
+    
+    series->buf = buf;                                                                 /* set the buffer */
+    series->len = len;                                                                 /* set the length */
+    series->mask = mask;                                                               /* set the mask */
+    
+    return ina219_series_reset(series);                                                /* reset the frame */
+}
+
+/**
+ * @brief     start a new frame
+ * @param[in] *series pointer to an ina219 series structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 series is NULL
+ * @note      call it after the frame is shipped
+ */
+uint8_t ina219_series_reset(ina219_series_t *series)
+{
+    if (series == NULL)                                          /* check series */
+    {
+        return 2;                                                /* return error */
+    }
+    
+    series->pos = INA219_SERIES_HEADER_SIZE;                     /* first payload byte */
+    series->acc = 0;                                             /* clear the accumulator */
+    series->acc_bits = 0;                                        /* clear the bits */
+    series->count = 0;                                           /* clear the count */
+    series->last = 0;                                            /* clear the timestamp */
+    series->delta = 0;                                           /* clear the delta */
+    series->prev[0] = 0;                                         /* clear the value */
+    series->prev[1] = 0;                                         /* clear the value */
+    series->prev[2] = 0;                                         /* clear the value */
+    series->prev[3] = 0;                                         /* clear the value */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     push a sample into the frame
+ * @param[in] *series pointer to an ina219 series structure
+ * @param[in] timestamp timestamp in ticks
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 series or sample is NULL
+ *            - 4 frame is full
+ * @note      the memory never grows, a full frame must be shipped and reset,
+ *            the timestamp may wrap around, the cnvr bit of the bus voltage is not kept
+ */
+uint8_t ina219_series_push(ina219_series_t *series, uint32_t timestamp, const ina219_sample_t *sample)
+{
+    int32_t value[4];
+    uint8_t i;
+    
+    if ((series == NULL) || (sample == NULL))                                                /* check series and sample */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if ((series->pos + INA219_SERIES_SAMPLE_MAX_SIZE) > series->len)                        /* check the worst case size */
+    {
+        return 4;                                                                            /* return error */
+    }
+    
+    if (series->count == 0)                                                                  /* first sample */
+    {
+        a_ina219_series_put(series, timestamp, 32);                                          /* full timestamp */
+    }
+    else
+    {
+        int32_t delta = (int32_t)(timestamp - series->last);                                 /* get the delta */
+        
+        a_ina219_series_put_dod(series, a_ina219_series_zigzag(delta - series->delta));      /* delta of delta */
+        series->delta = delta;                                                               /* save the delta */
+    }
+    series->last = timestamp;                                                                /* save the timestamp */
+    value[0] = sample->shunt_voltage;                                                        /* 12 bits and sign */
+    value[1] = ((sample->bus_voltage >> 3) << 1) | (sample->bus_voltage & 0x01);             /* 13 bits and ovf */
+    value[2] = sample->current;                                                              /* signed current */
+    value[3] = sample->power;                                                                /* unsigned power */
+    for (i = 0; i < 4; i++)                                                                  /* loop all channels */
+    {
+        if ((series->mask & (1 << i)) != 0)                                                  /* check the mask */
+        {
+            a_ina219_series_put_value(series, a_ina219_series_zigzag(value[i] - series->prev[i]));    /* value delta */
+            series->prev[i] = value[i];                                                      /* save the value */
+        }
+    }
+    series->count++;                                                                         /* count++ */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the frame
+ * @param[in]  *series pointer to an ina219 series structure
+ * @param[out] **buf pointer to a frame pointer buffer
+ * @param[out] *len pointer to a frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 series, buf or len is NULL
+ * @note       the frame can be sent as it is, pushing more samples appends to it
+ */
+uint8_t ina219_series_get_frame(ina219_series_t *series, const uint8_t **buf, uint32_t *len)
+{
+    uint8_t *h;
+    
+    if ((series == NULL) || (buf == NULL) || (len == NULL))                                   /* check series, buf and len */
+    {
+        return 2;                                                                             /* return error */
+    }
+    
+    h = series->buf;                                                                          /* header */
+    h[0] = 'I';                                                                               /* set the magic */
+    h[1] = 'S';                                                                               /* set the magic */
+    h[2] = INA219_SERIES_VERSION;                                                             /* set the version */
+    h[3] = series->mask;                                                                      /* set the mask */
+    h[4] = (uint8_t)(series->count >> 0);                                                     /* set the count */
+    h[5] = (uint8_t)(series->count >> 8);                                                     /* set the count */
+    h[6] = (uint8_t)(series->count >> 16);                                                    /* set the count */
+    h[7] = (uint8_t)(series->count >> 24);                                                    /* set the count */
+    *len = series->pos;                                                                       /* whole bytes */
+    if (series->acc_bits != 0)                                                                /* pending bits */
+    {
+        series->buf[series->pos] = (uint8_t)(series->acc << (8 - series->acc_bits));          /* pad the last byte */
+        (*len)++;                                                                             /* len++ */
+    }
+    *buf = series->buf;                                                                       /* set the frame */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     initialize a frame decoder
+ * @param[in] *decoder pointer to an ina219 series decoder structure
+ * @param[in] *buf pointer to a frame
+ * @param[in] len frame length
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder or buf is NULL
+ *            - 4 frame is invalid
+ *            - 5 version is not supported
+ * @note      nothing is copied, the frame must stay valid while decoding
+ */
+uint8_t ina219_series_decoder_init(ina219_series_decoder_t *decoder, const uint8_t *buf, uint32_t len)
+{
+    if ((decoder == NULL) || (buf == NULL))                                                   /* check decoder and buf */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((len < INA219_SERIES_HEADER_SIZE) || (buf[0] != 'I') || (buf[1] != 'S') ||
+        (buf[3] == 0) || ((buf[3] & (~INA219_LOG_CHANNEL_ALL)) != 0))                         /* check the header */
+    {
+        return 4;                                                                             /* return error */
+    }
+    if (buf[2] != INA219_SERIES_VERSION)                                                      /* check the version */
+    {
+        return 5;                                                                             /* return error */
+    }
+    
+    decoder->buf = buf;                                                                       /* set the frame */
+    decoder->bits = (uint64_t)len * 8;                                                        /* set the bit length */
+    decoder->bit = INA219_SERIES_HEADER_SIZE * 8;                                             /* first payload bit */
+    decoder->mask = buf[3];                                                                   /* set the mask */
+    decoder->count = (uint32_t)buf[4] | ((uint32_t)buf[5] << 8) |
+                     ((uint32_t)buf[6] << 16) | ((uint32_t)buf[7] << 24);                     /* set the count */
+    decoder->index = 0;                                                                       /* first sample */
+    decoder->last = 0;                                                                        /* clear the timestamp */
+    decoder->delta = 0;                                                                       /* clear the delta */
+    decoder->prev[0] = 0;                                                                     /* clear the value */
+    decoder->prev[1] = 0;                                                                     /* clear the value */
+    decoder->prev[2] = 0;                                                                     /* clear the value */
+    decoder->prev[3] = 0;                                                                     /* clear the value */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      decode the next sample
+ * @param[in]  *decoder pointer to an ina219 series decoder structure
+ * @param[out] *timestamp pointer to a timestamp buffer
+ * @param[out] *sample pointer to a raw sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 decoder, timestamp or sample is NULL
+ *             - 4 end of the frame
+ *             - 5 frame is truncated
+ * @note       the channels not in the mask are set to 0
+ */
+uint8_t ina219_series_decoder_next(ina219_series_decoder_t *decoder, uint32_t *timestamp, ina219_sample_t *sample)
+{
+    uint32_t v;
+    uint8_t i;
+    
+    if ((decoder == NULL) || (timestamp == NULL) || (sample == NULL))                         /* check decoder, timestamp and sample */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (decoder->index >= decoder->count)                                                     /* check the end */
+    {
+        return 4;                                                                             /* return error */
+    }
+    
+    if (decoder->index == 0)                                                                  /* first sample */
+    {
+        if (a_ina219_series_get(decoder, 32, &v) != 0)                                        /* full timestamp */
+        {
+            return 5;                                                                         /* return error */
+        }
+        decoder->last = v;                                                                    /* set the timestamp */
+    }
+    else
+    {
+        if (a_ina219_series_get_dod(decoder, &v) != 0)                                        /* delta of delta */
+        {
+            return 5;                                                                         /* return error */
+        }
+        decoder->delta += a_ina219_series_unzigzag(v);                                        /* update the delta */
+        decoder->last += (uint32_t)decoder->delta;                                            /* update the timestamp */
+    }
+    for (i = 0; i < 4; i++)                                                                   /* loop all channels */
+    {
+        if ((decoder->mask & (1 << i)) != 0)                                                  /* check the mask */
+        {
+            if (a_ina219_series_get_value(decoder, &v) != 0)                                  /* value delta */
+            {
+                return 5;                                                                     /* return error */
+            }
+            decoder->prev[i] += a_ina219_series_unzigzag(v);                                  /* update the value */
+        }
+    }
+    *timestamp = decoder->last;                                                               /* set the timestamp */
+    sample->shunt_voltage = (int16_t)decoder->prev[0];                                        /* set the shunt voltage */
+    sample->bus_voltage = (uint16_t)(((decoder->prev[1] >> 1) << 3) | (decoder->prev[1] & 0x01));    /* set the bus voltage */
+    sample->current = (int16_t)decoder->prev[2];                                              /* set the current */
+    sample->power = (uint16_t)decoder->prev[3];                                               /* set the power */
+    decoder->index++;                                                                         /* index++ */
+    
+    return 0;                                                                                 /* success return 0 */
+}
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_series.h
+ * @brief     driver ina219 series header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_SERIES_H
+#define DRIVER_INA219_SERIES_H
+
+#include "driver_ina219_log.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_series_driver ina219 series driver function
+ * @brief    ina219 series driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 series format definition
+ */
+#define INA219_SERIES_VERSION            1         /**< frame format version */
+#define INA219_SERIES_HEADER_SIZE        8         /**< frame header size */
+#define INA219_SERIES_SAMPLE_MAX_SIZE    16        /**< max encoded sample size */
+
+/**
+ * @brief ina219 series structure definition
+ */
+typedef struct ina219_series_s
+{
+    uint8_t *buf;              /**< frame buffer */
+    uint32_t len;              /**< frame buffer length */
+    uint32_t pos;              /**< next whole byte */
+    uint32_t acc;              /**< pending bits */
+    uint8_t acc_bits;          /**< pending bit number */
+    uint8_t mask;              /**< channel mask */
+    uint32_t count;            /**< samples in the frame */
+    uint32_t last;             /**< last timestamp */
+    int32_t delta;             /**< last timestamp delta */
+    int32_t prev[4];           /**< last channel values */
+} ina219_series_t;
+
+/**
+ * @brief ina219 series decoder structure definition
+ */
+typedef struct ina219_series_decoder_s
+{
+    const uint8_t *buf;        /**< frame */
+    uint64_t bits;             /**< frame bit length */
+    uint64_t bit;              /**< read position */
+    uint8_t mask;              /**< channel mask */
+    uint32_t count;            /**< samples in the frame */
+    uint32_t index;            /**< sample index */
+    uint32_t last;             /**< last timestamp */
+    int32_t delta;             /**< last timestamp delta */
+    int32_t prev[4];           /**< last channel values */
+} ina219_series_decoder_t;
+
+/**
+ * @brief     initialize the series buffer
+ * @param[in] *series pointer to an ina219 series structure
+ * @param[in] *buf pointer to a frame buffer
+ * @param[in] len length of the frame buffer
+ * @param[in] mask channel mask
+ * @return    status code
+ *            - 0 success
+ *            - 2 series or buf is NULL
+ *            - 4 buffer is too small
+ *            - 5 mask is invalid
+ * @note      len >= INA219_SERIES_HEADER_SIZE + INA219_SERIES_SAMPLE_MAX_SIZE,
+ *            mask is a combination of INA219_LOG_CHANNEL_*
+ */
+uint8_t ina219_series_init(ina219_series_t *series, uint8_t *buf, uint32_t len, uint8_t mask);
+
+/**
+ * @brief     start a new frame
+ * @param[in] *series pointer to an ina219 series structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 series is NULL
+ * @note      call it after the frame is shipped
+ */
+uint8_t ina219_series_reset(ina219_series_t *series);
+
+/**
+ * @brief     push a sample into the frame
+ * @param[in] *series pointer to an ina219 series structure
+ * @param[in] timestamp timestamp in ticks
+ * @param[in] *sample pointer to a raw sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 series or sample is NULL
+ *            - 4 frame is full
+ * @note      the memory never grows, a full frame must be shipped and reset,
+ *            the timestamp may wrap around, the cnvr bit of the bus voltage is not kept
+ */
+uint8_t ina219_series_push(ina219_series_t *series, uint32_t timestamp, const ina219_sample_t *sample);
+
+/**
+ * @brief      get the frame
+ * @param[in]  *series pointer to an ina219 series structure
+ * @param[out] **buf pointer to a frame pointer buffer
+ * @param[out] *len pointer to a frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 series, buf or len is NULL
+ * @note       the frame can be sent as it is, pushing more samples appends to it
+ */
+uint8_t ina219_series_get_frame(ina219_series_t *series, const uint8_t **buf, uint32_t *len);
+
+/**
+ * @brief     initialize a frame decoder
+ * @param[in] *decoder pointer to an ina219 series decoder structure
+ * @param[in] *buf pointer to a frame
+ * @param[in] len frame length
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder or buf is NULL
+ *            - 4 frame is invalid
+ *            - 5 version is not supported
+ * @note      nothing is copied, the frame must stay valid while decoding
+ */
+uint8_t ina219_series_decoder_init(ina219_series_decoder_t *decoder, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      decode the next sample
+ * @param[in]  *decoder pointer to an ina219 series decoder structure
+ * @param[out] *timestamp pointer to a timestamp buffer
+ * @param[out] *sample pointer to a raw sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 decoder, timestamp or sample is NULL
+ *             - 4 end of the frame
+ *             - 5 frame is truncated
+ * @note       the channels not in the mask are set to 0
+ */
+uint8_t ina219_series_decoder_next(ina219_series_decoder_t *decoder, uint32_t *timestamp, ina219_sample_t *sample);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
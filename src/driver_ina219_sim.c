@@ -0,0 +1,647 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_sim.c
+ * @brief     driver ina219 sim source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_sim.h"
+#include "driver_ina219_timing.h"
+#include <string.h>
+
+/**
+ * @brief chip register definition
+ */
+#define INA219_SIM_REG_CONF           0x00        /**< configuration register */
+#define INA219_SIM_REG_SHUNT_VOLTAGE  0x01        /**< shunt voltage register */
+#define INA219_SIM_REG_BUS_VOLTAGE    0x02        /**< bus voltage register */
+#define INA219_SIM_REG_POWER          0x03        /**< power register */
+#define INA219_SIM_REG_CURRENT        0x04        /**< current register */
+#define INA219_SIM_REG_CALIBRATION    0x05        /**< calibration register */
+
+/**
+ * @brief chip bit definition
+ */
+#define INA219_SIM_RST                0x8000      /**< reset bit */
+#define INA219_SIM_CNVR               0x0002      /**< conversion ready flag */
+#define INA219_SIM_OVF                0x0001      /**< math overflow flag */
+#define INA219_SIM_CONF_POR           0x399F      /**< power on default of the conf register */
+#define INA219_SIM_POWER_UP_US        40          /**< recovery time from the power down mode */
+
+static ina219_sim_t *gs_sim = NULL;        /**< active sim */
+
+/**
+ * @brief     check a segment is connected to the adapter
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] mux upstream mux index or INA219_SIM_MUX_ROOT
+ * @param[in] channel upstream mux channel
+ * @return    connected flag
+ * @note      every mux on the way must enable its channel
+ */
+static uint8_t a_ina219_sim_reachable(ina219_sim_t *sim, uint8_t mux, uint8_t channel)
+{
+    while (mux != INA219_SIM_MUX_ROOT)                                   /* walk up to the adapter */
+    {
+        if ((sim->mux[mux].mask & (1 << channel)) == 0)                  /* check the channel */
+        {
+            return 0;                                                    /* disconnected */
+        }
+        channel = sim->mux[mux].channel;                                 /* upstream channel */
+        mux = sim->mux[mux].parent;                                      /* upstream mux */
+    }
+    
+    return 1;                                                            /* connected */
+}
+
+/**
+ * @brief     find a device
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] addr iic device address
+ * @return    pointer to the device, NULL when not found
+ * @note      only the reachable devices answer, two of them with the address collide
+ */
+static ina219_sim_device_t *a_ina219_sim_find(ina219_sim_t *sim, uint8_t addr)
+{
+    ina219_sim_device_t *dev = NULL;
+    uint16_t i;
+    
+    for (i = 0; i < sim->device_num; i++)                                           /* loop all devices */
+    {
+        if ((sim->device[i].addr == addr) &&
+            (a_ina219_sim_reachable(sim, sim->device[i].mux, sim->device[i].channel) != 0))/* check the address */
+        {
+            if (dev != NULL)                                                        /* collision */
+            {
+                return NULL;                                                        /* return NULL */
+            }
+            dev = &sim->device[i];                                                  /* set the device */
+        }
+    }
+    
+    return dev;                                                                     /* return the device */
+}
+
+/**
+ * @brief     reset a device to the power on default
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] *dev pointer to an ina219 sim device structure
+ * @note      the power on default converts continuously
+ */
+static void a_ina219_sim_reset(ina219_sim_t *sim, ina219_sim_device_t *dev)
+{
+    memset(dev->reg, 0, sizeof(dev->reg));                  /* clear the registers */
+    dev->reg[INA219_SIM_REG_CONF] = INA219_SIM_CONF_POR;    /* set the conf */
+    dev->busy = 1;                                          /* start the conversion */
+    dev->start = sim->time;                                 /* set the start time */
+}
+
+/**
+ * @brief     latch a conversion result
+ * @param[in] *dev pointer to an ina219 sim device structure
+ * @note      the shunt input is clipped to the pga range and the bus input to the bus range,
+ *            the overflow flag is set when a value is clipped
+ */
+static void a_ina219_sim_convert(ina219_sim_device_t *dev)
+{
+    uint16_t conf = dev->reg[INA219_SIM_REG_CONF];
+    int32_t limit;
+    int32_t shunt;
+    int32_t bus;
+    int64_t current;
+    int64_t power;
+    uint16_t ovf = 0;
+    
+    shunt = (int16_t)dev->reg[INA219_SIM_REG_SHUNT_VOLTAGE];                  /* last shunt */
+    bus = dev->reg[INA219_SIM_REG_BUS_VOLTAGE] >> 3;                          /* last bus */
+    if ((conf & 0x0001) != 0)                                                 /* shunt is converted */
+    {
+        limit = 4000 << ((conf >> 11) & 0x03);                                /* pga range in 10uV */
+        shunt = dev->shunt_uv / 10;                                           /* 10uV lsb */
+        if (shunt > limit)                                                    /* check the max */
+        {
+            shunt = limit;                                                    /* clip */
+            ovf = INA219_SIM_OVF;                                             /* set overflow */
+        }
+        if (shunt < -limit)                                                   /* check the min */
+        {
+            shunt = -limit;                                                   /* clip */
+            ovf = INA219_SIM_OVF;                                             /* set overflow */
+        }
+        dev->reg[INA219_SIM_REG_SHUNT_VOLTAGE] = (uint16_t)(int16_t)shunt;    /* set the shunt */
+    }
+    if ((conf & 0x0002) != 0)                                                 /* bus is converted */
+    {
+        limit = ((conf & 0x2000) != 0) ? 8000 : 4000;                         /* bus range in 4mV */
+        bus = (int32_t)(dev->bus_mv / 4);                                     /* 4mV lsb */
+        if (bus > limit)                                                      /* check the max */
+        {
+            bus = limit;                                                      /* clip */
+            ovf = INA219_SIM_OVF;                                             /* set overflow */
+        }
+    }
+    current = (int64_t)shunt * dev->reg[INA219_SIM_REG_CALIBRATION] / 4096;   /* current */
+    if ((current > 32767) || (current < -32768))                              /* check the current */
+    {
+        current = (current > 0) ? 32767 : -32768;                             /* clip */
+        ovf = INA219_SIM_OVF;                                                 /* set overflow */
+    }
+    power = ((current < 0) ? -current : current) * bus / 5000;                /* power */
+    if (power > 65535)                                                        /* check the power */
+    {
+        power = 65535;                                                        /* clip */
+        ovf = INA219_SIM_OVF;                                                 /* set overflow */
+    }
+    dev->reg[INA219_SIM_REG_CURRENT] = (uint16_t)(int16_t)current;            /* set the current */
+    dev->reg[INA219_SIM_REG_POWER] = (uint16_t)power;                         /* set the power */
+    dev->reg[INA219_SIM_REG_BUS_VOLTAGE] = (uint16_t)((bus << 3) |
+                                                      INA219_SIM_CNVR | ovf); /* set the bus and the flags */
+}
+
+/**
+ * @brief     finish the conversions that ended before the virtual time
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] *dev pointer to an ina219 sim device structure
+ * @note      the conversion time follows the datasheet table of the conf adc modes,
+ *            a triggered conversion stops after one result
+ */
+static void a_ina219_sim_update(ina219_sim_t *sim, ina219_sim_device_t *dev)
+{
+    uint32_t period;
+    uint64_t n;
+    
+    if (dev->busy == 0)                                                       /* check the conversion */
+    {
+        return;                                                               /* return */
+    }
+    if (ina219_timing_get_period(dev->reg[INA219_SIM_REG_CONF],
+                                 &period) != 0)                               /* power down or adc off */
+    {
+        dev->busy = 0;                                                        /* stop */
+        
+        return;                                                               /* return */
+    }
+    if (sim->time < (dev->start + period))                                    /* still converting */
+    {
+        return;                                                               /* return */
+    }
+    n = (sim->time - dev->start) / period;                                    /* finished conversions */
+    if ((dev->reg[INA219_SIM_REG_CONF] & 0x0004) != 0)                        /* continuous */
+    {
+        dev->start += n * period;                                             /* next start */
+    }
+    else
+    {
+        n = 1;                                                                /* one result */
+        dev->busy = 0;                                                        /* stop */
+    }
+    a_ina219_sim_convert(dev);                                                /* latch the result */
+    dev->conversion_num += (uint32_t)n;                                       /* add the conversions */
+}
+
+/**
+ * @brief     initialize the simulator
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] transaction_us bus time of one transaction in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      the virtual time starts at 0
+ */
+uint8_t ina219_sim_init(ina219_sim_t *sim, uint32_t transaction_us)
+{
+    if (sim == NULL)                                 /* check the sim */
+    {
+        return 2;                                    /* return error */
+    }
+    
+    memset(sim, 0, sizeof(ina219_sim_t));            /* clear the sim */
+    sim->transaction_us = transaction_us;            /* set the transaction time */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief     add a simulated device
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ *            - 4 device table is full
+ *            - 5 address is already added
+ * @note      the device starts with the power on default registers
+ */
+uint8_t ina219_sim_add_device(ina219_sim_t *sim, ina219_address_t addr)
+{
+    return ina219_sim_add_mux_device(sim, INA219_SIM_MUX_ROOT, 0, addr);        /* add on the adapter */
+}
+
+/**
+ * @brief      add a simulated mux
+ * @param[in]  *sim pointer to an ina219 sim structure
+ * @param[in]  parent upstream mux index or INA219_SIM_MUX_ROOT
+ * @param[in]  channel upstream mux channel
+ * @param[in]  addr iic mux write address
+ * @param[out] *index pointer to a mux index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim or index is NULL
+ *             - 4 mux table is full
+ *             - 5 parent or channel is invalid
+ * @note       the mux behaves like a tca9548a, one control byte enables one bit per channel,
+ *             all the channels are disabled at power on
+ */
+uint8_t ina219_sim_add_mux(ina219_sim_t *sim, uint8_t parent, uint8_t channel, uint8_t addr, uint8_t *index)
+{
+    ina219_sim_mux_t *mux;
+    
+    if ((sim == NULL) || (index == NULL))                                          /* check sim and index */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (sim->mux_num >= INA219_SIM_MAX_MUX)                                        /* check the table */
+    {
+        return 4;                                                                  /* return error */
+    }
+    if (((parent != INA219_SIM_MUX_ROOT) && (parent >= sim->mux_num)) || (channel > 7))/* check parent and channel */
+    {
+        return 5;                                                                  /* return error */
+    }
+    
+    mux = &sim->mux[sim->mux_num];                                                 /* get the mux */
+    mux->addr = addr;                                                              /* set the address */
+    mux->parent = parent;                                                          /* set the parent */
+    mux->channel = (parent == INA219_SIM_MUX_ROOT) ? 0 : channel;                  /* set the channel */
+    mux->mask = 0;                                                                 /* all channels off */
+    *index = sim->mux_num;                                                         /* set the index */
+    sim->mux_num++;                                                                /* mux_num++ */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     add a simulated device behind a mux
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] mux upstream mux index or INA219_SIM_MUX_ROOT
+ * @param[in] channel upstream mux channel
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ *            - 4 device table is full
+ *            - 5 address is already added on the segment
+ *            - 6 mux or channel is invalid
+ * @note      two reachable devices with the same address make the transfer fail
+ */
+uint8_t ina219_sim_add_mux_device(ina219_sim_t *sim, uint8_t mux, uint8_t channel, ina219_address_t addr)
+{
+    ina219_sim_device_t *dev;
+    uint16_t i;
+    
+    if (sim == NULL)                                                               /* check the sim */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (((mux != INA219_SIM_MUX_ROOT) && (mux >= sim->mux_num)) || (channel > 7))  /* check mux and channel */
+    {
+        return 6;                                                                  /* return error */
+    }
+    if (mux == INA219_SIM_MUX_ROOT)                                                /* adapter segment */
+    {
+        channel = 0;                                                               /* no channel */
+    }
+    for (i = 0; i < sim->device_num; i++)                                          /* loop all devices */
+    {
+        if ((sim->device[i].addr == (uint8_t)addr) && (sim->device[i].mux == mux) &&
+            (sim->device[i].channel == channel))                                   /* check the segment */
+        {
+            return 5;                                                              /* return error */
+        }
+    }
+    if (sim->device_num >= INA219_SIM_MAX_DEVICE)                                  /* check the table */
+    {
+        return 4;                                                                  /* return error */
+    }
+    
+    dev = &sim->device[sim->device_num];                                           /* get the device */
+    memset(dev, 0, sizeof(ina219_sim_device_t));                                   /* clear the device */
+    dev->addr = (uint8_t)addr;                                                     /* set the address */
+    dev->mux = mux;                                                                /* set the mux */
+    dev->channel = channel;                                                        /* set the channel */
+    a_ina219_sim_reset(sim, dev);                                                  /* power on */
+    sim->device_num++;                                                             /* device_num++ */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     set the analog inputs of a simulated device
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] addr iic device address
+ * @param[in] shunt_uv shunt voltage in uV
+ * @param[in] bus_mv bus voltage in mV
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ *            - 4 address is not found
+ * @note      the registers follow at the next finished conversion,
+ *            all the devices with the address on any segment are set
+ */
+uint8_t ina219_sim_set_input(ina219_sim_t *sim, ina219_address_t addr, int32_t shunt_uv, uint32_t bus_mv)
+{
+    uint8_t found = 0;
+    uint16_t i;
+    
+    if (sim == NULL)                                            /* check the sim */
+    {
+        return 2;                                               /* return error */
+    }
+    
+    for (i = 0; i < sim->device_num; i++)                       /* loop all devices */
+    {
+        if (sim->device[i].addr == (uint8_t)addr)               /* check the address */
+        {
+            sim->device[i].shunt_uv = shunt_uv;                 /* set the shunt input */
+            sim->device[i].bus_mv = bus_mv;                     /* set the bus input */
+            found = 1;                                          /* found */
+        }
+    }
+    if (found == 0)                                             /* check the device */
+    {
+        return 4;                                               /* return error */
+    }
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     start routing the transactions to the simulator
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      the sim must stay valid until ina219_sim_stop
+ */
+uint8_t ina219_sim_start(ina219_sim_t *sim)
+{
+    if (sim == NULL)            /* check the sim */
+    {
+        return 2;               /* return error */
+    }
+    
+    gs_sim = sim;               /* set active */
+    
+    return 0;                   /* success return 0 */
+}
+
+/**
+ * @brief  stop routing the transactions to the simulator
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t ina219_sim_stop(void)
+{
+    gs_sim = NULL;        /* set inactive */
+    
+    return 0;             /* success return 0 */
+}
+
+/**
+ * @brief  check the simulator state
+ * @return active flag
+ *         - 0 inactive
+ *         - 1 active
+ * @note   the platform interface routes the iic and delay functions here while active
+ */
+uint8_t ina219_sim_is_active(void)
+{
+    return (uint8_t)(gs_sim != NULL);        /* return the state */
+}
+
+/**
+ * @brief  get the virtual time
+ * @return virtual time in us
+ * @note   0 is returned while inactive
+ */
+uint64_t ina219_sim_get_time(void)
+{
+    if (gs_sim == NULL)          /* check the sim */
+    {
+        return 0;                /* return 0 */
+    }
+    
+    return gs_sim->time;         /* return the time */
+}
+
+/**
+ * @brief     advance the virtual time to a deadline
+ * @param[in] us deadline in us
+ * @note      a deadline in the past does nothing
+ */
+void ina219_sim_wait_until(uint64_t us)
+{
+    if ((gs_sim != NULL) && (us > gs_sim->time))        /* check the deadline */
+    {
+        gs_sim->time = us;                              /* advance the time */
+    }
+}
+
+/**
+ * @brief      simulated iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       an unknown address or register is not acknowledged,
+ *             reading the power register clears the conversion ready flag
+ */
+uint8_t ina219_sim_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    ina219_sim_device_t *dev;
+    uint16_t i;
+    
+    if (gs_sim == NULL)                                                   /* check the sim */
+    {
+        return 1;                                                         /* return error */
+    }
+    
+    gs_sim->time += gs_sim->transaction_us;                               /* bus time */
+    gs_sim->read_num++;                                                   /* read_num++ */
+    dev = a_ina219_sim_find(gs_sim, addr);                                /* find the device */
+    if ((dev == NULL) || (reg > INA219_SIM_REG_CALIBRATION))              /* check the device and register */
+    {
+        return 1;                                                         /* return error */
+    }
+    a_ina219_sim_update(gs_sim, dev);                                     /* finish the conversions */
+    for (i = 0; i < len; i++)                                             /* copy the data */
+    {
+        buf[i] = (i < 2) ? (uint8_t)(dev->reg[reg] >> (8 - i * 8)) : 0;   /* msb first */
+    }
+    if (reg == INA219_SIM_REG_POWER)                                      /* power register */
+    {
+        dev->reg[INA219_SIM_REG_BUS_VOLTAGE] &= ~INA219_SIM_CNVR;         /* clear the conversion ready flag */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     simulated iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a conf write restarts the conversion, writing a new mode or a triggered mode
+ *            clears the conversion ready flag, a conversion started from the power down mode
+ *            begins after the 40us power up time, the result registers are read only
+ */
+uint8_t ina219_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    ina219_sim_device_t *dev;
+    uint16_t data;
+    
+    if (gs_sim == NULL)                                                   /* check the sim */
+    {
+        return 1;                                                         /* return error */
+    }
+    
+    gs_sim->time += gs_sim->transaction_us;                               /* bus time */
+    gs_sim->write_num++;                                                  /* write_num++ */
+    dev = a_ina219_sim_find(gs_sim, addr);                                /* find the device */
+    if ((dev == NULL) || (reg > INA219_SIM_REG_CALIBRATION) ||
+        (len != 2))                                                       /* check the device, register and length */
+    {
+        return 1;                                                         /* return error */
+    }
+    a_ina219_sim_update(gs_sim, dev);                                     /* finish the conversions */
+    data = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);                    /* get the data */
+    if (reg == INA219_SIM_REG_CONF)                                       /* conf register */
+    {
+        if ((data & INA219_SIM_RST) != 0)                                 /* reset */
+        {
+            a_ina219_sim_reset(gs_sim, dev);                              /* power on default */
+        }
+        else
+        {
+            if ((((data ^ dev->reg[INA219_SIM_REG_CONF]) & 0x0007) != 0) ||
+                ((data & 0x0004) == 0))                                   /* new mode or trigger */
+            {
+                dev->reg[INA219_SIM_REG_BUS_VOLTAGE] &= ~INA219_SIM_CNVR; /* clear the conversion ready flag */
+            }
+            dev->start = gs_sim->time;                                    /* set the start time */
+            if ((dev->reg[INA219_SIM_REG_CONF] & 0x0007) == 0)            /* power down */
+            {
+                dev->start += INA219_SIM_POWER_UP_US;                     /* power up first */
+            }
+            dev->reg[INA219_SIM_REG_CONF] = data;                         /* set the conf */
+            dev->busy = 1;                                                /* start the conversion */
+        }
+    }
+    else if (reg == INA219_SIM_REG_CALIBRATION)                           /* calibration register */
+    {
+        dev->reg[INA219_SIM_REG_CALIBRATION] = data & 0xFFFE;             /* fs0 is always 0 */
+    }
+    else
+    {
+        /* read only */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     simulated iic bus write without a register address
+ * @param[in] addr iic mux write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      only a reachable mux acknowledges, the last byte is its control register
+ */
+uint8_t ina219_sim_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t found = 0;
+    uint8_t i;
+    
+    if ((gs_sim == NULL) || (len == 0))                                              /* check the sim and length */
+    {
+        return 1;                                                                    /* return error */
+    }
+    
+    gs_sim->time += gs_sim->transaction_us;                                          /* bus time */
+    gs_sim->write_num++;                                                             /* write_num++ */
+    for (i = 0; i < gs_sim->mux_num; i++)                                            /* loop all muxes */
+    {
+        ina219_sim_mux_t *mux = &gs_sim->mux[i];                                     /* get the mux */
+        
+        if ((mux->addr == addr) && (a_ina219_sim_reachable(gs_sim, mux->parent, mux->channel) != 0))/* check the mux */
+        {
+            found = 1;                                                               /* found */
+        }
+    }
+    for (i = 0; (i < gs_sim->mux_num) && (found != 0); i++)                          /* every reachable mux gets it */
+    {
+        ina219_sim_mux_t *mux = &gs_sim->mux[i];                                     /* get the mux */
+        
+        if ((mux->addr == addr) && (a_ina219_sim_reachable(gs_sim, mux->parent, mux->channel) != 0))/* check the mux */
+        {
+            mux->mask = buf[len - 1];                                                /* set the control register */
+        }
+    }
+    if (found == 0)                                                                  /* no acknowledge */
+    {
+        return 1;                                                                    /* return error */
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms time
+ * @note      the virtual time advances without sleeping
+ */
+void ina219_sim_delay_ms(uint32_t ms)
+{
+    if (gs_sim != NULL)                               /* check the sim */
+    {
+        gs_sim->time += (uint64_t)ms * 1000;          /* advance the time */
+    }
+}
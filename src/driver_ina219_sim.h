@@ -0,0 +1,283 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_sim.h
+ * @brief     driver ina219 sim header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_SIM_H
+#define DRIVER_INA219_SIM_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_sim_driver ina219 sim driver function
+ * @brief    ina219 sim driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 sim max device definition
+ */
+#ifndef INA219_SIM_MAX_DEVICE
+    #define INA219_SIM_MAX_DEVICE 256        /**< 256 devices */
+#endif
+
+/**
+ * @brief ina219 sim max mux definition
+ */
+#ifndef INA219_SIM_MAX_MUX
+    #define INA219_SIM_MAX_MUX 16        /**< 16 muxes */
+#endif
+
+/**
+ * @brief ina219 sim mux root definition
+ */
+#define INA219_SIM_MUX_ROOT 0xFF        /**< segment of the adapter itself */
+
+/**
+ * @brief ina219 sim device structure definition
+ */
+typedef struct ina219_sim_device_s
+{
+    uint8_t addr;                   /**< iic device address */
+    uint8_t mux;                    /**< upstream mux index */
+    uint8_t channel;                /**< upstream mux channel */
+    uint8_t busy;                   /**< conversion running flag */
+    uint16_t reg[6];                /**< register table */
+    int32_t shunt_uv;               /**< shunt input in uV */
+    uint32_t bus_mv;                /**< bus input in mV */
+    uint64_t start;                 /**< conversion start time in us */
+    uint32_t conversion_num;        /**< finished conversion number */
+} ina219_sim_device_t;
+
+/**
+ * @brief ina219 sim mux structure definition
+ */
+typedef struct ina219_sim_mux_s
+{
+    uint8_t addr;           /**< iic mux address */
+    uint8_t parent;         /**< upstream mux index */
+    uint8_t channel;        /**< upstream mux channel */
+    uint8_t mask;           /**< enabled channel mask */
+} ina219_sim_mux_t;
+
+/**
+ * @brief ina219 sim structure definition
+ */
+typedef struct ina219_sim_s
+{
+    ina219_sim_device_t device[INA219_SIM_MAX_DEVICE];        /**< device table */
+    uint16_t device_num;                                      /**< device number */
+    ina219_sim_mux_t mux[INA219_SIM_MAX_MUX];                 /**< mux table */
+    uint8_t mux_num;                                          /**< mux number */
+    uint32_t transaction_us;                                  /**< bus time of one transaction in us */
+    uint64_t time;                                            /**< virtual time in us */
+    uint32_t read_num;                                        /**< read transaction number */
+    uint32_t write_num;                                       /**< write transaction number */
+} ina219_sim_t;
+
+/**
+ * @brief     initialize the simulator
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] transaction_us bus time of one transaction in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      the virtual time starts at 0
+ */
+uint8_t ina219_sim_init(ina219_sim_t *sim, uint32_t transaction_us);
+
+/**
+ * @brief     add a simulated device
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ *            - 4 device table is full
+ *            - 5 address is already added
+ * @note      the device starts with the power on default registers
+ */
+uint8_t ina219_sim_add_device(ina219_sim_t *sim, ina219_address_t addr);
+
+/**
+ * @brief      add a simulated mux
+ * @param[in]  *sim pointer to an ina219 sim structure
+ * @param[in]  parent upstream mux index or INA219_SIM_MUX_ROOT
+ * @param[in]  channel upstream mux channel
+ * @param[in]  addr iic mux write address
+ * @param[out] *index pointer to a mux index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim or index is NULL
+ *             - 4 mux table is full
+ *             - 5 parent or channel is invalid
+ * @note       the mux behaves like a tca9548a, one control byte enables one bit per channel,
+ *             all the channels are disabled at power on
+ */
+uint8_t ina219_sim_add_mux(ina219_sim_t *sim, uint8_t parent, uint8_t channel, uint8_t addr, uint8_t *index);
+
+/**
+ * @brief     add a simulated device behind a mux
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] mux upstream mux index or INA219_SIM_MUX_ROOT
+ * @param[in] channel upstream mux channel
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ *            - 4 device table is full
+ *            - 5 address is already added on the segment
+ *            - 6 mux or channel is invalid
+ * @note      two reachable devices with the same address make the transfer fail
+ */
+uint8_t ina219_sim_add_mux_device(ina219_sim_t *sim, uint8_t mux, uint8_t channel, ina219_address_t addr);
+
+/**
+ * @brief     set the analog inputs of a simulated device
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @param[in] addr iic device address
+ * @param[in] shunt_uv shunt voltage in uV
+ * @param[in] bus_mv bus voltage in mV
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ *            - 4 address is not found
+ * @note      the registers follow at the next finished conversion,
+ *            all the devices with the address on any segment are set
+ */
+uint8_t ina219_sim_set_input(ina219_sim_t *sim, ina219_address_t addr, int32_t shunt_uv, uint32_t bus_mv);
+
+/**
+ * @brief     start routing the transactions to the simulator
+ * @param[in] *sim pointer to an ina219 sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      the sim must stay valid until ina219_sim_stop
+ */
+uint8_t ina219_sim_start(ina219_sim_t *sim);
+
+/**
+ * @brief  stop routing the transactions to the simulator
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t ina219_sim_stop(void);
+
+/**
+ * @brief  check the simulator state
+ * @return active flag
+ *         - 0 inactive
+ *         - 1 active
+ * @note   the platform interface routes the iic and delay functions here while active
+ */
+uint8_t ina219_sim_is_active(void);
+
+/**
+ * @brief  get the virtual time
+ * @return virtual time in us
+ * @note   0 is returned while inactive
+ */
+uint64_t ina219_sim_get_time(void);
+
+/**
+ * @brief     advance the virtual time to a deadline
+ * @param[in] us deadline in us
+ * @note      a deadline in the past does nothing
+ */
+void ina219_sim_wait_until(uint64_t us);
+
+/**
+ * @brief      simulated iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       an unknown address or register is not acknowledged,
+ *             reading the power register clears the conversion ready flag
+ */
+uint8_t ina219_sim_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulated iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a conf write restarts the conversion, writing a new mode or a triggered mode
+ *            clears the conversion ready flag, a conversion started from the power down mode
+ *            begins after the 40us power up time, the result registers are read only
+ */
+uint8_t ina219_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulated iic bus write without a register address
+ * @param[in] addr iic mux write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      only a reachable mux acknowledges, the last byte is its control register
+ */
+uint8_t ina219_sim_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms time
+ * @note      the virtual time advances without sleeping
+ */
+void ina219_sim_delay_ms(uint32_t ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_single.c
+ * @brief     driver ina219 single source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_single.h"
+#include <string.h>
+
+/**
+ * @brief chip register definition
+ */
+#define INA219_SINGLE_REG_CONF           0x00        /**< configuration register */
+#define INA219_SINGLE_REG_SHUNT_VOLTAGE  0x01        /**< shunt voltage register */
+#define INA219_SINGLE_REG_BUS_VOLTAGE    0x02        /**< bus voltage register */
+#define INA219_SINGLE_REG_CALIBRATION    0x05        /**< calibration register */
+
+/**
+ * @brief     initialize a single channel stream
+ * @param[in] *single pointer to an ina219 single structure
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] channel streamed channel
+ * @param[in] *iic_read_cmd pointer to an iic read without the pointer write function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 single or handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 channel is invalid
+ * @note      the chip is set to the continuous mode of the channel and the register pointer is
+ *            left on its register, iic_read_cmd gets that register for the routes that need it,
+ *            iic_read_cmd can be NULL, then the pointer is written on every read
+ */
+uint8_t ina219_single_init(ina219_single_t *single, ina219_handle_t *handle, ina219_single_channel_t channel,
+                           uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len))
+{
+    uint8_t buf[2];
+    uint16_t conf;
+    
+    if ((single == NULL) || (handle == NULL))                                                 /* check single and handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                  /* check handle initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (channel > INA219_SINGLE_CHANNEL_BUS_VOLTAGE)                                          /* check the channel */
+    {
+        return 4;                                                                             /* return error */
+    }
+    
+    memset(single, 0, sizeof(ina219_single_t));                                               /* clear the single */
+    if (handle->iic_read(handle->iic_addr, INA219_SINGLE_REG_CONF, buf, 2) != 0)              /* read the conf */
+    {
+        handle->debug_print("ina219: read conf failed.\n");                                   /* read conf failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    conf = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                      /* get the conf */
+    conf &= ~0x0007;                                                                          /* clear the mode */
+    if (channel == INA219_SINGLE_CHANNEL_SHUNT_VOLTAGE)                                       /* shunt voltage */
+    {
+        if (handle->iic_read(handle->iic_addr, INA219_SINGLE_REG_CALIBRATION, buf, 2) != 0)   /* read the calibration */
+        {
+            handle->debug_print("ina219: read calibration failed.\n");                        /* read calibration failed */
+            
+            return 1;                                                                         /* return error */
+        }
+        single->calibration = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);                   /* set the calibration */
+        single->reg = INA219_SINGLE_REG_SHUNT_VOLTAGE;                                        /* set the register */
+        conf |= INA219_MODE_SHUNT_VOLTAGE_CONTINUOUS;                                         /* set the mode */
+    }
+    else                                                                                      /* bus voltage */
+    {
+        single->reg = INA219_SINGLE_REG_BUS_VOLTAGE;                                          /* set the register */
+        conf |= INA219_MODE_BUS_VOLTAGE_CONTINUOUS;                                           /* set the mode */
+    }
+    buf[0] = (uint8_t)((conf >> 8) & 0xFF);                                                   /* set msb */
+    buf[1] = (uint8_t)(conf & 0xFF);                                                          /* set lsb */
+    if (handle->iic_write(handle->iic_addr, INA219_SINGLE_REG_CONF, buf, 2) != 0)             /* write the conf */
+    {
+        handle->debug_print("ina219: write conf failed.\n");                                  /* write conf failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    if (handle->iic_read(handle->iic_addr, single->reg, buf, 2) != 0)                         /* leave the pointer on the register */
+    {
+        handle->debug_print("ina219: read register failed.\n");                               /* read register failed */
+        
+        return 1;                                                                             /* return error */
+    }
+    single->handle = handle;                                                                  /* set the handle */
+    single->channel = (uint8_t)channel;                                                       /* set the channel */
+    single->iic_read_cmd = iic_read_cmd;                                                      /* set the read function */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      read a single channel sample
+ * @param[in]  *single pointer to an ina219 single structure
+ * @param[out] *sample pointer to a raw sample buffer
+ * @param[out] *field pointer to a valid field mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 single, sample or field is NULL
+ *             - 3 single is not initialized
+ * @note       only the register of the channel is read, the current is computed on the host
+ *             as shunt * calibration / 4096, which is the shunt voltage divided by the resistance
+ *             in current lsb like the current register, the power is never valid
+ */
+uint8_t ina219_single_read(ina219_single_t *single, ina219_sample_t *sample, uint8_t *field)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    ina219_handle_t *handle;
+    
+    if ((single == NULL) || (sample == NULL) || (field == NULL))                                   /* check single, sample and field */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (single->handle == NULL)                                                                    /* check single initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    handle = single->handle;                                                                       /* get the handle */
+    if (single->iic_read_cmd != NULL)                                                              /* the pointer is in place */
+    {
+        res = single->iic_read_cmd(handle->iic_addr, single->reg, buf, 2);                         /* read without the pointer */
+    }
+    else
+    {
+        res = handle->iic_read(handle->iic_addr, single->reg, buf, 2);                             /* read with the pointer */
+    }
+    if (res != 0)                                                                                  /* check the result */
+    {
+        handle->debug_print("ina219: read register failed.\n");                                    /* read register failed */
+        
+        return 1;                                                                                  /* return error */
+    }
+    memset(sample, 0, sizeof(ina219_sample_t));                                                    /* clear the sample */
+    if (single->channel == INA219_SINGLE_CHANNEL_SHUNT_VOLTAGE)                                    /* shunt voltage */
+    {
+        sample->shunt_voltage = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                       /* set the shunt voltage */
+        *field = INA219_SAMPLE_FIELD_SHUNT_VOLTAGE;                                                /* shunt voltage is valid */
+        if (single->calibration != 0)                                                              /* check the calibration */
+        {
+            sample->current = (int16_t)((int32_t)sample->shunt_voltage * single->calibration / 4096);/* current on the host */
+            *field |= INA219_SAMPLE_FIELD_CURRENT;                                                 /* current is valid */
+        }
+    }
+    else                                                                                           /* bus voltage */
+    {
+        sample->bus_voltage = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);                       /* set the bus voltage */
+        *field = INA219_SAMPLE_FIELD_BUS_VOLTAGE;                                                  /* bus voltage is valid */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
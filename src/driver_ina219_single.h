@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_single.h
+ * @brief     driver ina219 single header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_SINGLE_H
+#define DRIVER_INA219_SINGLE_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_single_driver ina219 single driver function
+ * @brief    ina219 single driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 single channel enumeration definition
+ */
+typedef enum
+{
+    INA219_SINGLE_CHANNEL_SHUNT_VOLTAGE = 0x00,        /**< shunt voltage only, the current is computed on the host */
+    INA219_SINGLE_CHANNEL_BUS_VOLTAGE   = 0x01,        /**< bus voltage only */
+} ina219_single_channel_t;
+
+/**
+ * @brief ina219 single structure definition
+ */
+typedef struct ina219_single_s
+{
+    ina219_handle_t *handle;                                                         /**< ina219 handle */
+    uint8_t channel;                                                                 /**< streamed channel */
+    uint8_t reg;                                                                     /**< register under the pointer */
+    uint16_t calibration;                                                            /**< calibration register value */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);  /**< point to an iic_read_cmd function address */
+} ina219_single_t;
+
+/**
+ * @brief     initialize a single channel stream
+ * @param[in] *single pointer to an ina219 single structure
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] channel streamed channel
+ * @param[in] *iic_read_cmd pointer to an iic read without the pointer write function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 single or handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 channel is invalid
+ * @note      the chip is set to the continuous mode of the channel and the register pointer is
+ *            left on its register, iic_read_cmd gets that register for the routes that need it,
+ *            iic_read_cmd can be NULL, then the pointer is written on every read
+ */
+uint8_t ina219_single_init(ina219_single_t *single, ina219_handle_t *handle, ina219_single_channel_t channel,
+                           uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len));
+
+/**
+ * @brief      read a single channel sample
+ * @param[in]  *single pointer to an ina219 single structure
+ * @param[out] *sample pointer to a raw sample buffer
+ * @param[out] *field pointer to a valid field mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 single, sample or field is NULL
+ *             - 3 single is not initialized
+ * @note       only the register of the channel is read, the current is computed on the host
+ *             as shunt * calibration / 4096, which is the shunt voltage divided by the resistance
+ *             in current lsb like the current register, the power is never valid
+ */
+uint8_t ina219_single_read(ina219_single_t *single, ina219_sample_t *sample, uint8_t *field);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_timing.c
+ * @brief     driver ina219 timing source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_timing.h"
+
+/**
+ * @brief datasheet conversion time in us of every 4 bit adc mode code
+ */
+static const uint32_t gs_conversion_time[16] =
+{
+    84, 148, 276, 532,                        /* 9, 10, 11 and 12 bit */
+    532, 532, 532, 532,                       /* reserved codes, 12 bit */
+    532, 1060, 2130, 4260,                    /* 1, 2, 4 and 8 samples */
+    8510, 17020, 34050, 68100,                /* 16, 32, 64 and 128 samples */
+};
+
+/**
+ * @brief      get the datasheet conversion time of an adc mode
+ * @param[in]  mode adc mode
+ * @param[out] *us pointer to a conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 us is NULL
+ * @note       mode is the 4 bit badc or sadc field, the reserved codes 0x4 - 0x8 are 12 bit 1 sample
+ */
+uint8_t ina219_timing_get_conversion_time(ina219_adc_mode_t mode, uint32_t *us)
+{
+    if (us == NULL)                                                   /* check us */
+    {
+        return 2;                                                     /* return error */
+    }
+    
+    *us = gs_conversion_time[(uint8_t)mode & 0xF];                    /* get the time */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the sample period of a conf register value
+ * @param[in]  conf conf register value
+ * @param[out] *us pointer to a sample period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 us is NULL
+ *             - 4 mode doesn't convert
+ * @note       the period is the time from a trigger or the last update until
+ *             all the enabled channels of the mode are converted
+ */
+uint8_t ina219_timing_get_period(uint16_t conf, uint32_t *us)
+{
+    uint8_t mode;
+    
+    if (us == NULL)                                                   /* check us */
+    {
+        return 2;                                                     /* return error */
+    }
+    
+    mode = (uint8_t)(conf & 0x3);                                     /* shunt and bus bits of the mode */
+    if (mode == 0)                                                    /* power down or adc off */
+    {
+        return 4;                                                     /* return error */
+    }
+    *us = 0;                                                          /* init 0 */
+    if ((mode & 0x1) != 0)                                            /* shunt voltage */
+    {
+        *us += gs_conversion_time[(conf >> 3) & 0xF];                 /* add the shunt conversion */
+    }
+    if ((mode & 0x2) != 0)                                            /* bus voltage */
+    {
+        *us += gs_conversion_time[(conf >> 7) & 0xF];                 /* add the bus conversion */
+    }
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      select the adc mode for a sample period
+ * @param[in]  period sample period in us
+ * @param[in]  conversions conversions per sample, 1 for one channel and 2 for shunt and bus
+ * @param[out] *mode pointer to an adc mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 mode is NULL
+ *             - 4 conversions is invalid
+ *             - 5 period is shorter than the fastest conversion
+ * @note       the mode with the longest conversion that fits the period is selected,
+ *             so the slower the rate the more samples are averaged,
+ *             the fastest mode is still returned with status 5
+ */
+uint8_t ina219_timing_select_adc_mode(uint32_t period, uint8_t conversions, ina219_adc_mode_t *mode)
+{
+    static const ina219_adc_mode_t list[11] =
+    {
+        INA219_ADC_MODE_9_BIT_1_SAMPLES, INA219_ADC_MODE_10_BIT_1_SAMPLES,
+        INA219_ADC_MODE_11_BIT_1_SAMPLES, INA219_ADC_MODE_12_BIT_1_SAMPLES,
+        INA219_ADC_MODE_12_BIT_2_SAMPLES, INA219_ADC_MODE_12_BIT_4_SAMPLES,
+        INA219_ADC_MODE_12_BIT_8_SAMPLES, INA219_ADC_MODE_12_BIT_16_SAMPLES,
+        INA219_ADC_MODE_12_BIT_32_SAMPLES, INA219_ADC_MODE_12_BIT_64_SAMPLES,
+        INA219_ADC_MODE_12_BIT_128_SAMPLES,
+    };
+    uint8_t i;
+    
+    if (mode == NULL)                                                             /* check mode */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if ((conversions != 1) && (conversions != 2))                                 /* check conversions */
+    {
+        return 4;                                                                 /* return error */
+    }
+    
+    *mode = list[0];                                                              /* fastest mode */
+    if (gs_conversion_time[list[0]] * conversions > period)                       /* check the fastest mode */
+    {
+        return 5;                                                                 /* return error */
+    }
+    for (i = 1; i < 11; i++)                                                      /* slower modes */
+    {
+        if (gs_conversion_time[list[i]] * conversions > period)                   /* check the period */
+        {
+            break;                                                                /* break */
+        }
+        *mode = list[i];                                                          /* set the mode */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_timing.h
+ * @brief     driver ina219 timing header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_TIMING_H
+#define DRIVER_INA219_TIMING_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_timing_driver ina219 timing driver function
+ * @brief    ina219 timing driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief      get the datasheet conversion time of an adc mode
+ * @param[in]  mode adc mode
+ * @param[out] *us pointer to a conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 us is NULL
+ * @note       mode is the 4 bit badc or sadc field, the reserved codes 0x4 - 0x8 are 12 bit 1 sample
+ */
+uint8_t ina219_timing_get_conversion_time(ina219_adc_mode_t mode, uint32_t *us);
+
+/**
+ * @brief      get the sample period of a conf register value
+ * @param[in]  conf conf register value
+ * @param[out] *us pointer to a sample period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 us is NULL
+ *             - 4 mode doesn't convert
+ * @note       the period is the time from a trigger or the last update until
+ *             all the enabled channels of the mode are converted
+ */
+uint8_t ina219_timing_get_period(uint16_t conf, uint32_t *us);
+
+/**
+ * @brief      select the adc mode for a sample period
+ * @param[in]  period sample period in us
+ * @param[in]  conversions conversions per sample, 1 for one channel and 2 for shunt and bus
+ * @param[out] *mode pointer to an adc mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 mode is NULL
+ *             - 4 conversions is invalid
+ *             - 5 period is shorter than the fastest conversion
+ * @note       the mode with the longest conversion that fits the period is selected,
+ *             so the slower the rate the more samples are averaged,
+ *             the fastest mode is still returned with status 5
+ */
+uint8_t ina219_timing_select_adc_mode(uint32_t period, uint8_t conversions, ina219_adc_mode_t *mode);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
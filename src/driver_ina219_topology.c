@@ -0,0 +1,450 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_topology.c
+ * @brief     driver ina219 topology source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_topology.h"
+#include <string.h>
+
+/**
+ * @brief     compare two devices in the sweep order
+ * @param[in] *a pointer to the first device
+ * @param[in] *b pointer to the second device
+ * @return    order, < 0 when a goes first, 0 when they are the same device
+ * @note      the adapter goes first, then the path level by level, a shorter path before
+ *            the longer ones below it, then the address
+ */
+static int32_t a_ina219_topology_compare(const ina219_topology_device_t *a, const ina219_topology_device_t *b)
+{
+    uint8_t i;
+    
+    if (a->adapter != b->adapter)                                                /* check the adapter */
+    {
+        return (int32_t)a->adapter - (int32_t)b->adapter;                        /* adapter order */
+    }
+    for (i = 0; i < INA219_TOPOLOGY_MAX_DEPTH; i++)                              /* loop the levels */
+    {
+        if ((i >= a->path.depth) || (i >= b->path.depth))                        /* end of a path */
+        {
+            break;                                                               /* break */
+        }
+        if (a->path.mux[i] != b->path.mux[i])                                    /* check the mux */
+        {
+            return (int32_t)a->path.mux[i] - (int32_t)b->path.mux[i];            /* mux order */
+        }
+        if (a->path.channel[i] != b->path.channel[i])                            /* check the channel */
+        {
+            return (int32_t)a->path.channel[i] - (int32_t)b->path.channel[i];    /* channel order */
+        }
+    }
+    if (a->path.depth != b->path.depth)                                          /* check the depth */
+    {
+        return (int32_t)a->path.depth - (int32_t)b->path.depth;                  /* shorter first */
+    }
+    
+    return (int32_t)a->addr - (int32_t)b->addr;                                  /* address order */
+}
+
+/**
+ * @brief     get the control byte of a channel
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @param[in] channel mux channel
+ * @return    control byte
+ * @note      none
+ */
+static uint8_t a_ina219_topology_control(ina219_topology_t *topology, uint8_t channel)
+{
+    if (topology->type == INA219_TOPOLOGY_MUX_TYPE_SELECT)        /* select type */
+    {
+        return (uint8_t)(0x04 | channel);                         /* enable and channel */
+    }
+    
+    return (uint8_t)(1 << channel);                               /* channel bit */
+}
+
+/**
+ * @brief     write a mux control byte
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @param[in] adapter iic adapter index
+ * @param[in] addr iic mux write address
+ * @param[in] data control byte
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a failed write makes the selected path of the adapter unknown
+ */
+static uint8_t a_ina219_topology_write(ina219_topology_t *topology, uint8_t adapter, uint8_t addr, uint8_t data)
+{
+    topology->switch_num++;                                       /* switch_num++ */
+    if (topology->mux_write(adapter, addr, data) != 0)            /* write the control byte */
+    {
+        topology->known[adapter] = 0;                             /* unknown state */
+        
+        return 1;                                                 /* return error */
+    }
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief     disable all the muxes of an adapter
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @param[in] adapter iic adapter index
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the cascaded muxes are reached through their upstream channels and disabled
+ *            before the first level muxes, each mux is written once
+ */
+static uint8_t a_ina219_topology_reset(ina219_topology_t *topology, uint8_t adapter)
+{
+    ina219_topology_device_t *prev = NULL;
+    uint8_t seen[16];
+    uint16_t k;
+    uint8_t i;
+    uint8_t j;
+    
+    memset(seen, 0, sizeof(seen));                                                           /* clear the first level */
+    for (k = 0; k < topology->device_num; k++)                                               /* loop the sweep order */
+    {
+        ina219_topology_device_t *dev = &topology->device[topology->order[k]];               /* get the device */
+        
+        if (dev->adapter != adapter)                                                         /* check the adapter */
+        {
+            continue;                                                                        /* skip */
+        }
+        for (i = 1; i < dev->path.depth; i++)                                                /* loop the cascaded levels */
+        {
+            uint8_t same = (prev != NULL) && (prev->path.depth > i);                         /* same mux as before */
+            
+            for (j = 0; (j <= i) && (same != 0); j++)                                        /* check the prefix */
+            {
+                if ((prev->path.mux[j] != dev->path.mux[j]) ||
+                    ((j < i) && (prev->path.channel[j] != dev->path.channel[j])))            /* check the level */
+                {
+                    same = 0;                                                                /* different */
+                }
+            }
+            if (same != 0)                                                                   /* already disabled */
+            {
+                continue;                                                                    /* skip */
+            }
+            for (j = 0; j < i; j++)                                                          /* open the upstream */
+            {
+                if (a_ina219_topology_write(topology, adapter, dev->path.mux[j],
+                                            a_ina219_topology_control(topology, dev->path.channel[j])) != 0)/* enable the channel */
+                {
+                    return 1;                                                                /* return error */
+                }
+            }
+            if (a_ina219_topology_write(topology, adapter, dev->path.mux[i], 0x00) != 0)     /* disable the mux */
+            {
+                return 1;                                                                    /* return error */
+            }
+        }
+        if (dev->path.depth != 0)                                                            /* first level mux */
+        {
+            seen[(dev->path.mux[0] >> 4) & 0x0F] |= (uint8_t)(1 << ((dev->path.mux[0] >> 1) & 0x07));/* mark the mux */
+        }
+        prev = dev;                                                                          /* save the device */
+    }
+    for (i = 0; i < 128; i++)                                                                /* loop the first level */
+    {
+        if ((seen[i >> 3] & (1 << (i & 0x07))) != 0)                                         /* check the mux */
+        {
+            if (a_ina219_topology_write(topology, adapter, (uint8_t)(i << 1), 0x00) != 0)    /* disable the mux */
+            {
+                return 1;                                                                    /* return error */
+            }
+        }
+    }
+    topology->selected[adapter].depth = 0;                                                   /* nothing selected */
+    topology->known[adapter] = 1;                                                            /* known state */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     initialize the topology
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @param[in] type mux type
+ * @param[in] *mux_write pointer to a mux control register write function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 topology or mux_write is NULL
+ *            - 4 type is invalid
+ * @note      mux_write gets the adapter, the iic mux write address and the control byte
+ */
+uint8_t ina219_topology_init(ina219_topology_t *topology, ina219_topology_mux_type_t type,
+                             uint8_t (*mux_write)(uint8_t adapter, uint8_t addr, uint8_t data))
+{
+    if ((topology == NULL) || (mux_write == NULL))                 /* check topology and mux_write */
+    {
+        return 2;                                                  /* return error */
+    }
+    if (type > INA219_TOPOLOGY_MUX_TYPE_SELECT)                    /* check the type */
+    {
+        return 4;                                                  /* return error */
+    }
+    
+    memset(topology, 0, sizeof(ina219_topology_t));                /* clear the topology */
+    topology->type = (uint8_t)type;                                /* set the type */
+    topology->mux_write = mux_write;                               /* set the mux write */
+    
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief      add a device
+ * @param[in]  *topology pointer to an ina219 topology structure
+ * @param[in]  adapter iic adapter index
+ * @param[in]  *path pointer to a mux path structure
+ * @param[in]  addr iic device write address
+ * @param[out] *index pointer to a device index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 topology, path or index is NULL
+ *             - 4 device table is full
+ *             - 5 adapter or path is invalid
+ *             - 6 device is already added
+ * @note       the sweep order is kept grouped by adapter and mux path
+ */
+uint8_t ina219_topology_add(ina219_topology_t *topology, uint8_t adapter, const ina219_topology_path_t *path,
+                            uint8_t addr, uint16_t *index)
+{
+    ina219_topology_device_t *dev;
+    uint8_t max;
+    uint8_t i;
+    uint16_t j;
+    
+    if ((topology == NULL) || (path == NULL) || (index == NULL))                       /* check topology, path and index */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (topology->device_num >= INA219_TOPOLOGY_MAX_DEVICE)                            /* check the table */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if ((adapter >= INA219_TOPOLOGY_MAX_ADAPTER) || (path->depth > INA219_TOPOLOGY_MAX_DEPTH))/* check adapter and depth */
+    {
+        return 5;                                                                      /* return error */
+    }
+    max = (topology->type == INA219_TOPOLOGY_MUX_TYPE_SELECT) ? 3 : 7;                 /* last channel */
+    for (i = 0; i < path->depth; i++)                                                  /* check the channels */
+    {
+        if (path->channel[i] > max)                                                    /* check the channel */
+        {
+            return 5;                                                                  /* return error */
+        }
+    }
+    
+    dev = &topology->device[topology->device_num];                                     /* get the device */
+    memset(dev, 0, sizeof(ina219_topology_device_t));                                  /* clear the device */
+    dev->adapter = adapter;                                                            /* set the adapter */
+    dev->addr = addr;                                                                  /* set the address */
+    dev->path.depth = path->depth;                                                     /* set the depth */
+    for (i = 0; i < path->depth; i++)                                                  /* copy the path */
+    {
+        dev->path.mux[i] = path->mux[i];                                               /* set the mux */
+        dev->path.channel[i] = path->channel[i];                                       /* set the channel */
+    }
+    for (j = 0; j < topology->device_num; j++)                                         /* check the duplicate */
+    {
+        if (a_ina219_topology_compare(&topology->device[j], dev) == 0)                 /* same device */
+        {
+            return 6;                                                                  /* return error */
+        }
+    }
+    for (j = topology->device_num; j > 0; j--)                                         /* insert in the sweep order */
+    {
+        if (a_ina219_topology_compare(&topology->device[topology->order[j - 1]], dev) < 0)/* check the order */
+        {
+            break;                                                                     /* break */
+        }
+        topology->order[j] = topology->order[j - 1];                                   /* move */
+    }
+    topology->order[j] = topology->device_num;                                         /* set the order */
+    *index = topology->device_num;                                                     /* set the index */
+    topology->device_num++;                                                            /* device_num++ */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     select the mux path of a device
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @param[in] index device index
+ * @return    status code
+ *            - 0 success
+ *            - 1 mux write failed
+ *            - 2 topology is NULL
+ *            - 4 index is invalid
+ * @note      only the levels that differ from the selected path are written, the muxes of the
+ *            old path that the new one does not reuse are disabled deepest first, so no other
+ *            segment stays connected, the first select of an adapter disables all its muxes
+ */
+uint8_t ina219_topology_select(ina219_topology_t *topology, uint16_t index)
+{
+    ina219_topology_device_t *dev;
+    ina219_topology_path_t *cur;
+    uint8_t p;
+    uint8_t i;
+    
+    if (topology == NULL)                                                                    /* check topology */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (index >= topology->device_num)                                                       /* check the index */
+    {
+        return 4;                                                                            /* return error */
+    }
+    
+    dev = &topology->device[index];                                                          /* get the device */
+    cur = &topology->selected[dev->adapter];                                                 /* get the selected path */
+    if (topology->known[dev->adapter] == 0)                                                  /* unknown state */
+    {
+        if (a_ina219_topology_reset(topology, dev->adapter) != 0)                            /* disable all the muxes */
+        {
+            return 1;                                                                        /* return error */
+        }
+    }
+    for (p = 0; (p < cur->depth) && (p < dev->path.depth); p++)                              /* common prefix */
+    {
+        if ((cur->mux[p] != dev->path.mux[p]) || (cur->channel[p] != dev->path.channel[p]))  /* check the level */
+        {
+            break;                                                                           /* break */
+        }
+    }
+    for (i = cur->depth; i > p; i--)                                                         /* leave the old path */
+    {
+        if (((i - 1) == p) && (p < dev->path.depth) && (cur->mux[p] == dev->path.mux[p]))    /* rewritten below */
+        {
+            continue;                                                                        /* skip */
+        }
+        if (a_ina219_topology_write(topology, dev->adapter, cur->mux[i - 1], 0x00) != 0)     /* disable the mux */
+        {
+            return 1;                                                                        /* return error */
+        }
+    }
+    for (i = p; i < dev->path.depth; i++)                                                    /* enter the new path */
+    {
+        if (a_ina219_topology_write(topology, dev->adapter, dev->path.mux[i],
+                                    a_ina219_topology_control(topology, dev->path.channel[i])) != 0)/* enable the channel */
+        {
+            return 1;                                                                        /* return error */
+        }
+    }
+    memcpy(cur, &dev->path, sizeof(ina219_topology_path_t));                                 /* set the selected path */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      read all the devices once
+ * @param[in]  *topology pointer to an ina219 topology structure
+ * @param[in]  *read pointer to a device read function address
+ * @param[out] *fail_num pointer to a failed read number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 mux write failed
+ *             - 2 topology, read or fail_num is NULL
+ * @note       the devices are visited grouped by adapter and mux path, so each mux channel
+ *             is switched once per sweep, read gets the device index
+ */
+uint8_t ina219_topology_sweep(ina219_topology_t *topology, uint8_t (*read)(uint16_t index), uint16_t *fail_num)
+{
+    uint16_t i;
+    
+    if ((topology == NULL) || (read == NULL) || (fail_num == NULL))          /* check topology, read and fail_num */
+    {
+        return 2;                                                            /* return error */
+    }
+    
+    *fail_num = 0;                                                           /* init 0 */
+    for (i = 0; i < topology->device_num; i++)                               /* loop the sweep order */
+    {
+        if (ina219_topology_select(topology, topology->order[i]) != 0)       /* select the path */
+        {
+            return 1;                                                        /* return error */
+        }
+        if (read(topology->order[i]) != 0)                                   /* read the device */
+        {
+            (*fail_num)++;                                                   /* fail_num++ */
+        }
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     forget the selected mux paths
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 topology is NULL
+ * @note      call it after a mux reset or when another master used the bus,
+ *            the next select disables all the muxes of the adapter first
+ */
+uint8_t ina219_topology_invalidate(ina219_topology_t *topology)
+{
+    if (topology == NULL)                                          /* check topology */
+    {
+        return 2;                                                  /* return error */
+    }
+    
+    memset(topology->known, 0, sizeof(topology->known));           /* unknown state */
+    
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief      get the mux write number
+ * @param[in]  *topology pointer to an ina219 topology structure
+ * @param[out] *num pointer to a mux write number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 topology or num is NULL
+ * @note       the number counts all the control writes since the init
+ */
+uint8_t ina219_topology_get_switches(ina219_topology_t *topology, uint32_t *num)
+{
+    if ((topology == NULL) || (num == NULL))        /* check topology and num */
+    {
+        return 2;                                   /* return error */
+    }
+    
+    *num = topology->switch_num;                    /* get the number */
+    
+    return 0;                                       /* success return 0 */
+}
@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_topology.h
+ * @brief     driver ina219 topology header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_TOPOLOGY_H
+#define DRIVER_INA219_TOPOLOGY_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_topology_driver ina219 topology driver function
+ * @brief    ina219 topology driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 topology max device definition
+ */
+#ifndef INA219_TOPOLOGY_MAX_DEVICE
+    #define INA219_TOPOLOGY_MAX_DEVICE 256        /**< 256 devices */
+#endif
+
+/**
+ * @brief ina219 topology max adapter definition
+ */
+#ifndef INA219_TOPOLOGY_MAX_ADAPTER
+    #define INA219_TOPOLOGY_MAX_ADAPTER 4        /**< 4 adapters */
+#endif
+
+/**
+ * @brief ina219 topology max depth definition
+ */
+#ifndef INA219_TOPOLOGY_MAX_DEPTH
+    #define INA219_TOPOLOGY_MAX_DEPTH 2        /**< 2 cascaded muxes */
+#endif
+
+/**
+ * @brief ina219 topology mux type enumeration definition
+ */
+typedef enum
+{
+    INA219_TOPOLOGY_MUX_TYPE_SWITCH = 0x00,        /**< tca9548a or tca9546a, one enable bit per channel */
+    INA219_TOPOLOGY_MUX_TYPE_SELECT = 0x01,        /**< tca9544a, enable bit 2 and the channel in bits 1:0 */
+} ina219_topology_mux_type_t;
+
+/**
+ * @brief ina219 topology path structure definition
+ */
+typedef struct ina219_topology_path_s
+{
+    uint8_t depth;                                    /**< mux levels, 0 is a device on the adapter */
+    uint8_t mux[INA219_TOPOLOGY_MAX_DEPTH];           /**< iic mux write address of each level */
+    uint8_t channel[INA219_TOPOLOGY_MAX_DEPTH];       /**< mux channel of each level */
+} ina219_topology_path_t;
+
+/**
+ * @brief ina219 topology device structure definition
+ */
+typedef struct ina219_topology_device_s
+{
+    uint8_t adapter;                   /**< iic adapter index */
+    uint8_t addr;                      /**< iic device write address */
+    ina219_topology_path_t path;       /**< mux path */
+} ina219_topology_device_t;
+
+/**
+ * @brief ina219 topology structure definition
+ */
+typedef struct ina219_topology_s
+{
+    ina219_topology_device_t device[INA219_TOPOLOGY_MAX_DEVICE];              /**< device table */
+    uint16_t device_num;                                                      /**< device number */
+    uint16_t order[INA219_TOPOLOGY_MAX_DEVICE];                               /**< sweep order */
+    ina219_topology_path_t selected[INA219_TOPOLOGY_MAX_ADAPTER];             /**< selected path of each adapter */
+    uint8_t known[INA219_TOPOLOGY_MAX_ADAPTER];                               /**< selected path known flag */
+    uint8_t type;                                                             /**< mux type */
+    uint32_t switch_num;                                                      /**< mux write number */
+    uint8_t (*mux_write)(uint8_t adapter, uint8_t addr, uint8_t data);        /**< point to a mux_write function address */
+} ina219_topology_t;
+
+/**
+ * @brief     initialize the topology
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @param[in] type mux type
+ * @param[in] *mux_write pointer to a mux control register write function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 topology or mux_write is NULL
+ *            - 4 type is invalid
+ * @note      mux_write gets the adapter, the iic mux write address and the control byte
+ */
+uint8_t ina219_topology_init(ina219_topology_t *topology, ina219_topology_mux_type_t type,
+                             uint8_t (*mux_write)(uint8_t adapter, uint8_t addr, uint8_t data));
+
+/**
+ * @brief      add a device
+ * @param[in]  *topology pointer to an ina219 topology structure
+ * @param[in]  adapter iic adapter index
+ * @param[in]  *path pointer to a mux path structure
+ * @param[in]  addr iic device write address
+ * @param[out] *index pointer to a device index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 topology, path or index is NULL
+ *             - 4 device table is full
+ *             - 5 adapter or path is invalid
+ *             - 6 device is already added
+ * @note       the sweep order is kept grouped by adapter and mux path
+ */
+uint8_t ina219_topology_add(ina219_topology_t *topology, uint8_t adapter, const ina219_topology_path_t *path,
+                            uint8_t addr, uint16_t *index);
+
+/**
+ * @brief     select the mux path of a device
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @param[in] index device index
+ * @return    status code
+ *            - 0 success
+ *            - 1 mux write failed
+ *            - 2 topology is NULL
+ *            - 4 index is invalid
+ * @note      only the levels that differ from the selected path are written, the muxes of the
+ *            old path that the new one does not reuse are disabled deepest first, so no other
+ *            segment stays connected, the first select of an adapter disables all its muxes
+ */
+uint8_t ina219_topology_select(ina219_topology_t *topology, uint16_t index);
+
+/**
+ * @brief      read all the devices once
+ * @param[in]  *topology pointer to an ina219 topology structure
+ * @param[in]  *read pointer to a device read function address
+ * @param[out] *fail_num pointer to a failed read number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 mux write failed
+ *             - 2 topology, read or fail_num is NULL
+ * @note       the devices are visited grouped by adapter and mux path, so each mux channel
+ *             is switched once per sweep, read gets the device index
+ */
+uint8_t ina219_topology_sweep(ina219_topology_t *topology, uint8_t (*read)(uint16_t index), uint16_t *fail_num);
+
+/**
+ * @brief     forget the selected mux paths
+ * @param[in] *topology pointer to an ina219 topology structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 topology is NULL
+ * @note      call it after a mux reset or when another master used the bus,
+ *            the next select disables all the muxes of the adapter first
+ */
+uint8_t ina219_topology_invalidate(ina219_topology_t *topology);
+
+/**
+ * @brief      get the mux write number
+ * @param[in]  *topology pointer to an ina219 topology structure
+ * @param[out] *num pointer to a mux write number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 topology or num is NULL
+ * @note       the number counts all the control writes since the init
+ */
+uint8_t ina219_topology_get_switches(ina219_topology_t *topology, uint32_t *num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
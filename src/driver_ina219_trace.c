@@ -0,0 +1,339 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_trace.c
+ * @brief     driver ina219 trace source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_trace.h"
+
+static ina219_trace_t *gs_trace = NULL;        /**< active trace */
+static uint8_t gs_busy = 0;                    /**< real transport busy flag */
+
+/**
+ * @brief     append a record entry
+ * @param[in] type entry type
+ * @param[in] addr iic address
+ * @param[in] reg iic register
+ * @param[in] len data length
+ * @return    pointer to the entry, NULL when the buffer is full
+ * @note      none
+ */
+static ina219_trace_entry_t *a_ina219_trace_append(uint8_t type, uint8_t addr, uint8_t reg, uint16_t len)
+{
+    ina219_trace_entry_t *e;
+    
+    if (gs_trace->num >= gs_trace->len)                                                   /* check the buffer */
+    {
+        gs_trace->mismatch = 1;                                                           /* trace is truncated */
+        
+        return NULL;                                                                      /* return NULL */
+    }
+    
+    e = &gs_trace->entry[gs_trace->num];                                                  /* get the entry */
+    memset(e, 0, sizeof(ina219_trace_entry_t));                                           /* clear the entry */
+    e->time = gs_trace->timestamp() - gs_trace->start;                                    /* set the time */
+    e->type = type;                                                                       /* set the type */
+    e->addr = addr;                                                                       /* set the address */
+    e->reg = reg;                                                                         /* set the register */
+    e->len = (len > INA219_TRACE_DATA_SIZE) ? INA219_TRACE_DATA_SIZE : (uint8_t)len;      /* set the length */
+    gs_trace->num++;                                                                      /* num++ */
+    
+    return e;                                                                             /* return the entry */
+}
+
+/**
+ * @brief     get the next replay entry
+ * @param[in] type expected entry type
+ * @param[in] addr expected iic address
+ * @param[in] reg expected iic register
+ * @param[in] len expected data length
+ * @return    pointer to the entry, NULL when it does not match
+ * @note      the recorded speed waits until the recorded time of the entry
+ */
+static ina219_trace_entry_t *a_ina219_trace_next(uint8_t type, uint8_t addr, uint8_t reg, uint16_t len)
+{
+    ina219_trace_entry_t *e;
+    
+    if (gs_trace->pos >= gs_trace->num)                                                   /* check the end */
+    {
+        gs_trace->mismatch = 1;                                                           /* set the mismatch */
+        
+        return NULL;                                                                      /* return NULL */
+    }
+    
+    e = &gs_trace->entry[gs_trace->pos];                                                  /* get the entry */
+    if ((e->type != type) || (e->addr != addr) || (e->reg != reg) ||
+        ((type != INA219_TRACE_TYPE_DELAY) && (e->len != len)))                           /* check the transaction */
+    {
+        gs_trace->mismatch = 1;                                                           /* set the mismatch */
+        
+        return NULL;                                                                      /* return NULL */
+    }
+    gs_trace->pos++;                                                                      /* pos++ */
+    if (gs_trace->speed == INA219_TRACE_SPEED_RECORDED)                                   /* recorded speed */
+    {
+        uint64_t now = gs_trace->timestamp() - gs_trace->start;                           /* get the time */
+        
+        if (e->time > now)                                                                /* check the time */
+        {
+            gs_busy = 1;                                                                  /* set busy */
+            gs_trace->delay_ms((uint32_t)((e->time - now + 999) / 1000));                 /* wait */
+            gs_busy = 0;                                                                  /* clear busy */
+        }
+    }
+    
+    return e;                                                                             /* return the entry */
+}
+
+/**
+ * @brief     start the trace
+ * @param[in] *trace pointer to an ina219 trace structure
+ * @param[in] mode trace mode
+ * @param[in] speed replay speed
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace is NULL
+ *            - 3 linked function is NULL
+ * @note      the record mode clears the entries, the replay mode serves the entries from the start,
+ *            only one trace is active at a time
+ */
+uint8_t ina219_trace_start(ina219_trace_t *trace, ina219_trace_mode_t mode, ina219_trace_speed_t speed)
+{
+    if (trace == NULL)                                                    /* check trace */
+    {
+        return 2;                                                         /* return error */
+    }
+    if ((trace->timestamp == NULL) || (trace->delay_ms == NULL) ||
+        ((mode == INA219_TRACE_MODE_RECORD) &&
+         ((trace->iic_read == NULL) || (trace->iic_write == NULL))))      /* check the linked functions */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    if (mode == INA219_TRACE_MODE_RECORD)                                 /* record */
+    {
+        trace->num = 0;                                                   /* clear the entries */
+    }
+    trace->pos = 0;                                                       /* reset the position */
+    trace->mode = (uint8_t)mode;                                          /* set the mode */
+    trace->speed = (uint8_t)speed;                                        /* set the speed */
+    trace->mismatch = 0;                                                  /* clear the mismatch */
+    trace->start = trace->timestamp();                                    /* set the start */
+    gs_trace = trace;                                                     /* set active */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief  stop the active trace
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t ina219_trace_stop(void)
+{
+    gs_trace = NULL;        /* set inactive */
+    
+    return 0;               /* success return 0 */
+}
+
+/**
+ * @brief  check if a trace is active
+ * @return active state
+ *         - 0 no trace or the real transport is being called
+ *         - 1 recording
+ *         - 2 replaying
+ * @note   an interface can route its callbacks through the trace when it is active
+ *         and link its own callbacks as the real transport
+ */
+uint8_t ina219_trace_is_active(void)
+{
+    if ((gs_trace == NULL) || (gs_busy != 0))          /* check the trace */
+    {
+        return 0;                                      /* not active */
+    }
+    
+    return (uint8_t)(gs_trace->mode + 1);              /* return the state */
+}
+
+/**
+ * @brief      get the trace status
+ * @param[in]  *trace pointer to an ina219 trace structure
+ * @param[out] *num pointer to a recorded or replayed entry number buffer
+ * @param[out] *mismatch pointer to a mismatch flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trace is NULL
+ * @note       the mismatch flag is set when a replayed transaction differs from the trace
+ *             or the record buffer is full
+ */
+uint8_t ina219_trace_get_status(ina219_trace_t *trace, uint32_t *num, uint8_t *mismatch)
+{
+    if (trace == NULL)                                                              /* check trace */
+    {
+        return 2;                                                                   /* return error */
+    }
+    
+    *num = (trace->mode == INA219_TRACE_MODE_RECORD) ? trace->num : trace->pos;    /* get the number */
+    *mismatch = trace->mismatch;                                                    /* get the mismatch */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      trace iic read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       link it as the iic_read function of the handle
+ */
+uint8_t ina219_trace_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    ina219_trace_entry_t *e;
+    uint8_t res;
+    
+    if (gs_trace == NULL)                                                          /* check the trace */
+    {
+        return 1;                                                                  /* return error */
+    }
+    
+    if (gs_trace->mode == INA219_TRACE_MODE_RECORD)                                /* record */
+    {
+        gs_busy = 1;                                                               /* set busy */
+        res = gs_trace->iic_read(addr, reg, buf, len);                             /* real read */
+        gs_busy = 0;                                                               /* clear busy */
+        e = a_ina219_trace_append(INA219_TRACE_TYPE_READ, addr, reg, len);         /* append an entry */
+        if (e != NULL)                                                             /* check the entry */
+        {
+            e->res = res;                                                          /* set the result */
+            memcpy(e->data, buf, e->len);                                          /* set the data */
+        }
+        
+        return res;                                                                /* return the result */
+    }
+    e = a_ina219_trace_next(INA219_TRACE_TYPE_READ, addr, reg, len);               /* get the next entry */
+    if (e == NULL)                                                                 /* check the entry */
+    {
+        return 1;                                                                  /* return error */
+    }
+    memcpy(buf, e->data, e->len);                                                  /* copy the data */
+    
+    return e->res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     trace iic write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      link it as the iic_write function of the handle
+ */
+uint8_t ina219_trace_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    ina219_trace_entry_t *e;
+    uint8_t res;
+    
+    if (gs_trace == NULL)                                                          /* check the trace */
+    {
+        return 1;                                                                  /* return error */
+    }
+    
+    if (gs_trace->mode == INA219_TRACE_MODE_RECORD)                                /* record */
+    {
+        gs_busy = 1;                                                               /* set busy */
+        res = gs_trace->iic_write(addr, reg, buf, len);                            /* real write */
+        gs_busy = 0;                                                               /* clear busy */
+        e = a_ina219_trace_append(INA219_TRACE_TYPE_WRITE, addr, reg, len);        /* append an entry */
+        if (e != NULL)                                                             /* check the entry */
+        {
+            e->res = res;                                                          /* set the result */
+            memcpy(e->data, buf, e->len);                                          /* set the data */
+        }
+        
+        return res;                                                                /* return the result */
+    }
+    e = a_ina219_trace_next(INA219_TRACE_TYPE_WRITE, addr, reg, len);              /* get the next entry */
+    if (e == NULL)                                                                 /* check the entry */
+    {
+        return 1;                                                                  /* return error */
+    }
+    if (memcmp(buf, e->data, e->len) != 0)                                         /* check the data */
+    {
+        gs_trace->mismatch = 1;                                                    /* set the mismatch */
+    }
+    
+    return e->res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     trace delay
+ * @param[in] ms time
+ * @note      link it as the delay_ms function of the handle,
+ *            the full speed replay skips the delay
+ */
+void ina219_trace_delay_ms(uint32_t ms)
+{
+    ina219_trace_entry_t *e;
+    
+    if (gs_trace == NULL)                                                          /* check the trace */
+    {
+        return;                                                                    /* return */
+    }
+    
+    if (gs_trace->mode == INA219_TRACE_MODE_RECORD)                                /* record */
+    {
+        e = a_ina219_trace_append(INA219_TRACE_TYPE_DELAY, 0, 0, 0);               /* append an entry */
+        if (e != NULL)                                                             /* check the entry */
+        {
+            e->ms = ms;                                                            /* set the time */
+        }
+        gs_busy = 1;                                                               /* set busy */
+        gs_trace->delay_ms(ms);                                                    /* real delay */
+        gs_busy = 0;                                                               /* clear busy */
+        
+        return;                                                                    /* return */
+    }
+    e = a_ina219_trace_next(INA219_TRACE_TYPE_DELAY, 0, 0, 0);                     /* get the next entry */
+    if ((e != NULL) && (e->ms != ms))                                              /* check the time */
+    {
+        gs_trace->mismatch = 1;                                                    /* set the mismatch */
+    }
+}
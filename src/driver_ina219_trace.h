@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_trace.h
+ * @brief     driver ina219 trace header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_TRACE_H
+#define DRIVER_INA219_TRACE_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_trace_driver ina219 trace driver function
+ * @brief    ina219 trace driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 trace data size definition
+ */
+#ifndef INA219_TRACE_DATA_SIZE
+    #define INA219_TRACE_DATA_SIZE 2        /**< 2 bytes */
+#endif
+
+/**
+ * @brief ina219 trace mode enumeration definition
+ */
+typedef enum
+{
+    INA219_TRACE_MODE_RECORD = 0x00,        /**< record the transactions */
+    INA219_TRACE_MODE_REPLAY = 0x01,        /**< replay the transactions */
+} ina219_trace_mode_t;
+
+/**
+ * @brief ina219 trace speed enumeration definition
+ */
+typedef enum
+{
+    INA219_TRACE_SPEED_FULL     = 0x00,        /**< replay without delay */
+    INA219_TRACE_SPEED_RECORDED = 0x01,        /**< replay with the recorded timing */
+} ina219_trace_speed_t;
+
+/**
+ * @brief ina219 trace type enumeration definition
+ */
+typedef enum
+{
+    INA219_TRACE_TYPE_READ  = 0x00,        /**< iic read */
+    INA219_TRACE_TYPE_WRITE = 0x01,        /**< iic write */
+    INA219_TRACE_TYPE_DELAY = 0x02,        /**< delay */
+} ina219_trace_type_t;
+
+/**
+ * @brief ina219 trace entry structure definition
+ */
+typedef struct ina219_trace_entry_s
+{
+    uint64_t time;                                 /**< time since the start in us */
+    uint32_t ms;                                   /**< delay time */
+    uint8_t type;                                  /**< entry type */
+    uint8_t addr;                                  /**< iic address */
+    uint8_t reg;                                   /**< iic register */
+    uint8_t res;                                   /**< transaction result */
+    uint8_t len;                                   /**< data length */
+    uint8_t data[INA219_TRACE_DATA_SIZE];          /**< data */
+} ina219_trace_entry_t;
+
+/**
+ * @brief ina219 trace structure definition
+ */
+typedef struct ina219_trace_s
+{
+    ina219_trace_entry_t *entry;                                                        /**< entry buffer */
+    uint32_t len;                                                                       /**< entry buffer length */
+    uint32_t num;                                                                       /**< entry number */
+    uint32_t pos;                                                                       /**< replay position */
+    uint8_t mode;                                                                       /**< trace mode */
+    uint8_t speed;                                                                      /**< replay speed */
+    uint8_t mismatch;                                                                   /**< mismatch flag */
+    uint64_t start;                                                                     /**< start timestamp */
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);         /**< point to an iic_read function address */
+    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
+    void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
+    uint64_t (*timestamp)(void);                                                        /**< point to a timestamp function address in us */
+} ina219_trace_t;
+
+/**
+ * @brief     initialize ina219_trace_t structure
+ * @param[in] TRACE pointer to an ina219 trace structure
+ * @param[in] BUF pointer to an entry buffer
+ * @param[in] LEN entry buffer length
+ * @note      none
+ */
+#define DRIVER_INA219_TRACE_LINK_INIT(TRACE, BUF, LEN)  do { memset(TRACE, 0, sizeof(ina219_trace_t)); \
+                                                             (TRACE)->entry = BUF; (TRACE)->len = LEN; } while (0)
+
+/**
+ * @brief     link the real iic_read function
+ * @param[in] TRACE pointer to an ina219 trace structure
+ * @param[in] FUC pointer to an iic_read function address
+ * @note      none
+ */
+#define DRIVER_INA219_TRACE_LINK_IIC_READ(TRACE, FUC)   (TRACE)->iic_read = FUC
+
+/**
+ * @brief     link the real iic_write function
+ * @param[in] TRACE pointer to an ina219 trace structure
+ * @param[in] FUC pointer to an iic_write function address
+ * @note      none
+ */
+#define DRIVER_INA219_TRACE_LINK_IIC_WRITE(TRACE, FUC)  (TRACE)->iic_write = FUC
+
+/**
+ * @brief     link the real delay_ms function
+ * @param[in] TRACE pointer to an ina219 trace structure
+ * @param[in] FUC pointer to a delay_ms function address
+ * @note      none
+ */
+#define DRIVER_INA219_TRACE_LINK_DELAY_MS(TRACE, FUC)   (TRACE)->delay_ms = FUC
+
+/**
+ * @brief     link the timestamp function
+ * @param[in] TRACE pointer to an ina219 trace structure
+ * @param[in] FUC pointer to a timestamp function address
+ * @note      none
+ */
+#define DRIVER_INA219_TRACE_LINK_TIMESTAMP(TRACE, FUC)  (TRACE)->timestamp = FUC
+
+/**
+ * @brief     start the trace
+ * @param[in] *trace pointer to an ina219 trace structure
+ * @param[in] mode trace mode
+ * @param[in] speed replay speed
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace is NULL
+ *            - 3 linked function is NULL
+ * @note      the record mode clears the entries, the replay mode serves the entries from the start,
+ *            only one trace is active at a time
+ */
+uint8_t ina219_trace_start(ina219_trace_t *trace, ina219_trace_mode_t mode, ina219_trace_speed_t speed);
+
+/**
+ * @brief  stop the active trace
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t ina219_trace_stop(void);
+
+/**
+ * @brief  check if a trace is active
+ * @return active state
+ *         - 0 no trace or the real transport is being called
+ *         - 1 recording
+ *         - 2 replaying
+ * @note   an interface can route its callbacks through the trace when it is active
+ *         and link its own callbacks as the real transport
+ */
+uint8_t ina219_trace_is_active(void);
+
+/**
+ * @brief      get the trace status
+ * @param[in]  *trace pointer to an ina219 trace structure
+ * @param[out] *num pointer to a recorded or replayed entry number buffer
+ * @param[out] *mismatch pointer to a mismatch flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 trace is NULL
+ * @note       the mismatch flag is set when a replayed transaction differs from the trace
+ *             or the record buffer is full
+ */
+uint8_t ina219_trace_get_status(ina219_trace_t *trace, uint32_t *num, uint8_t *mismatch);
+
+/**
+ * @brief      trace iic read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       link it as the iic_read function of the handle
+ */
+uint8_t ina219_trace_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     trace iic write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      link it as the iic_write function of the handle
+ */
+uint8_t ina219_trace_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     trace delay
+ * @param[in] ms time
+ * @note      link it as the delay_ms function of the handle,
+ *            the full speed replay skips the delay
+ */
+void ina219_trace_delay_ms(uint32_t ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
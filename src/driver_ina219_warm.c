@@ -0,0 +1,480 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_warm.c
+ * @brief     driver ina219 warm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_warm.h"
+#include "driver_ina219_log.h"
+#include <string.h>
+
+/**
+ * @brief chip register definition
+ */
+#define INA219_WARM_REG_CONF           0x00        /**< configuration register */
+#define INA219_WARM_REG_CALIBRATION    0x05        /**< calibration register */
+
+/**
+ * @brief conf register bits checked by the warm start
+ * @note  the reset bit always reads 0 and the mode may be power down after deinit
+ */
+#define INA219_WARM_CONF_MASK          0x7FF8
+
+/**
+ * @brief      iic interface read bytes
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_ina219_warm_iic_read(ina219_handle_t *handle, uint8_t reg, uint16_t *data)
+{
+    uint8_t buf[2];
+    
+    memset(buf, 0, sizeof(uint8_t) * 2);                                        /* clear the buffer */
+    if (handle->iic_read(handle->iic_addr, reg, (uint8_t *)buf, 2) != 0)        /* read data */
+    {
+        return 1;                                                               /* return error */
+    }
+    *data = (uint16_t)buf[0] << 8 | buf[1];                                     /* get data */
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     iic interface write bytes
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] reg iic register address
+ * @param[in] data written data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_ina219_warm_iic_write(ina219_handle_t *handle, uint8_t reg, uint16_t data)
+{
+    uint8_t buf[2];
+    
+    buf[0] = (uint8_t)((data >> 8) & 0xFF);                                      /* get MSB */
+    buf[1] = (uint8_t)((data >> 0) & 0xFF);                                      /* get LSB */
+    if (handle->iic_write(handle->iic_addr, reg, (uint8_t *)buf, 2) != 0)        /* write data */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     convert the resistance to micro ohm
+ * @param[in] r resistance in ohm
+ * @return    resistance in micro ohm
+ * @note      none
+ */
+static uint32_t a_ina219_warm_micro_ohm(double r)
+{
+    if (r <= 0.0)                                                /* check the resistance */
+    {
+        return 0;                                                /* return 0 */
+    }
+    
+    return (uint32_t)(r * 1000000.0 + 0.5);                      /* round to micro ohm */
+}
+
+/**
+ * @brief     initialize the warm start cache
+ * @param[in] *cache pointer to an ina219 warm cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache is NULL
+ * @note      also used to clear the cache
+ */
+uint8_t ina219_warm_cache_init(ina219_warm_cache_t *cache)
+{
+    if (cache == NULL)                                   /* check cache */
+    {
+        return 2;                                        /* return error */
+    }
+    
+    memset(cache, 0, sizeof(ina219_warm_cache_t));       /* clear the cache */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      find the cache entry of a device
+ * @param[in]  *cache pointer to an ina219 warm cache structure
+ * @param[in]  addr iic device address
+ * @param[in]  r reference resistor value
+ * @param[out] **entry pointer to an entry pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 cache or entry is NULL
+ *             - 4 entry is not found
+ * @note       the entry matches only when both the address and the resistance are the same
+ */
+uint8_t ina219_warm_cache_find(ina219_warm_cache_t *cache, uint8_t addr, double r, ina219_warm_entry_t **entry)
+{
+    uint32_t micro_ohm;
+    uint8_t i;
+    
+    if ((cache == NULL) || (entry == NULL))                                       /* check cache and entry */
+    {
+        return 2;                                                                 /* return error */
+    }
+    
+    micro_ohm = a_ina219_warm_micro_ohm(r);                                       /* get the resistance */
+    for (i = 0; i < cache->num; i++)                                              /* loop all entries */
+    {
+        if ((cache->entry[i].addr == addr) &&
+            (cache->entry[i].micro_ohm == micro_ohm))                             /* check the device */
+        {
+            *entry = &cache->entry[i];                                            /* set the entry */
+            
+            return 0;                                                             /* success return 0 */
+        }
+    }
+    
+    return 4;                                                                     /* return error */
+}
+
+/**
+ * @brief     store an entry into the cache
+ * @param[in] *cache pointer to an ina219 warm cache structure
+ * @param[in] *entry pointer to an ina219 warm entry structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache or entry is NULL
+ *            - 4 cache is full
+ * @note      the entry of the same address is replaced
+ */
+uint8_t ina219_warm_cache_store(ina219_warm_cache_t *cache, const ina219_warm_entry_t *entry)
+{
+    uint8_t i;
+    
+    if ((cache == NULL) || (entry == NULL))                          /* check cache and entry */
+    {
+        return 2;                                                    /* return error */
+    }
+    
+    for (i = 0; i < cache->num; i++)                                 /* loop all entries */
+    {
+        if (cache->entry[i].addr == entry->addr)                     /* check the address */
+        {
+            cache->entry[i] = *entry;                                /* replace the entry */
+            
+            return 0;                                                /* success return 0 */
+        }
+    }
+    if (cache->num >= INA219_WARM_MAX_DEVICE)                        /* check the size */
+    {
+        return 4;                                                    /* return error */
+    }
+    cache->entry[cache->num] = *entry;                               /* append the entry */
+    cache->num++;                                                    /* num++ */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief      serialize the cache
+ * @param[in]  *cache pointer to an ina219 warm cache structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *out_len pointer to a written length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 cache, buf or out_len is NULL
+ *             - 4 buffer is too small
+ * @note       little endian, protected by a crc32
+ */
+uint8_t ina219_warm_cache_serialize(ina219_warm_cache_t *cache, uint8_t *buf, uint32_t len, uint32_t *out_len)
+{
+    uint32_t crc;
+    uint32_t pos;
+    uint8_t i;
+    
+    if ((cache == NULL) || (buf == NULL) || (out_len == NULL))                                     /* check cache, buf and out_len */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (len < (uint32_t)(INA219_WARM_HEADER_SIZE + cache->num * INA219_WARM_ENTRY_SIZE + 4))       /* check the length */
+    {
+        return 4;                                                                                  /* return error */
+    }
+    
+    buf[0] = 'I';                                                                                  /* set the magic */
+    buf[1] = 'N';                                                                                  /* set the magic */
+    buf[2] = 'W';                                                                                  /* set the magic */
+    buf[3] = 'C';                                                                                  /* set the magic */
+    buf[4] = INA219_WARM_VERSION;                                                                  /* set the version */
+    buf[5] = cache->num;                                                                           /* set the number */
+    buf[6] = 0;                                                                                    /* reserved */
+    buf[7] = 0;                                                                                    /* reserved */
+    pos = INA219_WARM_HEADER_SIZE;                                                                 /* first entry */
+    for (i = 0; i < cache->num; i++)                                                               /* loop all entries */
+    {
+        ina219_warm_entry_t *entry = &cache->entry[i];                                             /* get the entry */
+        
+        buf[pos + 0] = entry->addr;                                                                /* set the address */
+        buf[pos + 1] = entry->power_mode;                                                          /* set the power mode */
+        buf[pos + 2] = (uint8_t)(entry->conf >> 0);                                                /* set the conf */
+        buf[pos + 3] = (uint8_t)(entry->conf >> 8);                                                /* set the conf */
+        buf[pos + 4] = (uint8_t)(entry->calibration >> 0);                                         /* set the calibration */
+        buf[pos + 5] = (uint8_t)(entry->calibration >> 8);                                         /* set the calibration */
+        buf[pos + 6] = 0;                                                                          /* reserved */
+        buf[pos + 7] = 0;                                                                          /* reserved */
+        buf[pos + 8] = (uint8_t)(entry->micro_ohm >> 0);                                           /* set the resistance */
+        buf[pos + 9] = (uint8_t)(entry->micro_ohm >> 8);                                           /* set the resistance */
+        buf[pos + 10] = (uint8_t)(entry->micro_ohm >> 16);                                         /* set the resistance */
+        buf[pos + 11] = (uint8_t)(entry->micro_ohm >> 24);                                         /* set the resistance */
+        pos += INA219_WARM_ENTRY_SIZE;                                                             /* next entry */
+    }
+    crc = ina219_log_crc32(0, buf, pos);                                                           /* get the crc */
+    buf[pos + 0] = (uint8_t)(crc >> 0);                                                            /* set the crc */
+    buf[pos + 1] = (uint8_t)(crc >> 8);                                                            /* set the crc */
+    buf[pos + 2] = (uint8_t)(crc >> 16);                                                           /* set the crc */
+    buf[pos + 3] = (uint8_t)(crc >> 24);                                                           /* set the crc */
+    *out_len = pos + 4;                                                                            /* set the length */
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     deserialize the cache
+ * @param[in] *cache pointer to an ina219 warm cache structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache or buf is NULL
+ *            - 4 data is invalid
+ * @note      the cache is cleared when the data is invalid
+ */
+uint8_t ina219_warm_cache_deserialize(ina219_warm_cache_t *cache, const uint8_t *buf, uint32_t len)
+{
+    uint32_t crc;
+    uint32_t pos;
+    uint8_t num;
+    uint8_t i;
+    
+    if ((cache == NULL) || (buf == NULL))                                                           /* check cache and buf */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    
+    memset(cache, 0, sizeof(ina219_warm_cache_t));                                                  /* clear the cache */
+    if (len < (INA219_WARM_HEADER_SIZE + 4))                                                        /* check the length */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    if ((buf[0] != 'I') || (buf[1] != 'N') || (buf[2] != 'W') || (buf[3] != 'C') ||
+        (buf[4] != INA219_WARM_VERSION))                                                            /* check the magic and version */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    num = buf[5];                                                                                   /* get the number */
+    pos = INA219_WARM_HEADER_SIZE + num * INA219_WARM_ENTRY_SIZE;                                   /* crc position */
+    if ((num > INA219_WARM_MAX_DEVICE) || (len != (pos + 4)))                                       /* check the number */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    crc = (uint32_t)buf[pos + 0] | ((uint32_t)buf[pos + 1] << 8) |
+          ((uint32_t)buf[pos + 2] << 16) | ((uint32_t)buf[pos + 3] << 24);                          /* get the crc */
+    if (crc != ina219_log_crc32(0, buf, pos))                                                       /* check the crc */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    pos = INA219_WARM_HEADER_SIZE;                                                                  /* first entry */
+    for (i = 0; i < num; i++)                                                                       /* loop all entries */
+    {
+        ina219_warm_entry_t *entry = &cache->entry[i];                                              /* get the entry */
+        
+        entry->addr = buf[pos + 0];                                                                 /* get the address */
+        entry->power_mode = buf[pos + 1];                                                           /* get the power mode */
+        entry->conf = (uint16_t)(buf[pos + 2] | (buf[pos + 3] << 8));                               /* get the conf */
+        entry->calibration = (uint16_t)(buf[pos + 4] | (buf[pos + 5] << 8));                        /* get the calibration */
+        entry->micro_ohm = (uint32_t)buf[pos + 8] | ((uint32_t)buf[pos + 9] << 8) |
+                           ((uint32_t)buf[pos + 10] << 16) | ((uint32_t)buf[pos + 11] << 24);       /* get the resistance */
+        pos += INA219_WARM_ENTRY_SIZE;                                                              /* next entry */
+    }
+    cache->num = num;                                                                               /* set the number */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      save the running configuration of an initialized chip
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *entry pointer to an ina219 warm entry structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle or entry is NULL
+ *             - 3 handle is not initialized
+ * @note       call it after the chip is fully configured
+ */
+uint8_t ina219_warm_save(ina219_handle_t *handle, ina219_warm_entry_t *entry)
+{
+    uint16_t conf;
+    uint16_t calibration;
+    
+    if ((handle == NULL) || (entry == NULL))                                         /* check handle and entry */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    if (a_ina219_warm_iic_read(handle, INA219_WARM_REG_CONF, &conf) != 0)            /* read conf */
+    {
+        handle->debug_print("ina219: read conf register failed.\n");                 /* read conf register failed */
+        
+        return 1;                                                                    /* return error */
+    }
+    if (a_ina219_warm_iic_read(handle, INA219_WARM_REG_CALIBRATION, &calibration) != 0)    /* read calibration */
+    {
+        handle->debug_print("ina219: read calibration register failed.\n");          /* read calibration register failed */
+        
+        return 1;                                                                    /* return error */
+    }
+    entry->addr = handle->iic_addr;                                                  /* set the address */
+    entry->power_mode = handle->power_mode;                                          /* set the power mode */
+    entry->conf = conf;                                                              /* set the conf */
+    entry->calibration = calibration;                                                /* set the calibration */
+    entry->micro_ohm = a_ina219_warm_micro_ohm(handle->r);                           /* set the resistance */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip from a cached configuration
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] *entry pointer to an ina219 warm entry structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle or entry is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 read failed
+ *            - 5 chip doesn't match the entry
+ *            - 6 write conf failed
+ * @note      set the address pin and the resistance before calling it,
+ *            conf and calibration are verified with one read each and
+ *            the soft reset and the reconfiguration are skipped when they match,
+ *            a powered down chip is woken up with one conf write,
+ *            the current lsb is derived from the restored calibration,
+ *            the iic is closed on failure so that ina219_init can run as the cold path
+ */
+uint8_t ina219_warm_init(ina219_handle_t *handle, const ina219_warm_entry_t *entry)
+{
+    uint16_t conf;
+    uint16_t calibration;
+    
+    if ((handle == NULL) || (entry == NULL))                                                   /* check handle and entry */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if (handle->debug_print == NULL)                                                           /* check debug_print */
+    {
+        return 3;                                                                              /* return error */
+    }
+    if ((handle->iic_init == NULL) || (handle->iic_deinit == NULL) ||
+        (handle->iic_read == NULL) || (handle->iic_write == NULL) ||
+        (handle->delay_ms == NULL))                                                            /* check the linked functions */
+    {
+        handle->debug_print("ina219: linked functions is null.\n");                            /* linked functions is null */
+        
+        return 3;                                                                              /* return error */
+    }
+    if ((entry->addr != handle->iic_addr) ||
+        (entry->micro_ohm != a_ina219_warm_micro_ohm(handle->r)))                              /* check the device */
+    {
+        return 5;                                                                              /* return error */
+    }
+    
+    if (handle->iic_init() != 0)                                                               /* iic init */
+    {
+        handle->debug_print("ina219: iic init failed.\n");                                     /* iic init failed */
+        
+        return 1;                                                                              /* return error */
+    }
+    if (a_ina219_warm_iic_read(handle, INA219_WARM_REG_CONF, &conf) != 0)                      /* read conf */
+    {
+        handle->debug_print("ina219: read conf register failed.\n");                           /* read conf register failed */
+        (void)handle->iic_deinit();                                                            /* iic deinit */
+        
+        return 4;                                                                              /* return error */
+    }
+    if (a_ina219_warm_iic_read(handle, INA219_WARM_REG_CALIBRATION, &calibration) != 0)        /* read calibration */
+    {
+        handle->debug_print("ina219: read calibration register failed.\n");                    /* read calibration register failed */
+        (void)handle->iic_deinit();                                                            /* iic deinit */
+        
+        return 4;                                                                              /* return error */
+    }
+    if (((conf & INA219_WARM_CONF_MASK) != (entry->conf & INA219_WARM_CONF_MASK)) ||
+        (calibration != entry->calibration))                                                   /* check the registers */
+    {
+        (void)handle->iic_deinit();                                                            /* iic deinit */
+        
+        return 5;                                                                              /* return error */
+    }
+    if (conf != entry->conf)                                                                   /* only the mode is different */
+    {
+        if (a_ina219_warm_iic_write(handle, INA219_WARM_REG_CONF, entry->conf) != 0)           /* write conf */
+        {
+            handle->debug_print("ina219: write conf register failed.\n");                      /* write conf register failed */
+            (void)handle->iic_deinit();                                                        /* iic deinit */
+            
+            return 6;                                                                          /* return error */
+        }
+    }
+    if (calibration != 0)                                                                      /* check the calibration */
+    {
+        handle->current_lsb = 0.04096 / ((double)calibration * handle->r);                     /* derive the current lsb */
+    }
+    else
+    {
+        handle->current_lsb = 0.0;                                                             /* no current without calibration */
+    }
+    handle->power_mode = entry->power_mode;                                                    /* restore the power mode */
+    handle->inited = 1;                                                                        /* flag inited */
+    
+    return 0;                                                                                  /* success return 0 */
+}
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ina219_warm.h
+ * @brief     driver ina219 warm header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_WARM_H
+#define DRIVER_INA219_WARM_H
+
+#include "driver_ina219.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ina219_warm_driver ina219 warm driver function
+ * @brief    ina219 warm driver modules
+ * @ingroup  ina219_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 warm max device definition
+ */
+#ifndef INA219_WARM_MAX_DEVICE
+    #define INA219_WARM_MAX_DEVICE 16        /**< 16 devices */
+#endif
+
+/**
+ * @brief ina219 warm cache format definition
+ */
+#define INA219_WARM_VERSION            1                                                                  /**< cache format version */
+#define INA219_WARM_HEADER_SIZE        8                                                                  /**< cache header size */
+#define INA219_WARM_ENTRY_SIZE         12                                                                 /**< serialized entry size */
+#define INA219_WARM_MAX_SIZE           (INA219_WARM_HEADER_SIZE + INA219_WARM_MAX_DEVICE * INA219_WARM_ENTRY_SIZE + 4)    /**< max serialized size */
+
+/**
+ * @brief ina219 warm entry structure definition
+ */
+typedef struct ina219_warm_entry_s
+{
+    uint8_t addr;                 /**< iic device address */
+    uint8_t power_mode;           /**< power mode */
+    uint16_t conf;                /**< expected conf register */
+    uint16_t calibration;         /**< expected calibration register */
+    uint32_t micro_ohm;           /**< resistance in micro ohm */
+} ina219_warm_entry_t;
+
+/**
+ * @brief ina219 warm cache structure definition
+ */
+typedef struct ina219_warm_cache_s
+{
+    ina219_warm_entry_t entry[INA219_WARM_MAX_DEVICE];        /**< entry table */
+    uint8_t num;                                              /**< entry number */
+} ina219_warm_cache_t;
+
+/**
+ * @brief     initialize the warm start cache
+ * @param[in] *cache pointer to an ina219 warm cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache is NULL
+ * @note      also used to clear the cache
+ */
+uint8_t ina219_warm_cache_init(ina219_warm_cache_t *cache);
+
+/**
+ * @brief      find the cache entry of a device
+ * @param[in]  *cache pointer to an ina219 warm cache structure
+ * @param[in]  addr iic device address
+ * @param[in]  r reference resistor value
+ * @param[out] **entry pointer to an entry pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 cache or entry is NULL
+ *             - 4 entry is not found
+ * @note       the entry matches only when both the address and the resistance are the same
+ */
+uint8_t ina219_warm_cache_find(ina219_warm_cache_t *cache, uint8_t addr, double r, ina219_warm_entry_t **entry);
+
+/**
+ * @brief     store an entry into the cache
+ * @param[in] *cache pointer to an ina219 warm cache structure
+ * @param[in] *entry pointer to an ina219 warm entry structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache or entry is NULL
+ *            - 4 cache is full
+ * @note      the entry of the same address is replaced
+ */
+uint8_t ina219_warm_cache_store(ina219_warm_cache_t *cache, const ina219_warm_entry_t *entry);
+
+/**
+ * @brief      serialize the cache
+ * @param[in]  *cache pointer to an ina219 warm cache structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *out_len pointer to a written length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 cache, buf or out_len is NULL
+ *             - 4 buffer is too small
+ * @note       little endian, protected by a crc32
+ */
+uint8_t ina219_warm_cache_serialize(ina219_warm_cache_t *cache, uint8_t *buf, uint32_t len, uint32_t *out_len);
+
+/**
+ * @brief     deserialize the cache
+ * @param[in] *cache pointer to an ina219 warm cache structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache or buf is NULL
+ *            - 4 data is invalid
+ * @note      the cache is cleared when the data is invalid
+ */
+uint8_t ina219_warm_cache_deserialize(ina219_warm_cache_t *cache, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      save the running configuration of an initialized chip
+ * @param[in]  *handle pointer to an ina219 handle structure
+ * @param[out] *entry pointer to an ina219 warm entry structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle or entry is NULL
+ *             - 3 handle is not initialized
+ * @note       call it after the chip is fully configured
+ */
+uint8_t ina219_warm_save(ina219_handle_t *handle, ina219_warm_entry_t *entry);
+
+/**
+ * @brief     initialize the chip from a cached configuration
+ * @param[in] *handle pointer to an ina219 handle structure
+ * @param[in] *entry pointer to an ina219 warm entry structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle or entry is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 read failed
+ *            - 5 chip doesn't match the entry
+ *            - 6 write conf failed
+ * @note      set the address pin and the resistance before calling it,
+ *            conf and calibration are verified with one read each and
+ *            the soft reset and the reconfiguration are skipped when they match,
+ *            a powered down chip is woken up with one conf write,
+ *            the current lsb is derived from the restored calibration,
+ *            the iic is closed on failure so that ina219_init can run as the cold path
+ */
+uint8_t ina219_warm_init(ina219_handle_t *handle, const ina219_warm_entry_t *entry);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,278 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_alert_test.c
+ * @brief     driver ina219 alert test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_alert_test.h"
+#include "driver_ina219_alert.h"
+#include <string.h>
+
+static ina219_handle_t gs_handle;                             /**< ina219 handle */
+static ina219_alert_t gs_alert;                               /**< ina219 alert */
+static uint32_t gs_event_num[INA219_ALERT_MAX_RULE];          /**< event number of each rule */
+
+/**
+ * @brief over current rule values in mA, limit 100mA, hysteresis 20mA, 2 of 3
+ */
+static const double gs_over_value[8] = {50.0, 150.0, 50.0, 150.0, 90.0, 70.0, 95.0, 60.0};
+
+/**
+ * @brief over current rule states after each value
+ */
+static const uint8_t gs_over_active[8] = {0, 0, 0, 1, 1, 1, 1, 0};
+
+/**
+ * @brief bus voltage rate rule values in mV, limit 1000mV, hysteresis 500mV, 1 of 1
+ */
+static const double gs_rate_value[5] = {12000.0, 12100.0, 13500.0, 13400.0, 14000.0};
+
+/**
+ * @brief bus voltage rate rule states after each value
+ */
+static const uint8_t gs_rate_active[5] = {0, 0, 1, 0, 0};
+
+/**
+ * @brief      alert callback
+ * @param[in]  index rule index
+ * @param[in]  event alert event
+ * @param[in]  raw raw value
+ * @note       none
+ */
+static void a_ina219_alert_test_callback(uint8_t index, ina219_alert_event_t event, int32_t raw)
+{
+    gs_event_num[index]++;
+    ina219_interface_debug_print("ina219: rule %d %s at raw %d.\n", index,
+                                 (event == INA219_ALERT_EVENT_ASSERT) ? "asserted" : "cleared", raw);
+}
+
+/**
+ * @brief     feed one value and check a rule
+ * @param[in] index rule index
+ * @param[in] channel alert channel of the value
+ * @param[in] value value in mV, mA or mW
+ * @param[in] expect expected active flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the other channels of the sample are 0
+ */
+static uint8_t a_ina219_alert_test_feed(uint8_t index, ina219_alert_channel_t channel, double value, uint8_t expect)
+{
+    int32_t raw;
+    uint8_t active;
+    ina219_sample_t sample;
+    
+    memset(&sample, 0, sizeof(sample));
+    if (ina219_alert_convert_to_raw(&gs_handle, channel, value, &raw) != 0)
+    {
+        ina219_interface_debug_print("ina219: convert to raw failed.\n");
+        
+        return 1;
+    }
+    if (channel == INA219_ALERT_CHANNEL_SHUNT_VOLTAGE)
+    {
+        sample.shunt_voltage = (int16_t)raw;
+    }
+    else if (channel == INA219_ALERT_CHANNEL_BUS_VOLTAGE)
+    {
+        sample.bus_voltage = (uint16_t)(raw << 3);
+    }
+    else if (channel == INA219_ALERT_CHANNEL_CURRENT)
+    {
+        sample.current = (int16_t)raw;
+    }
+    else
+    {
+        sample.power = (uint16_t)raw;
+    }
+    if ((ina219_alert_update(&gs_alert, &sample) != 0) ||
+        (ina219_alert_get_rule_state(&gs_alert, index, &active) != 0))
+    {
+        ina219_interface_debug_print("ina219: alert update failed.\n");
+        
+        return 1;
+    }
+    if (active != expect)
+    {
+        ina219_interface_debug_print("ina219: rule %d is %d after %0.1f, expect %d.\n", index, active, value, expect);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     alert test
+ * @param[in] addr_pin iic device address
+ * @param[in] r extern resistance
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the chip is only used for the calibration, the rules are fed with made up samples
+ *            and the assert, the release and the n of m debounce are checked
+ */
+uint8_t ina219_alert_test(ina219_address_t addr_pin, double r)
+{
+    uint8_t res;
+    uint8_t index;
+    uint8_t over;
+    uint8_t rate;
+    uint32_t i;
+    uint16_t calibration;
+    
+    /* link interface function */
+    DRIVER_INA219_LINK_INIT(&gs_handle, ina219_handle_t);
+    DRIVER_INA219_LINK_IIC_INIT(&gs_handle, ina219_interface_iic_init);
+    DRIVER_INA219_LINK_IIC_DEINIT(&gs_handle, ina219_interface_iic_deinit);
+    DRIVER_INA219_LINK_IIC_READ(&gs_handle, ina219_interface_iic_read);
+    DRIVER_INA219_LINK_IIC_WRITE(&gs_handle, ina219_interface_iic_write);
+    DRIVER_INA219_LINK_DELAY_MS(&gs_handle, ina219_interface_delay_ms);
+    DRIVER_INA219_LINK_DEBUG_PRINT(&gs_handle, ina219_interface_debug_print);
+    
+    /* start alert test */
+    ina219_interface_debug_print("ina219: start alert test.\n");
+    
+    /* set addr pin */
+    res = ina219_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set addr pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* set the r */
+    res = ina219_set_resistance(&gs_handle, r);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set resistance failed.\n");
+        
+        return 1;
+    }
+    
+    /* init */
+    res = ina219_init(&gs_handle);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set pga 320 mV */
+    res = ina219_set_pga(&gs_handle, INA219_PGA_320_MV);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set pga failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set calibration */
+    res = ina219_calculate_calibration(&gs_handle, (uint16_t *)&calibration);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: calculate calibration failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ina219_set_calibration(&gs_handle, calibration);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set calibration failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* init the alert engine */
+    memset(gs_event_num, 0, sizeof(gs_event_num));
+    (void)ina219_alert_init(&gs_alert, a_ina219_alert_test_callback);
+    
+    /* rules that could never release */
+    ina219_interface_debug_print("ina219: check the invalid rules.\n");
+    if ((ina219_alert_add_rule(&gs_handle, &gs_alert, INA219_ALERT_CHANNEL_CURRENT, INA219_ALERT_TYPE_RATE,
+                               10.0, 10.0, 1, 1, &index) != 7) ||
+        (ina219_alert_add_rule(&gs_handle, &gs_alert, INA219_ALERT_CHANNEL_POWER, INA219_ALERT_TYPE_OVER,
+                               100.0, 150.0, 1, 1, &index) != 7) ||
+        (ina219_alert_add_rule(&gs_handle, &gs_alert, INA219_ALERT_CHANNEL_CURRENT, INA219_ALERT_TYPE_OVER,
+                               100.0, 20.0, 1, 1, NULL) != 2))
+    {
+        ina219_interface_debug_print("ina219: invalid rule check failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* over current, 2 of 3 */
+    ina219_interface_debug_print("ina219: check the over current rule.\n");
+    res = ina219_alert_add_rule(&gs_handle, &gs_alert, INA219_ALERT_CHANNEL_CURRENT, INA219_ALERT_TYPE_OVER,
+                                100.0, 20.0, 2, 3, &over);
+    for (i = 0; (i < 8) && (res == 0); i++)
+    {
+        res = a_ina219_alert_test_feed(over, INA219_ALERT_CHANNEL_CURRENT, gs_over_value[i], gs_over_active[i]);
+    }
+    if ((res != 0) || (gs_event_num[over] != 2))
+    {
+        ina219_interface_debug_print("ina219: over current rule check failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* bus voltage rate, 1 of 1 */
+    ina219_interface_debug_print("ina219: check the bus voltage rate rule.\n");
+    res = ina219_alert_add_rule(&gs_handle, &gs_alert, INA219_ALERT_CHANNEL_BUS_VOLTAGE, INA219_ALERT_TYPE_RATE,
+                                1000.0, 500.0, 1, 1, &rate);
+    for (i = 0; (i < 5) && (res == 0); i++)
+    {
+        res = a_ina219_alert_test_feed(rate, INA219_ALERT_CHANNEL_BUS_VOLTAGE, gs_rate_value[i], gs_rate_active[i]);
+    }
+    if ((res != 0) || (gs_event_num[rate] != 2) || (gs_event_num[over] != 2))
+    {
+        ina219_interface_debug_print("ina219: bus voltage rate rule check failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish alert test */
+    ina219_interface_debug_print("ina219: finish alert test.\n");
+    (void)ina219_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,467 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_bench_test.c
+ * @brief     driver ina219 bench test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_bench_test.h"
+#include "driver_ina219_timing.h"
+#include <stdlib.h>
+
+static ina219_handle_t gs_handle;                                     /**< ina219 handle */
+static uint32_t gs_transaction;                                       /**< iic transactions */
+static uint32_t gs_latency[INA219_BENCH_TEST_MAX_TIMES];              /**< sample latency in us */
+
+/**
+ * @brief bench test strategy name
+ */
+static const char *const gs_strategy_name[3] =
+{
+    "register", "snapshot", "shunt",
+};
+
+/**
+ * @brief bench test adc mode list
+ */
+static const ina219_adc_mode_t gs_adc_mode[11] =
+{
+    INA219_ADC_MODE_9_BIT_1_SAMPLES, INA219_ADC_MODE_10_BIT_1_SAMPLES,
+    INA219_ADC_MODE_11_BIT_1_SAMPLES, INA219_ADC_MODE_12_BIT_1_SAMPLES,
+    INA219_ADC_MODE_12_BIT_2_SAMPLES, INA219_ADC_MODE_12_BIT_4_SAMPLES,
+    INA219_ADC_MODE_12_BIT_8_SAMPLES, INA219_ADC_MODE_12_BIT_16_SAMPLES,
+    INA219_ADC_MODE_12_BIT_32_SAMPLES, INA219_ADC_MODE_12_BIT_64_SAMPLES,
+    INA219_ADC_MODE_12_BIT_128_SAMPLES,
+};
+
+/**
+ * @brief bench test adc mode name
+ */
+static const char *const gs_adc_mode_name[11] =
+{
+    "9 bit", "10 bit", "11 bit", "12 bit", "12 bit 2 samples", "12 bit 4 samples",
+    "12 bit 8 samples", "12 bit 16 samples", "12 bit 32 samples", "12 bit 64 samples",
+    "12 bit 128 samples",
+};
+
+/**
+ * @brief      counted interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_ina219_bench_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_transaction++;
+    
+    return ina219_interface_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     counted interface iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_ina219_bench_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_transaction++;
+    
+    return ina219_interface_iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief     compare two latencies
+ * @param[in] *a pointer to a latency
+ * @param[in] *b pointer to a latency
+ * @return    compare result
+ * @note      none
+ */
+static int a_ina219_bench_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  wait for a new conversion
+ * @return status code
+ *         - 0 success
+ *         - 1 wait failed
+ * @note   the conversion ready bit of the bus voltage register is polled
+ */
+static uint8_t a_ina219_bench_wait(void)
+{
+    uint32_t i;
+    uint16_t data = 0;
+    
+    for (i = 0; i < 1000; i++)
+    {
+        if (ina219_get_reg(&gs_handle, 0x02, &data) != 0)
+        {
+            return 1;
+        }
+        if ((data & (1 << 1)) != 0)
+        {
+            return 0;
+        }
+        if (i >= 100)
+        {
+            ina219_interface_delay_ms(1);
+        }
+    }
+    ina219_interface_debug_print("ina219: conversion timeout.\n");
+    
+    return 1;
+}
+
+/**
+ * @brief     read one sample
+ * @param[in] triggered triggered flag
+ * @param[in] strategy read strategy
+ * @param[in] mode chip mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      a triggered sample writes the mode first, every sample waits for the conversion ready bit
+ *            and a continuous sample reads the power register to clear it, so no result is read twice
+ */
+static uint8_t a_ina219_bench_sample(uint8_t triggered, uint8_t strategy, ina219_mode_t mode)
+{
+    uint8_t res;
+    uint16_t u_raw;
+    int16_t s_raw;
+    float value;
+    ina219_sample_t sample;
+    
+    /* trigger */
+    if (triggered != 0)
+    {
+        res = ina219_set_mode(&gs_handle, mode);
+        if (res != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* wait for a new conversion */
+    if (a_ina219_bench_wait() != 0)
+    {
+        return 1;
+    }
+    
+    /* read */
+    if (strategy == 0)
+    {
+        if (ina219_read_shunt_voltage(&gs_handle, &s_raw, &value) != 0)
+        {
+            return 1;
+        }
+        res = ina219_read_bus_voltage(&gs_handle, &u_raw, &value);
+        if ((res != 0) && (res != 4))
+        {
+            return 1;
+        }
+        if (ina219_read_current(&gs_handle, &s_raw, &value) != 0)
+        {
+            return 1;
+        }
+        if (ina219_read_power(&gs_handle, &u_raw, &value) != 0)
+        {
+            return 1;
+        }
+    }
+    else if (strategy == 1)
+    {
+        if (ina219_read_sample(&gs_handle, &sample) != 0)
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        if (ina219_read_shunt_voltage(&gs_handle, &s_raw, &value) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* the next conf write clears the ready bit of a triggered sample */
+    if ((triggered == 0) && (strategy != 0))
+    {
+        if (ina219_get_reg(&gs_handle, 0x03, &u_raw) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     bench test
+ * @param[in] addr_pin iic device address
+ * @param[in] r extern resistance
+ * @param[in] times samples of each combination
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      every adc mode, continuous and triggered operation and read strategy is measured,
+ *            only new conversions are counted, times is raised to INA219_BENCH_TEST_MIN_TIMES
+ *            for the percentiles, times <= INA219_BENCH_TEST_MAX_TIMES
+ */
+uint8_t ina219_bench_test(ina219_address_t addr_pin, double r, uint32_t times, uint64_t (*timestamp)(void))
+{
+    uint8_t res;
+    uint8_t s;
+    uint8_t t;
+    uint8_t m;
+    uint16_t calibration;
+    
+    /* check the params */
+    if ((timestamp == NULL) || (times == 0) || (times > INA219_BENCH_TEST_MAX_TIMES))
+    {
+        ina219_interface_debug_print("ina219: times or timestamp is invalid.\n");
+        
+        return 1;
+    }
+    if (times < INA219_BENCH_TEST_MIN_TIMES)
+    {
+        times = INA219_BENCH_TEST_MIN_TIMES;
+    }
+    
+    /* link interface function */
+    DRIVER_INA219_LINK_INIT(&gs_handle, ina219_handle_t);
+    DRIVER_INA219_LINK_IIC_INIT(&gs_handle, ina219_interface_iic_init);
+    DRIVER_INA219_LINK_IIC_DEINIT(&gs_handle, ina219_interface_iic_deinit);
+    DRIVER_INA219_LINK_IIC_READ(&gs_handle, a_ina219_bench_iic_read);
+    DRIVER_INA219_LINK_IIC_WRITE(&gs_handle, a_ina219_bench_iic_write);
+    DRIVER_INA219_LINK_DELAY_MS(&gs_handle, ina219_interface_delay_ms);
+    DRIVER_INA219_LINK_DEBUG_PRINT(&gs_handle, ina219_interface_debug_print);
+    
+    /* start bench test */
+    ina219_interface_debug_print("ina219: start bench test.\n");
+    
+    /* set addr pin */
+    res = ina219_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set addr pin failed.\n");
+       
+        return 1;
+    }
+    
+    /* set the r */
+    res = ina219_set_resistance(&gs_handle, r);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set resistance failed.\n");
+       
+        return 1;
+    }
+    
+    /* init */
+    res = ina219_init(&gs_handle);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: init failed.\n");
+       
+        return 1;
+    }
+    
+    /* set bus voltage range 32V */
+    res = ina219_set_bus_voltage_range(&gs_handle, INA219_BUS_VOLTAGE_RANGE_32V);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set bus voltage range failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set pga 320 mV */
+    res = ina219_set_pga(&gs_handle, INA219_PGA_320_MV);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set pga failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set calibration */
+    res = ina219_calculate_calibration(&gs_handle, (uint16_t *)&calibration);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: calculate calibration failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ina219_set_calibration(&gs_handle, calibration);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set calibration failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* derive the power */
+    res = ina219_set_power_mode(&gs_handle, INA219_POWER_MODE_DERIVED);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set power mode failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* print the table head */
+    ina219_interface_debug_print("ina219: %d samples per row, ratio is p50 / datasheet when triggered and samples/s / datasheet rate when continuous.\n", times);
+    ina219_interface_debug_print("ina219: %-18s %-10s %-8s %10s %8s %8s %8s %9s %9s %6s\n",
+                                 "adc mode", "operation", "strategy", "samples/s", "p50 us", "p90 us", "p99 us",
+                                 "tx/sample", "datasheet", "ratio");
+    
+    /* sweep */
+    for (s = 0; s < 3; s++)
+    {
+        for (t = 0; t < 2; t++)
+        {
+            ina219_mode_t mode;
+            
+            /* the shunt strategy converts only the shunt voltage */
+            if (s == 2)
+            {
+                mode = (t != 0) ? INA219_MODE_SHUNT_VOLTAGE_TRIGGERED : INA219_MODE_SHUNT_VOLTAGE_CONTINUOUS;
+            }
+            else
+            {
+                mode = (t != 0) ? INA219_MODE_SHUNT_BUS_VOLTAGE_TRIGGERED : INA219_MODE_SHUNT_BUS_VOLTAGE_CONTINUOUS;
+            }
+            
+            for (m = 0; m < 11; m++)
+            {
+                uint32_t i;
+                uint32_t period;
+                uint32_t tx;
+                uint16_t conf;
+                uint64_t start;
+                uint64_t total;
+                double rate;
+                double ratio;
+                
+                /* set the adc mode and the operation */
+                if ((ina219_set_bus_voltage_adc_mode(&gs_handle, gs_adc_mode[m]) != 0) ||
+                    (ina219_set_shunt_voltage_adc_mode(&gs_handle, gs_adc_mode[m]) != 0) ||
+                    (ina219_set_mode(&gs_handle, mode) != 0) ||
+                    (ina219_get_reg(&gs_handle, 0x00, &conf) != 0))
+                {
+                    ina219_interface_debug_print("ina219: set mode failed.\n");
+                    (void)ina219_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+                (void)ina219_timing_get_period(conf, &period);
+                ina219_interface_delay_ms(period / 1000 + 1);
+                
+                /* start the clock on a conversion edge */
+                if ((t == 0) &&
+                    ((ina219_get_reg(&gs_handle, 0x03, &conf) != 0) || (a_ina219_bench_wait() != 0) ||
+                    (ina219_get_reg(&gs_handle, 0x03, &conf) != 0)))
+                {
+                    ina219_interface_debug_print("ina219: read failed.\n");
+                    (void)ina219_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+                
+                /* measure */
+                tx = gs_transaction;
+                start = timestamp();
+                for (i = 0; i < times; i++)
+                {
+                    uint64_t begin;
+                    
+                    begin = timestamp();
+                    if (a_ina219_bench_sample(t, s, mode) != 0)
+                    {
+                        ina219_interface_debug_print("ina219: read failed.\n");
+                        (void)ina219_deinit(&gs_handle);
+                        
+                        return 1;
+                    }
+                    gs_latency[i] = (uint32_t)(timestamp() - begin);
+                }
+                total = timestamp() - start;
+                tx = gs_transaction - tx;
+                
+                /* statistics */
+                qsort(gs_latency, times, sizeof(uint32_t), a_ina219_bench_compare);
+                rate = (total != 0) ? ((double)times * 1000000.0 / (double)total) : 0.0;
+                if (t != 0)
+                {
+                    ratio = (double)gs_latency[(times - 1) * 50 / 100] / (double)period;
+                }
+                else
+                {
+                    ratio = rate * (double)period / 1000000.0;
+                }
+                ina219_interface_debug_print("ina219: %-18s %-10s %-8s %10.1f %8u %8u %8u %9.2f %9u %6.2f\n",
+                                             gs_adc_mode_name[m], (t != 0) ? "triggered" : "continuous",
+                                             gs_strategy_name[s], rate,
+                                             gs_latency[(times - 1) * 50 / 100], gs_latency[(times - 1) * 90 / 100],
+                                             gs_latency[(times - 1) * 99 / 100], (double)tx / (double)times,
+                                             period, ratio);
+            }
+        }
+    }
+    
+    /* finish bench test */
+    ina219_interface_debug_print("ina219: finish bench test.\n");
+    (void)ina219_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_bench_test.h
+ * @brief     driver ina219 bench test header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_INA219_BENCH_TEST_H
+#define DRIVER_INA219_BENCH_TEST_H
+
+#include "driver_ina219_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup ina219_test_driver
+ * @{
+ */
+
+/**
+ * @brief ina219 bench test max times definition
+ */
+#ifndef INA219_BENCH_TEST_MAX_TIMES
+    #define INA219_BENCH_TEST_MAX_TIMES 1024        /**< 1024 samples */
+#endif
+
+/**
+ * @brief ina219 bench test min times definition
+ */
+#ifndef INA219_BENCH_TEST_MIN_TIMES
+    #define INA219_BENCH_TEST_MIN_TIMES 100         /**< 100 samples */
+#endif
+
+/**
+ * @brief     bench test
+ * @param[in] addr_pin iic device address
+ * @param[in] r extern resistance
+ * @param[in] times samples of each combination
+ * @param[in] *timestamp pointer to a monotonic timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      every adc mode, continuous and triggered operation and read strategy is measured,
+ *            only new conversions are counted, times is raised to INA219_BENCH_TEST_MIN_TIMES
+ *            for the percentiles, times <= INA219_BENCH_TEST_MAX_TIMES
+ */
+uint8_t ina219_bench_test(ina219_address_t addr_pin, double r, uint32_t times, uint64_t (*timestamp)(void));
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_capture_test.c
+ * @brief     driver ina219 capture test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_capture_test.h"
+#include "driver_ina219_capture.h"
+
+static ina219_handle_t gs_handle;                                   /**< ina219 handle */
+static ina219_capture_t gs_capture;                                 /**< ina219 capture */
+static ina219_capture_entry_t gs_entry[8];                          /**< ina219 capture entry buffer */
+
+/**
+ * @brief     push a bus voltage sample
+ * @param[in] timestamp user timestamp
+ * @param[in] mv bus voltage in mV
+ * @return    status code
+ *            - 0 success
+ *            - 1 push failed
+ * @note      none
+ */
+static uint8_t a_ina219_capture_test_push(uint32_t timestamp, uint32_t mv)
+{
+    ina219_sample_t sample;
+    
+    memset(&sample, 0, sizeof(ina219_sample_t));
+    sample.bus_voltage = (uint16_t)((mv / 4) << 3);
+    
+    return ina219_capture_push(&gs_capture, timestamp, &sample);
+}
+
+/**
+ * @brief     check the frozen capture
+ * @param[in] first timestamp of the oldest entry
+ * @param[in] len expected entry number
+ * @param[in] trigger expected trigger index
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the timestamps must be consecutive
+ */
+static uint8_t a_ina219_capture_test_check(uint32_t first, uint32_t len, uint32_t trigger)
+{
+    ina219_capture_state_t state;
+    ina219_capture_entry_t *entry;
+    uint32_t l;
+    uint32_t t;
+    uint32_t i;
+    
+    if ((ina219_capture_get_state(&gs_capture, &state) != 0) || (state != INA219_CAPTURE_STATE_DONE))
+    {
+        ina219_interface_debug_print("ina219: capture is not done.\n");
+        
+        return 1;
+    }
+    if (ina219_capture_get(&gs_capture, &entry, &l, &t) != 0)
+    {
+        ina219_interface_debug_print("ina219: get capture failed.\n");
+        
+        return 1;
+    }
+    ina219_interface_debug_print("ina219: %d entries, trigger index %d.\n", l, t);
+    if ((l != len) || (t != trigger))
+    {
+        ina219_interface_debug_print("ina219: expect %d entries, trigger index %d.\n", len, trigger);
+        
+        return 1;
+    }
+    for (i = 0; i < l; i++)
+    {
+        if (entry[i].timestamp != first + i)
+        {
+            ina219_interface_debug_print("ina219: entry %d timestamp is %d, expect %d.\n", i, entry[i].timestamp, first + i);
+            
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  capture test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the pre trigger window, the post trigger window and the ring wraparound are checked without the chip
+ */
+uint8_t ina219_capture_test(void)
+{
+    uint8_t res;
+    uint32_t i;
+    ina219_capture_state_t state;
+    ina219_capture_entry_t *entry;
+    uint32_t len;
+    uint32_t trigger;
+    
+    /* start capture test */
+    ina219_interface_debug_print("ina219: start capture test.\n");
+    
+    /* link the debug print only, the bus voltage limit needs no calibration */
+    DRIVER_INA219_LINK_INIT(&gs_handle, ina219_handle_t);
+    DRIVER_INA219_LINK_DEBUG_PRINT(&gs_handle, ina219_interface_debug_print);
+    
+    /* the buffer must hold pre + 1 + post entries */
+    if ((ina219_capture_init(&gs_capture, gs_entry, 8, 4, 4) != 4) ||
+        (ina219_capture_init(&gs_capture, gs_entry, 8, 8, 0) != 4))
+    {
+        ina219_interface_debug_print("ina219: buffer length check failed.\n");
+        
+        return 1;
+    }
+    
+    /* over trigger after the ring wraps twice */
+    ina219_interface_debug_print("ina219: check the over trigger after the ring wraps.\n");
+    res = ina219_capture_init(&gs_capture, gs_entry, 8, 4, 3);
+    res |= ina219_capture_set_trigger(&gs_handle, &gs_capture, INA219_ALERT_CHANNEL_BUS_VOLTAGE, INA219_ALERT_TYPE_OVER, 12000.0);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: capture init failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 20; i++)
+    {
+        res |= a_ina219_capture_test_push(i, 12000);
+    }
+    res |= ina219_capture_get_state(&gs_capture, &state);
+    if ((res != 0) || (state != INA219_CAPTURE_STATE_ARMED) ||
+        (ina219_capture_get(&gs_capture, &entry, &len, &trigger) != 4))
+    {
+        ina219_interface_debug_print("ina219: capture fired below the limit.\n");
+        
+        return 1;
+    }
+    res = a_ina219_capture_test_push(20, 13000);
+    for (i = 21; i < 23; i++)
+    {
+        res |= a_ina219_capture_test_push(i, 12000);
+        res |= ina219_capture_get_state(&gs_capture, &state);
+        if ((res != 0) || (state != INA219_CAPTURE_STATE_TRIGGERED))
+        {
+            ina219_interface_debug_print("ina219: capture is not triggered.\n");
+            
+            return 1;
+        }
+    }
+    res |= a_ina219_capture_test_push(23, 12000);
+    res |= a_ina219_capture_test_push(24, 13000);
+    if ((res != 0) || (a_ina219_capture_test_check(16, 8, 4) != 0))
+    {
+        return 1;
+    }
+    (void)ina219_capture_get(&gs_capture, &entry, &len, &trigger);
+    if ((entry[trigger].sample.bus_voltage >> 3) != 3250)
+    {
+        ina219_interface_debug_print("ina219: trigger entry is wrong.\n");
+        
+        return 1;
+    }
+    
+    /* external trigger before the pre trigger window is full */
+    ina219_interface_debug_print("ina219: check the early external trigger.\n");
+    res = ina219_capture_init(&gs_capture, gs_entry, 8, 4, 3);
+    if ((res != 0) || (ina219_capture_trigger(&gs_capture) != 4))
+    {
+        ina219_interface_debug_print("ina219: empty trigger check failed.\n");
+        
+        return 1;
+    }
+    res = a_ina219_capture_test_push(100, 12000);
+    res |= a_ina219_capture_test_push(101, 12000);
+    res |= ina219_capture_trigger(&gs_capture);
+    if ((res != 0) || (ina219_capture_trigger(&gs_capture) != 4))
+    {
+        ina219_interface_debug_print("ina219: external trigger failed.\n");
+        
+        return 1;
+    }
+    for (i = 102; i < 105; i++)
+    {
+        res |= a_ina219_capture_test_push(i, 12000);
+    }
+    if ((res != 0) || (a_ina219_capture_test_check(100, 5, 1) != 0))
+    {
+        return 1;
+    }
+    
+    /* slope trigger without post trigger entries after a re-arm */
+    ina219_interface_debug_print("ina219: check the slope trigger.\n");
+    res = ina219_capture_init(&gs_capture, gs_entry, 8, 5, 0);
+    res |= ina219_capture_set_trigger(&gs_handle, &gs_capture, INA219_ALERT_CHANNEL_BUS_VOLTAGE, INA219_ALERT_TYPE_RATE, 1000.0);
+    res |= a_ina219_capture_test_push(200, 12000);
+    res |= ina219_capture_arm(&gs_capture);
+    for (i = 0; i < 9; i++)
+    {
+        res |= a_ina219_capture_test_push(300 + i, (i < 8) ? (12000 + i * 500) : 14000);
+    }
+    if ((res != 0) || (a_ina219_capture_test_check(303, 6, 5) != 0))
+    {
+        return 1;
+    }
+    
+    /* finish capture test */
+    ina219_interface_debug_print("ina219: finish capture test.\n");
+    
+    return 0;
+}
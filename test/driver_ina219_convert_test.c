@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_convert_test.c
+ * @brief     driver ina219 convert test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_convert_test.h"
+#include "driver_ina219_convert.h"
+#include "driver_ina219_export.h"
+#include <math.h>
+#include <string.h>
+
+static ina219_handle_t gs_handle;                                   /**< ina219 handle */
+static uint8_t gs_export_buf[INA219_EXPORT_ROW_MAX_SIZE * 2];       /**< export buffer */
+static char gs_row[INA219_EXPORT_ROW_MAX_SIZE * 2];                 /**< exported rows */
+static uint32_t gs_row_len;                                         /**< exported length */
+
+/**
+ * @brief     collect the exported rows
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 output failed
+ * @note      none
+ */
+static uint8_t a_ina219_convert_output(const uint8_t *buf, uint32_t len)
+{
+    if ((gs_row_len + len) >= sizeof(gs_row))
+    {
+        return 1;
+    }
+    memcpy(&gs_row[gs_row_len], buf, len);
+    gs_row_len += len;
+    gs_row[gs_row_len] = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     check a fixed point result
+ * @param[in] *name pointer to a name buffer
+ * @param[in] v converted value
+ * @param[in] expect expected value
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the result may differ from the exact value by the rounding of the q16 lsb
+ */
+static uint8_t a_ina219_convert_check(const char *name, int64_t v, double expect)
+{
+    ina219_interface_debug_print("ina219: %s is %lld, expect %0.1f.\n", name, (long long)v, expect);
+    if (fabs((double)v - expect) > 2.0)
+    {
+        ina219_interface_debug_print("ina219: %s check failed.\n", name);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  convert test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the full scale registers of a 1 mOhm shunt at 200 A are converted and exported without the chip
+ */
+uint8_t ina219_convert_test(void)
+{
+    uint8_t res;
+    double lsb;
+    int16_t shunt_raw[2] = {32000, -32000};
+    uint16_t bus_raw[2] = {(uint16_t)(3000 << 3), (uint16_t)(8000 << 3)};
+    int16_t current_raw[2] = {32767, -32767};
+    uint16_t power_raw[2] = {0, 65535};
+    int32_t shunt[2];
+    int32_t bus[2];
+    int32_t current[2];
+    int64_t power[2];
+    ina219_convert_t convert;
+    ina219_batch_raw_t raw = {shunt_raw, bus_raw, current_raw, power_raw};
+    ina219_batch_fixed_t fixed = {shunt, bus, current, power};
+    ina219_sample_t sample;
+    ina219_export_t exporter;
+    
+    /* link the debug print */
+    DRIVER_INA219_LINK_INIT(&gs_handle, ina219_handle_t);
+    DRIVER_INA219_LINK_DEBUG_PRINT(&gs_handle, ina219_interface_debug_print);
+    
+    /* start convert test */
+    ina219_interface_debug_print("ina219: start convert test.\n");
+    
+    /* 1 mOhm shunt, 200 A full scale */
+    lsb = 200.0 / 32768.0;
+    gs_handle.current_lsb = lsb;
+    res = ina219_convert_init(&gs_handle, &convert);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: convert init failed.\n");
+        
+        return 1;
+    }
+    
+    /* 200 A at 12 V */
+    power_raw[0] = (uint16_t)floor(2400.0 / (20.0 * lsb) + 0.5);
+    res = ina219_convert_batch_fixed(&convert, &raw, &fixed, 2);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: convert batch fixed failed.\n");
+        
+        return 1;
+    }
+    res = a_ina219_convert_check("shunt voltage", shunt[1], -320000.0);
+    res |= a_ina219_convert_check("bus voltage", bus[1], 32000.0);
+    res |= a_ina219_convert_check("full scale current", current[0], 32767.0 * lsb * 1000000.0);
+    res |= a_ina219_convert_check("negative full scale current", current[1], -32767.0 * lsb * 1000000.0);
+    res |= a_ina219_convert_check("2400 W power", power[0], (double)power_raw[0] * 20.0 * lsb * 1000000.0);
+    res |= a_ina219_convert_check("full scale power", power[1], 65535.0 * 20.0 * lsb * 1000000.0);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* export the 2400 W row */
+    memset(&sample, 0, sizeof(sample));
+    sample.bus_voltage = (uint16_t)(3000 << 3);
+    sample.current = current_raw[0];
+    sample.power = power_raw[0];
+    gs_row_len = 0;
+    res = ina219_export_init(&exporter, gs_export_buf, sizeof(gs_export_buf), INA219_EXPORT_FORMAT_CSV, a_ina219_convert_output);
+    if (res == 0)
+    {
+        res = ina219_export_write(&exporter, 0, 0x40, &convert, &sample);
+    }
+    if (res == 0)
+    {
+        res = ina219_export_flush(&exporter);
+    }
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: export failed.\n");
+        
+        return 1;
+    }
+    ina219_interface_debug_print("ina219: exported row is %s", gs_row);
+    if (strcmp(gs_row, "0,64,0.000,12000,199993.896,2400024.414\n") != 0)
+    {
+        ina219_interface_debug_print("ina219: exported row check failed.\n");
+        
+        return 1;
+    }
+    
+    /* a current lsb whose full scale current is out of int32 uA */
+    ina219_interface_debug_print("ina219: check an out of range current lsb.\n");
+    gs_handle.current_lsb = 0.1;
+    res = ina219_convert_init(&gs_handle, &convert);
+    if (res != 4)
+    {
+        ina219_interface_debug_print("ina219: out of range current lsb check failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish convert test */
+    ina219_interface_debug_print("ina219: finish convert test.\n");
+    
+    return 0;
+}
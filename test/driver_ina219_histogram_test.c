@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_histogram_test.c
+ * @brief     driver ina219 histogram test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_histogram_test.h"
+#include "driver_ina219_histogram.h"
+
+static ina219_histogram_t gs_hist;        /**< ina219 histogram */
+
+/**
+ * @brief histogram test bucket edge table, a recorded value and the value its bucket reports
+ */
+static const int32_t gs_edge[12][2] =
+{
+    {31, 31}, {32, 33}, {33, 33}, {34, 35}, {63, 63}, {64, 67},
+    {67, 67}, {68, 71}, {1000, 1023}, {1024, 1087}, {-33, -32}, {-1000, -992},
+};
+
+/**
+ * @brief histogram test percentile table in percent
+ */
+static const uint32_t gs_percent[3] = {50, 90, 99};
+
+/**
+ * @brief  histogram test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the bucket edges, the out of range values and the percentiles are checked without the chip
+ */
+uint8_t ina219_histogram_test(void)
+{
+    uint8_t res;
+    uint32_t i;
+    int32_t raw;
+    
+    /* start histogram test */
+    ina219_interface_debug_print("ina219: start histogram test.\n");
+    
+    /* bucket edges, the full scale value keeps the max above the checked bucket */
+    ina219_interface_debug_print("ina219: check the bucket edges.\n");
+    for (i = 0; i < 12; i++)
+    {
+        (void)ina219_histogram_init(&gs_hist);
+        res = ina219_histogram_record(&gs_hist, gs_edge[i][0]);
+        res |= ina219_histogram_record(&gs_hist, 65535);
+        res |= ina219_histogram_get_quantile(&gs_hist, (gs_edge[i][0] < 0) ? 0.0 : 0.5, &raw);
+        if ((res != 0) || (raw != gs_edge[i][1]))
+        {
+            ina219_interface_debug_print("ina219: %d is reported as %d, expect %d.\n", gs_edge[i][0], raw, gs_edge[i][1]);
+            
+            return 1;
+        }
+    }
+    
+    /* out of range values are not counted */
+    ina219_interface_debug_print("ina219: check the out of range values.\n");
+    (void)ina219_histogram_init(&gs_hist);
+    if ((ina219_histogram_record(&gs_hist, 65536) != 4) || (ina219_histogram_record(&gs_hist, -65536) != 4) ||
+        (gs_hist.count != 0) || (ina219_histogram_get_quantile(&gs_hist, 0.5, &raw) != 4))
+    {
+        ina219_interface_debug_print("ina219: out of range check failed.\n");
+        
+        return 1;
+    }
+    if ((ina219_histogram_record(&gs_hist, 65535) != 0) || (ina219_histogram_record(&gs_hist, -65535) != 0) ||
+        (gs_hist.count != 2) || (gs_hist.min != -65535) || (gs_hist.max != 65535))
+    {
+        ina219_interface_debug_print("ina219: full scale check failed.\n");
+        
+        return 1;
+    }
+    
+    /* percentiles of 1 to 1000 */
+    ina219_interface_debug_print("ina219: check the percentiles.\n");
+    (void)ina219_histogram_init(&gs_hist);
+    for (i = 1; i <= 1000; i++)
+    {
+        (void)ina219_histogram_record(&gs_hist, (int32_t)i);
+    }
+    for (i = 0; i < 3; i++)
+    {
+        int32_t exact = (int32_t)(gs_percent[i] * 10);
+        
+        res = ina219_histogram_get_quantile(&gs_hist, (double)gs_percent[i] / 100.0, &raw);
+        ina219_interface_debug_print("ina219: p%d is %d, exact %d.\n", gs_percent[i], raw, exact);
+        if ((res != 0) || (raw < exact) || (raw > (exact + exact / (INA219_HISTOGRAM_HALF_BUCKET))))
+        {
+            ina219_interface_debug_print("ina219: percentile check failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* finish histogram test */
+    ina219_interface_debug_print("ina219: finish histogram test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,261 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_series_test.c
+ * @brief     driver ina219 series test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_series_test.h"
+#include "driver_ina219_series.h"
+
+static ina219_handle_t gs_handle;                                        /**< ina219 handle */
+static ina219_series_t gs_series;                                        /**< ina219 series */
+static uint8_t gs_frame[256];                                            /**< frame buffer */
+static ina219_sample_t gs_sample[INA219_SERIES_TEST_SAMPLES];            /**< single read samples of the frame */
+static uint32_t gs_timestamp[INA219_SERIES_TEST_SAMPLES];                /**< timestamps of the frame */
+
+/**
+ * @brief     decode the frame and compare it with the single reads
+ * @param[in] num sample number of the frame
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the cnvr bit of the bus voltage is not kept by the frame
+ */
+static uint8_t a_ina219_series_test_check(uint32_t num)
+{
+    ina219_series_decoder_t decoder;
+    ina219_sample_t sample;
+    const uint8_t *buf;
+    uint32_t len;
+    uint32_t t;
+    uint32_t i;
+    
+    (void)ina219_series_get_frame(&gs_series, &buf, &len);
+    ina219_interface_debug_print("ina219: frame of %d samples is %d bytes, %d bytes raw.\n", num, len, num * 12);
+    if (ina219_series_decoder_init(&decoder, buf, len) != 0)
+    {
+        ina219_interface_debug_print("ina219: decoder init failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        if (ina219_series_decoder_next(&decoder, &t, &sample) != 0)
+        {
+            ina219_interface_debug_print("ina219: decode sample %d failed.\n", i);
+            
+            return 1;
+        }
+        if ((t != gs_timestamp[i]) ||
+            (sample.shunt_voltage != gs_sample[i].shunt_voltage) ||
+            (sample.bus_voltage != (gs_sample[i].bus_voltage & (uint16_t)(~(1 << 1)))) ||
+            (sample.current != gs_sample[i].current) ||
+            (sample.power != gs_sample[i].power))
+        {
+            ina219_interface_debug_print("ina219: sample %d differs from the single read.\n", i);
+            
+            return 1;
+        }
+    }
+    if (ina219_series_decoder_next(&decoder, &t, &sample) != 4)
+    {
+        ina219_interface_debug_print("ina219: frame has extra samples.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     series test
+ * @param[in] addr_pin iic device address
+ * @param[in] r extern resistance
+ * @param[in] *timestamp pointer to a timestamp function in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      INA219_SERIES_TEST_SAMPLES single reads are pushed into small frames,
+ *            every decoded frame must give back the same samples and timestamps
+ */
+uint8_t ina219_series_test(ina219_address_t addr_pin, double r, uint64_t (*timestamp)(void))
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t num;
+    uint32_t frame;
+    uint16_t calibration;
+    
+    /* link interface function */
+    DRIVER_INA219_LINK_INIT(&gs_handle, ina219_handle_t);
+    DRIVER_INA219_LINK_IIC_INIT(&gs_handle, ina219_interface_iic_init);
+    DRIVER_INA219_LINK_IIC_DEINIT(&gs_handle, ina219_interface_iic_deinit);
+    DRIVER_INA219_LINK_IIC_READ(&gs_handle, ina219_interface_iic_read);
+    DRIVER_INA219_LINK_IIC_WRITE(&gs_handle, ina219_interface_iic_write);
+    DRIVER_INA219_LINK_DELAY_MS(&gs_handle, ina219_interface_delay_ms);
+    DRIVER_INA219_LINK_DEBUG_PRINT(&gs_handle, ina219_interface_debug_print);
+    
+    /* start series test */
+    ina219_interface_debug_print("ina219: start series test.\n");
+    
+    /* set addr pin */
+    res = ina219_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set addr pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* set the r */
+    res = ina219_set_resistance(&gs_handle, r);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set resistance failed.\n");
+        
+        return 1;
+    }
+    
+    /* init */
+    res = ina219_init(&gs_handle);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set pga 320 mV */
+    res = ina219_set_pga(&gs_handle, INA219_PGA_320_MV);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set pga failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* calculate the calibration */
+    res = ina219_calculate_calibration(&gs_handle, (uint16_t *)&calibration);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: calculate calibration failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set shunt and bus voltage continuous */
+    res = ina219_set_mode(&gs_handle, INA219_MODE_SHUNT_BUS_VOLTAGE_CONTINUOUS);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set mode failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* init the series */
+    res = ina219_series_init(&gs_series, gs_frame, sizeof(gs_frame), INA219_LOG_CHANNEL_ALL);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: series init failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* the calibration steps change the current and the power, the delay steps change the timestamp delta */
+    ina219_interface_debug_print("ina219: compare %d single reads with the decoded frames.\n", INA219_SERIES_TEST_SAMPLES);
+    num = 0;
+    frame = 0;
+    for (i = 0; i < INA219_SERIES_TEST_SAMPLES; i++)
+    {
+        res = ina219_set_calibration(&gs_handle, (uint16_t)(calibration + (i % 8) * 512));
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: set calibration failed.\n");
+            (void)ina219_deinit(&gs_handle);
+            
+            return 1;
+        }
+        ina219_interface_delay_ms(1 + i % 3);
+        gs_timestamp[num] = (uint32_t)timestamp();
+        res = ina219_read_sample(&gs_handle, &gs_sample[num]);
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: read sample failed.\n");
+            (void)ina219_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = ina219_series_push(&gs_series, gs_timestamp[num], &gs_sample[num]);
+        if (res == 4)
+        {
+            /* ship the full frame and start a new one with this sample */
+            if (a_ina219_series_test_check(num) != 0)
+            {
+                (void)ina219_deinit(&gs_handle);
+                
+                return 1;
+            }
+            frame++;
+            gs_timestamp[0] = gs_timestamp[num];
+            gs_sample[0] = gs_sample[num];
+            num = 0;
+            (void)ina219_series_reset(&gs_series);
+            res = ina219_series_push(&gs_series, gs_timestamp[0], &gs_sample[0]);
+        }
+        if (res != 0)
+        {
+            ina219_interface_debug_print("ina219: series push failed.\n");
+            (void)ina219_deinit(&gs_handle);
+            
+            return 1;
+        }
+        num++;
+    }
+    if (a_ina219_series_test_check(num) != 0)
+    {
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ina219_interface_debug_print("ina219: %d samples in %d frames match the single reads.\n", INA219_SERIES_TEST_SAMPLES, frame + 1);
+    
+    /* finish series test */
+    ina219_interface_debug_print("ina219: finish series test.\n");
+    (void)ina219_deinit(&gs_handle);
+    
+    return 0;
+}
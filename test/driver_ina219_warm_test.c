@@ -0,0 +1,231 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_ina219_warm_test.c
+ * @brief     driver ina219 warm test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ina219_warm_test.h"
+#include "driver_ina219_warm.h"
+#include <math.h>
+
+static ina219_handle_t gs_handle;                               /**< ina219 handle */
+static ina219_warm_cache_t gs_cache;                            /**< ina219 warm cache */
+static uint8_t gs_buf[INA219_WARM_MAX_SIZE];                    /**< serialized cache buffer */
+
+/**
+ * @brief     link the interface and set the device
+ * @param[in] addr_pin iic device address
+ * @param[in] r extern resistance
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      none
+ */
+static uint8_t a_ina219_warm_test_link(ina219_address_t addr_pin, double r)
+{
+    DRIVER_INA219_LINK_INIT(&gs_handle, ina219_handle_t);
+    DRIVER_INA219_LINK_IIC_INIT(&gs_handle, ina219_interface_iic_init);
+    DRIVER_INA219_LINK_IIC_DEINIT(&gs_handle, ina219_interface_iic_deinit);
+    DRIVER_INA219_LINK_IIC_READ(&gs_handle, ina219_interface_iic_read);
+    DRIVER_INA219_LINK_IIC_WRITE(&gs_handle, ina219_interface_iic_write);
+    DRIVER_INA219_LINK_DELAY_MS(&gs_handle, ina219_interface_delay_ms);
+    DRIVER_INA219_LINK_DEBUG_PRINT(&gs_handle, ina219_interface_debug_print);
+    if (ina219_set_addr_pin(&gs_handle, addr_pin) != 0)
+    {
+        ina219_interface_debug_print("ina219: set addr pin failed.\n");
+        
+        return 1;
+    }
+    if (ina219_set_resistance(&gs_handle, r) != 0)
+    {
+        ina219_interface_debug_print("ina219: set resistance failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     warm test
+ * @param[in] addr_pin iic device address
+ * @param[in] r extern resistance
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      a configuration with a calibration that is not the pga default is saved,
+ *            serialized, powered down and restored, the restored current must match the shunt voltage
+ */
+uint8_t ina219_warm_test(ina219_address_t addr_pin, double r)
+{
+    uint8_t res;
+    uint16_t calibration;
+    uint32_t len;
+    int16_t s_raw;
+    int16_t c_raw;
+    float mv;
+    float ma;
+    double lsb;
+    double expect;
+    ina219_warm_entry_t entry;
+    ina219_warm_entry_t *found;
+    
+    /* start warm test */
+    ina219_interface_debug_print("ina219: start warm test.\n");
+    
+    /* cold init */
+    if (a_ina219_warm_test_link(addr_pin, r) != 0)
+    {
+        return 1;
+    }
+    res = ina219_init(&gs_handle);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set pga 320 mV */
+    res = ina219_set_pga(&gs_handle, INA219_PGA_320_MV);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set pga failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set 3/4 of the pga calibration so the current lsb differs from the pga default */
+    res = ina219_calculate_calibration(&gs_handle, (uint16_t *)&calibration);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: calculate calibration failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    calibration = (uint16_t)((calibration * 3 / 4) & 0xFFFE);
+    res = ina219_set_calibration(&gs_handle, calibration);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set calibration failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ina219_set_mode(&gs_handle, INA219_MODE_SHUNT_BUS_VOLTAGE_CONTINUOUS);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: set mode failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ina219_interface_debug_print("ina219: set calibration 0x%04X.\n", calibration);
+    
+    /* save and serialize */
+    (void)ina219_warm_cache_init(&gs_cache);
+    res = ina219_warm_save(&gs_handle, &entry);
+    res |= ina219_warm_cache_store(&gs_cache, &entry);
+    res |= ina219_warm_cache_serialize(&gs_cache, gs_buf, sizeof(gs_buf), &len);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: save the cache failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* power down */
+    (void)ina219_deinit(&gs_handle);
+    
+    /* deserialize and warm init with a fresh handle */
+    if (a_ina219_warm_test_link(addr_pin, r) != 0)
+    {
+        return 1;
+    }
+    res = ina219_warm_cache_deserialize(&gs_cache, gs_buf, len);
+    res |= ina219_warm_cache_find(&gs_cache, gs_handle.iic_addr, r, &found);
+    if ((res != 0) || (found->calibration != calibration))
+    {
+        ina219_interface_debug_print("ina219: load the cache failed.\n");
+        
+        return 1;
+    }
+    res = ina219_warm_init(&gs_handle, found);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: warm init failed.\n");
+        
+        return 1;
+    }
+    
+    /* the current lsb must follow the restored calibration */
+    lsb = 0.04096 / ((double)calibration * r);
+    ina219_interface_debug_print("ina219: current lsb is %0.9fA, expect %0.9fA.\n", gs_handle.current_lsb, lsb);
+    if (fabs(gs_handle.current_lsb - lsb) > lsb * 1e-9)
+    {
+        ina219_interface_debug_print("ina219: current lsb is wrong.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* the restored current must match the shunt voltage */
+    ina219_interface_delay_ms(10);
+    res = ina219_read_shunt_voltage(&gs_handle, &s_raw, &mv);
+    res |= ina219_read_current(&gs_handle, &c_raw, &ma);
+    if (res != 0)
+    {
+        ina219_interface_debug_print("ina219: read failed.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    expect = (double)mv / r;
+    ina219_interface_debug_print("ina219: current is %0.3fmA, shunt voltage / r is %0.3fmA.\n", ma, expect);
+    if (fabs((double)ma - expect) > fabs(expect) * 0.01 + 2.0 * lsb * 1000.0)
+    {
+        ina219_interface_debug_print("ina219: restored current is wrong.\n");
+        (void)ina219_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish warm test */
+    ina219_interface_debug_print("ina219: finish warm test.\n");
+    (void)ina219_deinit(&gs_handle);
+    
+    return 0;
+}